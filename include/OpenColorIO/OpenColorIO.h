@@ -6,6 +6,7 @@
 #define INCLUDED_OCIO_OPENCOLORIO_H
 
 #include <cstddef>
+#include <future>
 #include <iosfwd>
 #include <limits>
 #include <stdexcept>
@@ -120,6 +121,86 @@ public:
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/**
+ * \brief Usage statistics of a cache, to check the efficiency of the caches or to monitor
+ * their memory usage.
+ *
+ * A lookup is either a hit or a miss, and a miss usually leads to an insert. The byte size is an
+ * estimate, mainly accounting for the LUTs, and is 0 for the caches without size estimate.
+ */
+struct OCIOEXPORT CacheStats
+{
+    /// Number of lookups finding the entry.
+    size_t m_hits{ 0 };
+    /// Number of lookups not finding the entry.
+    size_t m_misses{ 0 };
+    /// Number of entries added to the cache.
+    size_t m_inserts{ 0 };
+    /// Number of entries evicted to stay within the cache capacity.
+    size_t m_evictions{ 0 };
+    /// Current number of entries.
+    size_t m_entries{ 0 };
+    /// Current estimated memory size of the entries in bytes.
+    size_t m_bytes{ 0 };
+};
+
+extern OCIOEXPORT std::ostream & operator<<(std::ostream &, const CacheStats &);
+
+/// Get the statistics of the global cache of the loaded LUT files.
+extern OCIOEXPORT CacheStats GetFileCacheStats();
+/// Get the statistics of the global cache of the file hashes, used to identify the files.
+extern OCIOEXPORT CacheStats GetFileHashCacheStats();
+/// Get the statistics of the global cache of the search trees used to evaluate the inverse 3D LUTs.
+extern OCIOEXPORT CacheStats GetLut3DInverseCacheStats();
+/// Get the statistics of the global cache of the composed 3D LUTs involving an inverse 3D LUT.
+extern OCIOEXPORT CacheStats GetLut3DComposeCacheStats();
+/**
+ * \brief Reset the hit, miss, insert & eviction counters of the global caches.
+ *
+ * \note The statistics of the instance specific caches are reset by their own methods.
+ */
+extern OCIOEXPORT void ResetGlobalCacheStats();
+
+/**
+ * \brief Set the maximum number of pixels the CPU processors send at once through the complete
+ * list of ops.
+ *
+ * Each image line is processed in blocks of pixels (i.e. from the input buffer unpacking to
+ * the output buffer packing) so the intermediate pixels stay in the L1 data cache from one
+ * op to the next one. A value of 0 means to process complete lines. The default is 64 pixels.
+ *
+ * \note The setting only changes the performance of CPUProcessor::apply, not its results.
+ */
+extern OCIOEXPORT void SetCPUProcessorBlockSize(unsigned numPixels);
+/// Get the maximum number of pixels the CPU processors send at once through the ops.
+extern OCIOEXPORT unsigned GetCPUProcessorBlockSize();
+
+/**
+ * \brief Set the maximum absolute error allowed between a list of ops and its bake to a 3D LUT,
+ * see OPTIMIZATION_BAKE_LUT3D.
+ *
+ * The error is measured against the original ops on a sampling of the input domain. The default
+ * is half a 10-bit code value i.e. 0.5 / 1023.
+ */
+extern OCIOEXPORT void SetLut3DBakeMaxError(float maxError);
+/// Get the maximum absolute error allowed when baking a list of ops to a 3D LUT.
+extern OCIOEXPORT float GetLut3DBakeMaxError();
+
+/**
+ * \brief Set the capacity of the global cache of the loaded LUT files, where 0 means unbounded
+ * (the default).
+ *
+ * Once the cache holds more than maxEntries files, or once the size on disk of its files is more
+ * than maxBytes, the least recently used files are evicted from the cache. The capacity keeps the
+ * memory flat in long-lived processes loading many files, without flushing everything as
+ * ClearAllCaches() does.
+ */
+extern OCIOEXPORT void SetFileCacheCapacity(size_t maxEntries, size_t maxBytes);
+/// Get the maximum number of files of the file cache, 0 meaning unbounded.
+extern OCIOEXPORT size_t GetFileCacheMaxEntries();
+/// Get the maximum size on disk of the files of the file cache, 0 meaning unbounded.
+extern OCIOEXPORT size_t GetFileCacheMaxBytes();
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -1041,6 +1122,25 @@ public:
     // properties are being used by the processor.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
+    /**
+     * \brief Set the capacity of the processor cache of the config instance, where 0 means
+     * unbounded (the default).
+     *
+     * Once the cache holds more than maxEntries processors, or once the estimated memory size of
+     * its processors (mainly their LUTs) is more than maxBytes, the least recently used processors
+     * are evicted from the cache. That does not release the processors still in use.
+     */
+    void setProcessorCacheCapacity(size_t maxEntries, size_t maxBytes) noexcept;
+    /// Get the maximum number of processors of the processor cache, 0 meaning unbounded.
+    size_t getProcessorCacheMaxEntries() const noexcept;
+    /// Get the maximum estimated memory size of the processor cache, 0 meaning unbounded.
+    size_t getProcessorCacheMaxBytes() const noexcept;
+
+    /// Get the usage statistics of the processor cache of the config instance.
+    CacheStats getProcessorCacheStats() const;
+    /// Reset the hit, miss, insert & eviction counters of the processor cache.
+    void resetProcessorCacheStats() noexcept;
+
 private:
     Config();
 
@@ -2008,6 +2108,17 @@ public:
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
 
+    //
+    // Caches
+    //
+
+    /// Get the usage statistics of the caches of the optimized, GPU & CPU processors.
+    CacheStats getOptimizedProcessorCacheStats() const;
+    CacheStats getGPUProcessorCacheStats() const;
+    CacheStats getCPUProcessorCacheStats() const;
+    /// Reset the hit, miss, insert & eviction counters of the processor caches.
+    void resetCacheStats() const noexcept;
+
     //!cpp:function::
     Processor(const Processor &) = delete;
     //!cpp:function::
@@ -2073,6 +2184,46 @@ public:
     void apply(ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    /**
+     * \brief Apply to an image using several threads.
+     *
+     * The image is split into bands of lines processed concurrently by an internal pool of
+     * threads (the calling thread included), the result being identical to the single
+     * threaded apply. A numThreads of 0 means to use all the hardware threads.
+     */
+    void apply(ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
+    /**
+     * \brief Apply to a region of interest of an image, the other pixels being left untouched.
+     *
+     * The regions of interest must be inside their images and the source and destination ones
+     * must have the same dimensions. No pixel is copied i.e. only the pixels of the regions are
+     * read and written, see the multi-threaded apply for numThreads.
+     */
+    void apply(ImageDesc & imgDesc, const ImageROI & roi, unsigned numThreads = 1) const;
+    void apply(const ImageDesc & srcImgDesc, const ImageROI & srcROI,
+               ImageDesc & dstImgDesc, const ImageROI & dstROI,
+               unsigned numThreads = 1) const;
+
+    /**
+     * \brief Apply to an image asynchronously, the processing result being identical to the
+     * synchronous apply.
+     *
+     * The images are queued and processed one at a time in the submission order by a thread
+     * dedicated to the processor, see the multi-threaded apply for numThreads. The call only
+     * blocks while two images are already waiting for their processing, so the reading or
+     * writing of images could overlap with their processing. The image descriptions are copied
+     * but the pixel buffers must stay valid until the returned future is ready, and a processing
+     * error is reported by the future.
+     *
+     * \note
+     *    Destroying the processor waits for the completion of all its queued images.
+     */
+    std::future<void> applyAsync(ImageDesc & imgDesc, unsigned numThreads = 1) const;
+    std::future<void> applyAsync(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc,
+                                 unsigned numThreads = 1) const;
+
     /**
      * Apply to a single pixel respecting that the input and output bit-depths
      * be 32-bit float and the image buffer be packed RGB/RGBA.
@@ -2085,6 +2236,17 @@ public:
     void applyRGB(float * pixel) const;
     void applyRGBA(float * pixel) const;
 
+    /**
+     * Apply to an array of contiguous pixels respecting that the input and output bit-depths
+     * be 32-bit float and the pixels be packed RGB/RGBA.
+     *
+     * \note
+     *    Unlike the single pixel functions, the pixels are processed in blocks by the same
+     *    kernels than the image apply.
+     */
+    void applyRGBs(float * pixels, size_t numPixels) const;
+    void applyRGBAs(float * pixels, size_t numPixels) const;
+
     //!cpp:function::
     CPUProcessor(const CPUProcessor &) = delete;
     //!cpp:function::
@@ -2325,6 +2487,29 @@ private:
 
 const ptrdiff_t AutoStride = std::numeric_limits<ptrdiff_t>::min();
 
+/**
+ * \brief Region of interest of an image i.e. a rectangle of pixels starting at the (x, y)
+ * pixel position, where (0, 0) is the first pixel of the image buffer.
+ */
+struct OCIOEXPORT ImageROI
+{
+    ImageROI() = default;
+    ImageROI(const ImageROI &) = default;
+    ImageROI(long x, long y, long width, long height)
+        : m_x(x)
+        , m_y(y)
+        , m_width(width)
+        , m_height(height)
+    {
+    }
+    long m_x{ 0 };
+    long m_y{ 0 };
+    long m_width{ 0 };
+    long m_height{ 0 };
+};
+
+extern OCIOEXPORT std::ostream & operator<<(std::ostream &, const ImageROI &);
+
 /**
  * \brief
  * This is a light-weight wrapper around an image, that provides a context
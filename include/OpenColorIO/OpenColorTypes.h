@@ -84,6 +84,8 @@ class OCIOEXPORT ImageDesc;
 typedef OCIO_SHARED_PTR<ImageDesc> ImageDescRcPtr;
 typedef OCIO_SHARED_PTR<const ImageDesc> ConstImageDescRcPtr;
 
+struct OCIOEXPORT ImageROI;
+
 class OCIOEXPORT Exception;
 
 class OCIOEXPORT GpuShaderCreator;
@@ -446,7 +448,9 @@ enum FixedFunctionStyle
     FIXED_FUNCTION_RGB_TO_HSV,          ///< Classic RGB to HSV function
     FIXED_FUNCTION_XYZ_TO_xyY,          ///< CIE XYZ to 1931 xy chromaticity coordinates
     FIXED_FUNCTION_XYZ_TO_uvY,          ///< CIE XYZ to 1976 u'v' chromaticity coordinates
-    FIXED_FUNCTION_XYZ_TO_LUV           ///< CIE XYZ to 1976 CIELUV colour space (D65 white)
+    FIXED_FUNCTION_XYZ_TO_LUV,          ///< CIE XYZ to 1976 CIELUV colour space (D65 white)
+    FIXED_FUNCTION_LIN_TO_PQ,           ///< SMPTE ST 2084 (PQ) inverse EOTF, linear 1.0 is 100 nits
+    FIXED_FUNCTION_LIN_TO_HLG           ///< Rec.2100 HLG OETF, linear 1.0 is the nominal peak
 };
 
 /// Enumeration of the :cpp:class:`ExposureContrastTransform` transform algorithms.
@@ -546,6 +550,21 @@ enum OptimizationFlags : unsigned long
     OPTIMIZATION_PAIR_IDENTITY_LOG               = 0x00001000,
     OPTIMIZATION_PAIR_IDENTITY_GRADING           = 0x00002000,
 
+    /**
+     * For CPU processor, use the coarsest SIMD approximations for log, exp, and pow (relative
+     * error of about 1e-4, e.g. for viewers).  Takes precedence over
+     * OPTIMIZATION_FAST_LOG_EXP_POW, except when OPTIMIZATION_ACCURATE_LOG_EXP_POW is also set
+     * (e.g. OPTIMIZATION_ALL) where the conflicting tiers resolve to the fast approximations.
+     */
+    OPTIMIZATION_DRAFT_LOG_EXP_POW               = 0x00004000,
+
+    /**
+     * For CPU processor, use SIMD approximations for log, exp, and pow that are accurate to
+     * the float precision (relative error of about 1e-7, e.g. for final renders).  Only used
+     * when neither OPTIMIZATION_FAST_LOG_EXP_POW nor OPTIMIZATION_DRAFT_LOG_EXP_POW is set.
+     */
+    OPTIMIZATION_ACCURATE_LOG_EXP_POW            = 0x00008000,
+
     /// Compose a pair of ops into a single op.
     OPTIMIZATION_COMP_EXPONENT                   = 0x00040000,
     OPTIMIZATION_COMP_GAMMA                      = 0x00080000,
@@ -566,7 +585,8 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_LUT_INV_FAST                    = 0x02000000,
 
-    // For CPU processor, in SSE mode, use a faster approximation for log, exp, and pow.
+    // For CPU processor, in SSE mode, use a faster approximation for log, exp, and pow
+    // (relative error of about 1e-5).
     OPTIMIZATION_FAST_LOG_EXP_POW                = 0x04000000,
 
     // Break down certain ops into simpler components where possible.  For example, convert a CDL
@@ -579,6 +599,36 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x10000000,
 
+    /**
+     * For integer input bit-depths only, replace a list of ops with channel crosstalk by a 3D
+     * LUT, preceded by a shaper 1D LUT built from the separable ops at the head of the list (if
+     * any). The smallest grid size within the maximum error set by SetLut3DBakeMaxError() is
+     * used, and the ops are left untouched if there is none.
+     */
+    OPTIMIZATION_BAKE_LUT3D                      = 0x20000000,
+
+    /**
+     * For CPU processor, store the values of the forward Lut1D (for 32-bit float input and float
+     * output) and Lut3D (AVX2 renderers only) ops as half values to halve the memory footprint
+     * of the renderer tables. The op data of the processors (e.g. kept by the Config processor
+     * cache) and of the file cache stay 32-bit float, so the memory of a LUT used by a process
+     * goes from 3 + 4 to 3 + 2 floats per Lut3D entry (29% less) and from 3 + 3 to 3 + 1.5
+     * floats per Lut1D entry (25% less). The values are rounded to the nearest half value (i.e.
+     * a relative error of at most 2^-11, or 4.9e-4, and an absolute error of at most 2^-25 below
+     * 2^-14), and the values outside the half domain are clamped to +/-65504. As the
+     * interpolation is a weighted average of the LUT values, the error of the results is at most
+     * the one of the largest LUT value used.
+     */
+    OPTIMIZATION_LUT_HALF_STORAGE                = 0x40000000,
+
+    /**
+     * For CPU processor, when OPTIMIZATION_LUT_INV_FAST is not set, evaluate the inverse Lut3D
+     * ops by refining the result of their fast inverse with a few Newton iterations on the
+     * tetrahedral interpolation of the forward LUT, instead of the exact search. It is much
+     * faster and, where the forward LUT is invertible, the results are almost identical.
+     */
+    OPTIMIZATION_LUT_INV_REFINE                  = 0x80000000,
+
     /// Apply all possible optimizations.
     OPTIMIZATION_ALL                             = 0xFFFFFFFF,
 
@@ -610,7 +660,7 @@ enum OptimizationFlags : unsigned long
     OPTIMIZATION_GOOD      = OPTIMIZATION_VERY_GOOD | OPTIMIZATION_COMP_LUT3D,
 
     /// For quite lossy optimizations.
-    OPTIMIZATION_DRAFT     = OPTIMIZATION_ALL,
+    OPTIMIZATION_DRAFT     = OPTIMIZATION_ALL & ~OPTIMIZATION_ACCURATE_LOG_EXP_POW,
 
     OPTIMIZATION_DEFAULT   = OPTIMIZATION_VERY_GOOD
 };
@@ -24,6 +24,10 @@ set(CMAKE_FIND_PACKAGE_NO_SYSTEM_PACKAGE_REGISTRY ON CACHE BOOL
 ###############################################################################
 ### Packages and versions ###
 
+# Threads
+# The system thread library used by the CPU multi-threaded processing.
+find_package(Threads REQUIRED)
+
 # expat
 # https://github.com/libexpat/libexpat
 find_package(expat 2.2.8 REQUIRED)
@@ -0,0 +1,35 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright Contributors to the OpenColorIO Project.
+
+include(CheckCXXSourceCompiles)
+
+# Compiler arguments for the source files holding the AVX2 kernels, which also use the FMA &
+# F16C instructions. The floating-point contraction is disabled so the kernels give the same
+# results as the SSE ones.
+if(USE_MSVC)
+    set(OCIO_AVX2_ARGS "/arch:AVX2")
+elseif(USE_GCC OR USE_CLANG)
+    set(OCIO_AVX2_ARGS "-mavx2;-mfma;-mf16c;-ffp-contract=off")
+endif()
+
+set(_cmake_required_flags_orig "${CMAKE_REQUIRED_FLAGS}")
+string(REPLACE ";" " " CMAKE_REQUIRED_FLAGS "${OCIO_AVX2_ARGS}")
+
+check_cxx_source_compiles ("
+    #include <immintrin.h>
+    int main ()
+    {
+        float vals[8] = {0};
+        __m256 a = _mm256_loadu_ps (vals);
+        __m256i b = _mm256_add_epi32 (_mm256_castps_si256(a), _mm256_castps_si256(a));
+        a = _mm256_fmadd_ps (a, _mm256_castsi256_ps(b), a);
+        _mm256_storeu_ps (vals, a);
+        _mm256_storeu_ps (vals, _mm256_cvtph_ps (_mm256_cvtps_ph (a, 0)));
+        return (0);
+    }"
+    HAVE_AVX2)
+
+set(CMAKE_REQUIRED_FLAGS "${_cmake_required_flags_orig}")
+unset(_cmake_required_flags_orig)
+
+mark_as_advanced(HAVE_AVX2)
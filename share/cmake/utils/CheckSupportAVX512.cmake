@@ -0,0 +1,32 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright Contributors to the OpenColorIO Project.
+
+include(CheckCXXSourceCompiles)
+
+# Compiler arguments for the source files holding the AVX-512 kernels.
+if(USE_MSVC)
+    set(OCIO_AVX512_ARGS "/arch:AVX512")
+elseif(USE_GCC OR USE_CLANG)
+    set(OCIO_AVX512_ARGS "-mavx512f;-mfma;-ffp-contract=off")
+endif()
+
+set(_cmake_required_flags_orig "${CMAKE_REQUIRED_FLAGS}")
+string(REPLACE ";" " " CMAKE_REQUIRED_FLAGS "${OCIO_AVX512_ARGS}")
+
+check_cxx_source_compiles ("
+    #include <immintrin.h>
+    int main ()
+    {
+        float vals[16] = {0};
+        __m512 a = _mm512_loadu_ps (vals);
+        __mmask16 m = _mm512_cmp_ps_mask (a, a, _CMP_EQ_OQ);
+        a = _mm512_mask_fmadd_ps (a, m, a, a);
+        _mm512_storeu_ps (vals, a);
+        return (0);
+    }"
+    HAVE_AVX512)
+
+set(CMAKE_REQUIRED_FLAGS "${_cmake_required_flags_orig}")
+unset(_cmake_required_flags_orig)
+
+mark_as_advanced(HAVE_AVX512)
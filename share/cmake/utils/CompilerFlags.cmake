@@ -77,3 +77,31 @@ if(NOT HAVE_SSE2)
     message(STATUS "Disabling SSE optimizations, as the target doesn't support them")
     set(OCIO_USE_SSE OFF)
 endif(NOT HAVE_SSE2)
+
+
+###############################################################################
+# Define if AVX2 and AVX-512 can be used. The kernels are only compiled for these instruction
+# sets, the library itself still targets SSE2 and selects the kernels at runtime.
+
+if(NOT OCIO_USE_SSE)
+    set(OCIO_USE_AVX2 OFF)
+    set(OCIO_USE_AVX512 OFF)
+endif()
+
+if(OCIO_USE_AVX2)
+    include(CheckSupportAVX2)
+
+    if(NOT HAVE_AVX2)
+        message(STATUS "Disabling AVX2 optimizations, as the compiler doesn't support them")
+        set(OCIO_USE_AVX2 OFF)
+    endif(NOT HAVE_AVX2)
+endif()
+
+if(OCIO_USE_AVX512)
+    include(CheckSupportAVX512)
+
+    if(NOT HAVE_AVX512)
+        message(STATUS "Disabling AVX-512 optimizations, as the compiler doesn't support them")
+        set(OCIO_USE_AVX512 OFF)
+    endif(NOT HAVE_AVX512)
+endif()
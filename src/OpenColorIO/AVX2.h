@@ -0,0 +1,415 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_AVX2_H
+#define INCLUDED_OCIO_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+// This header must only be included by the translation units compiled for AVX2, FMA & F16C
+// (i.e. the *_AVX2.cpp files), and their functions must only be called once
+// CPUInfo::hasAVX2() is checked. Unlike SSE.h, there is no global constant on purpose as
+// their dynamic initialization would execute AVX instructions when loading the library.
+#if !defined(__AVX2__) || !defined(__FMA__) || !defined(__F16C__)
+#if !defined(_MSC_VER)
+#error "AVX2.h requires the AVX2, FMA & F16C compiler flags."
+#endif
+#endif
+
+
+#include <immintrin.h>
+#include <utility>
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "MathUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Select function in AVX2
+//
+// Return the parameter arg_false when the parameter mask is 0x0,
+// or the parameter arg_true when the mask is 0xffffffff.
+inline __m256 avx2Select(const __m256 & mask, const __m256 & arg_true, const __m256 & arg_false)
+{
+    return _mm256_blendv_ps(arg_false, arg_true, mask);
+}
+
+// Return the absolute values.
+inline __m256 avx2Abs(const __m256 x)
+{
+    return _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+}
+
+// Return the sign bits i.e. -0.0f for negative values (including -0, -NaN & -Inf) and 0 otherwise.
+inline __m256 avx2Sign(const __m256 x)
+{
+    return _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000)));
+}
+
+// log2 function in AVX2
+//
+// Same approximation as sseLog2() i.e. the mantissa is evaluated using a Chebyshev
+// polynomial of degree 5 over the range [1.0, 2.0[. The polynomial is not evaluated with FMA
+// instructions on purpose so the results are identical to the SSE renderers.
+inline __m256 avx2Log2(__m256 x)
+{
+    // y = log2( x ) = log2( 2^exposant * mantissa )
+    //               = exposant + log2( mantissa )
+
+    const __m256i emask = _mm256_set1_epi32(0x7F800000);
+
+    const __m256 mantissa
+        = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), x), _mm256_set1_ps(1.0f));
+
+    __m256 log2 = _mm256_set1_ps((float)+4.487361286440374006195e-2);
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)-2.800364054395965731506));
+
+    const __m256i exponent
+        = _mm256_sub_epi32(
+            _mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), emask), 23),
+            _mm256_set1_epi32(127));
+
+    return _mm256_add_ps(log2, _mm256_cvtepi32_ps(exponent));
+}
+
+// exp2 function in AVX2
+//
+// Same approximation as sseExp2() i.e. exp2(integer) is built from the exponent bits and
+// exp2(fraction) is evaluated using a Chebyshev polynomial of degree 4.
+inline __m256 avx2Exp2(__m256 x)
+{
+    // y = exp2( x ) = exp2(integer + fraction)
+    //               = exp2(integer) * exp2(fraction)
+    //               = zf * mexp
+
+    // Same integer part as sseExp2() i.e. one is subtracted from all the negative values
+    // (including the negative integers) and from NaNs so the underflow & overflow limits
+    // and the NaN results are identical.
+    const __m256i floor_x
+        = _mm256_add_epi32(
+            _mm256_cvttps_epi32(x),
+            _mm256_castps_si256(_mm256_cmp_ps(_mm256_setzero_ps(), x, _CMP_NLE_UQ)));
+
+    // Compute exp2(floor_x) by moving floor_x to the exponent bits of the floating-point number.
+    const __m256 zf
+        = _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_add_epi32(floor_x, _mm256_set1_epi32(127)), 23));
+
+    const __m256 iexp = _mm256_cvtepi32_ps(floor_x);
+    const __m256 fraction = _mm256_sub_ps(x, iexp);
+
+    // Compute exp2(fraction) using a polynomial approximation.
+    __m256 mexp = _mm256_set1_ps((float)1.353416792833547468620e-2);
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)1.000002593370603213644));
+
+    __m256 exp2 = _mm256_mul_ps(zf, mexp);
+
+    // Handle underflow i.e. the result is smaller than the smallest representable
+    // floating-point number, so force the result to zero.
+    exp2 = _mm256_andnot_ps(_mm256_cmp_ps(iexp, _mm256_set1_ps(-126.0f), _CMP_LT_OQ), exp2);
+
+    // Handle overflow i.e. the result is larger than the largest representable
+    // floating-point number, so force the result to positive infinity.
+    exp2 = avx2Select(_mm256_cmp_ps(iexp, _mm256_set1_ps(127.0f), _CMP_GT_OQ),
+                      _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)), exp2);
+
+    return exp2;
+}
+
+// Power function in AVX2
+//
+// pow( x, exp ) = exp2( exp * log2( x ) ), see ssePower() for details.
+//
+// Results from base values smaller than zero are mapped to zero.
+inline __m256 avx2Power(__m256 x, __m256 exp)
+{
+    __m256 values = avx2Exp2(_mm256_mul_ps(exp, avx2Log2(x)));
+
+    // Handle values where base is smaller or equal than zero.
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+
+// Draft log2, exp2 and power functions in AVX2, see sseLog2Draft().
+inline __m256 avx2Log2Draft(__m256 x)
+{
+    const __m256i emask = _mm256_set1_epi32(0x7F800000);
+
+    const __m256 mantissa
+        = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), x), _mm256_set1_ps(1.0f));
+
+    __m256 log2 = _mm256_set1_ps((float)-8.161581241586652e-2);
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)+6.451423870703817e-1));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)-2.120675182919779));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)+4.070090841774721));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa), _mm256_set1_ps((float)-2.512854641644485));
+
+    const __m256i exponent
+        = _mm256_sub_epi32(
+            _mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), emask), 23),
+            _mm256_set1_epi32(127));
+
+    return _mm256_add_ps(log2, _mm256_cvtepi32_ps(exponent));
+}
+
+inline __m256 avx2Exp2Draft(__m256 x)
+{
+    // Same integer part, underflow and overflow handling as avx2Exp2().
+    const __m256i floor_x
+        = _mm256_add_epi32(
+            _mm256_cvttps_epi32(x),
+            _mm256_castps_si256(_mm256_cmp_ps(_mm256_setzero_ps(), x, _CMP_NLE_UQ)));
+
+    const __m256 zf
+        = _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_add_epi32(floor_x, _mm256_set1_epi32(127)), 23));
+
+    const __m256 iexp = _mm256_cvtepi32_ps(floor_x);
+    const __m256 fraction = _mm256_sub_ps(x, iexp);
+
+    __m256 mexp = _mm256_set1_ps((float)7.802452268953215e-2);
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)2.260671553970901e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)6.958335404792920e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction), _mm256_set1_ps((float)9.999252185659142e-1));
+
+    __m256 exp2 = _mm256_mul_ps(zf, mexp);
+    exp2 = _mm256_andnot_ps(_mm256_cmp_ps(iexp, _mm256_set1_ps(-126.0f), _CMP_LT_OQ), exp2);
+    return avx2Select(_mm256_cmp_ps(iexp, _mm256_set1_ps(127.0f), _CMP_GT_OQ),
+                      _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)), exp2);
+}
+
+inline __m256 avx2PowerDraft(__m256 x, __m256 exp)
+{
+    const __m256 values = avx2Exp2Draft(_mm256_mul_ps(exp, avx2Log2Draft(x)));
+
+    // Handle values where base is smaller or equal than zero.
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+
+// Accurate log2, exp2 and power functions in AVX2, see sseLog2Accurate(). FMA instructions
+// are not used so that the results are identical to the SSE ones.
+
+// Evaluate log2(x) of the eight positive finite values as two sets of four doubles.
+inline void avx2Log2Accurate(const __m256 x, __m256d & log2Lo, __m256d & log2Hi)
+{
+    const __m256i emask = _mm256_set1_epi32(0x7F800000);
+
+    // Normalize the denormal values.
+    const __m256 denorm
+        = _mm256_cmp_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x00800000)), _CMP_LT_OQ);
+    const __m256 xn = avx2Select(denorm, _mm256_mul_ps(x, _mm256_set1_ps(8388608.0f)), x);
+
+    // x = 2^exponent * mantissa with mantissa in [sqrt(0.5), sqrt(2)[.
+    __m256 mantissa
+        = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), xn), _mm256_set1_ps(1.0f));
+    __m256i exponent
+        = _mm256_sub_epi32(
+            _mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(xn), emask), 23),
+            _mm256_set1_epi32(127));
+    exponent = _mm256_sub_epi32(exponent, _mm256_and_si256(_mm256_castps_si256(denorm),
+                                                           _mm256_set1_epi32(23)));
+
+    const __m256 upper = _mm256_cmp_ps(mantissa, _mm256_set1_ps(1.41421356f), _CMP_GE_OQ);
+    mantissa = avx2Select(upper, _mm256_mul_ps(mantissa, _mm256_set1_ps(0.5f)), mantissa);
+    exponent = _mm256_sub_epi32(exponent, _mm256_castps_si256(upper));
+
+    const __m256 fexp = _mm256_cvtepi32_ps(exponent);
+
+    const auto log2Quad = [](const __m256d m, const __m256d e)
+    {
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d s   = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+        const __m256d s2  = _mm256_mul_pd(s, s);
+
+        __m256d poly = _mm256_set1_pd(1.0 / 9.0);
+        poly = _mm256_add_pd(_mm256_mul_pd(poly, s2), _mm256_set1_pd(1.0 / 7.0));
+        poly = _mm256_add_pd(_mm256_mul_pd(poly, s2), _mm256_set1_pd(1.0 / 5.0));
+        poly = _mm256_add_pd(_mm256_mul_pd(poly, s2), _mm256_set1_pd(1.0 / 3.0));
+        poly = _mm256_add_pd(_mm256_mul_pd(poly, s2), one);
+
+        // 2 / log(2).
+        const __m256d k = _mm256_set1_pd(2.8853900817779268);
+        return _mm256_add_pd(e, _mm256_mul_pd(_mm256_mul_pd(s, poly), k));
+    };
+
+    log2Lo = log2Quad(_mm256_cvtps_pd(_mm256_castps256_ps128(mantissa)),
+                      _mm256_cvtps_pd(_mm256_castps256_ps128(fexp)));
+    log2Hi = log2Quad(_mm256_cvtps_pd(_mm256_extractf128_ps(mantissa, 1)),
+                      _mm256_cvtps_pd(_mm256_extractf128_ps(fexp, 1)));
+}
+
+// Evaluate exp2(x) for four doubles.
+inline __m256d avx2Exp2Accurate(__m256d x)
+{
+    // Clamp to the range of the float results (NaNs are preserved).
+    x = _mm256_min_pd(_mm256_set1_pd(129.0), _mm256_max_pd(_mm256_set1_pd(-151.0), x));
+
+    // exp2(x) = exp2(n) * exp2(f) with n = round(x) and f in [-0.5, 0.5].
+    const __m128i n = _mm256_cvtpd_epi32(x);
+    const __m256d f = _mm256_mul_pd(_mm256_sub_pd(x, _mm256_cvtepi32_pd(n)),
+                                    _mm256_set1_pd(0.69314718055994531));
+
+    __m256d poly = _mm256_set1_pd(1.0 / 40320.0);
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, f), _mm256_set1_pd(1.0 / 5040.0));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, f), _mm256_set1_pd(1.0 / 720.0));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, f), _mm256_set1_pd(1.0 / 120.0));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, f), _mm256_set1_pd(1.0 / 24.0));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, f), _mm256_set1_pd(1.0 / 6.0));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, f), _mm256_set1_pd(0.5));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, f), _mm256_set1_pd(1.0));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, f), _mm256_set1_pd(1.0));
+
+    // Compute exp2(n) by moving n to the exponent bits of the double.
+    const __m256i bits
+        = _mm256_slli_epi64(
+            _mm256_cvtepi32_epi64(_mm_add_epi32(n, _mm_set1_epi32(1023))), 52);
+
+    return _mm256_mul_pd(poly, _mm256_castsi256_pd(bits));
+}
+
+// Pack two sets of four doubles into eight floats.
+inline __m256 avx2PackDoubles(const __m256d lo, const __m256d hi)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)),
+                                _mm256_cvtpd_ps(hi), 1);
+}
+
+inline __m256 avx2Log2Accurate(__m256 x)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 inf  = _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000));
+
+    __m256d lo, hi;
+    avx2Log2Accurate(x, lo, hi);
+    __m256 log2 = avx2PackDoubles(lo, hi);
+
+    log2 = avx2Select(_mm256_cmp_ps(x, zero, _CMP_EQ_OQ), _mm256_sub_ps(zero, inf), log2);
+    log2 = avx2Select(_mm256_cmp_ps(x, inf, _CMP_EQ_OQ), inf, log2);
+    return _mm256_or_ps(log2, _mm256_cmp_ps(x, zero, _CMP_NGE_UQ));
+}
+
+inline __m256 avx2Exp2Accurate(__m256 x)
+{
+    return avx2PackDoubles(avx2Exp2Accurate(_mm256_cvtps_pd(_mm256_castps256_ps128(x))),
+                           avx2Exp2Accurate(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1))));
+}
+
+inline __m256 avx2PowerAccurate(__m256 x, __m256 exp)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 inf  = _mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000));
+
+    __m256d lo, hi;
+    avx2Log2Accurate(x, lo, hi);
+
+    lo = avx2Exp2Accurate(
+        _mm256_mul_pd(lo, _mm256_cvtps_pd(_mm256_castps256_ps128(exp))));
+    hi = avx2Exp2Accurate(
+        _mm256_mul_pd(hi, _mm256_cvtps_pd(_mm256_extractf128_ps(exp, 1))));
+    __m256 values = avx2PackDoubles(lo, hi);
+
+    // pow(Inf, exp) is Inf, 1 or 0 for a positive, null or negative exponent.
+    const __m256 infPow
+        = avx2Select(_mm256_cmp_ps(exp, zero, _CMP_GT_OQ), inf,
+                     _mm256_and_ps(_mm256_set1_ps(1.0f), _mm256_cmp_ps(exp, zero, _CMP_EQ_OQ)));
+    values = avx2Select(_mm256_cmp_ps(x, inf, _CMP_EQ_OQ), infPow, values);
+
+    // Handle values where base is smaller or equal than zero.
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, zero, _CMP_GT_OQ));
+}
+
+// The sets of log2, exp2 and power functions of the precision tiers, to be used as template
+// parameters of the AVX2 kernels.
+struct AVX2DraftMath
+{
+    static inline __m256 Log2(__m256 x) { return avx2Log2Draft(x); }
+    static inline __m256 Exp2(__m256 x) { return avx2Exp2Draft(x); }
+    static inline __m256 Power(__m256 x, __m256 exp) { return avx2PowerDraft(x, exp); }
+};
+
+struct AVX2FastMath
+{
+    static inline __m256 Log2(__m256 x) { return avx2Log2(x); }
+    static inline __m256 Exp2(__m256 x) { return avx2Exp2(x); }
+    static inline __m256 Power(__m256 x, __m256 exp) { return avx2Power(x, exp); }
+};
+
+struct AVX2AccurateMath
+{
+    static inline __m256 Log2(__m256 x) { return avx2Log2Accurate(x); }
+    static inline __m256 Exp2(__m256 x) { return avx2Exp2Accurate(x); }
+    static inline __m256 Power(__m256 x, __m256 exp) { return avx2PowerAccurate(x, exp); }
+};
+
+// Call the kernel K<Math>::Apply() where Math is the set of functions of the precision tier
+// (see MakeSSERenderer()). The accurate functions are used for LOG_EXP_POW_STD.
+template<template<typename> class K, typename... Args>
+inline void avx2ApplyPrecision(LogExpPowPrecision precision, Args &&... args)
+{
+    switch (precision)
+    {
+        case LOG_EXP_POW_DRAFT:
+            K<AVX2DraftMath>::Apply(std::forward<Args>(args)...);
+            return;
+        case LOG_EXP_POW_FAST:
+            K<AVX2FastMath>::Apply(std::forward<Args>(args)...);
+            return;
+        case LOG_EXP_POW_STD:
+        case LOG_EXP_POW_ACCURATE:
+            break;
+    }
+    K<AVX2AccurateMath>::Apply(std::forward<Args>(args)...);
+}
+
+// Keep the alpha channel of the RGBA pixels held in src.
+inline __m256 avx2KeepAlpha(const __m256 & pix, const __m256 & src)
+{
+    return _mm256_blend_ps(pix, src, 0x88);
+}
+
+// Duplicate the four RGBA values in the two halves of an AVX register.
+inline __m256 avx2LoadRGBA(const float * rgba)
+{
+    return _mm256_broadcast_ps((const __m128 *)rgba);
+}
+
+// Call func on packed RGBA float pixels, two pixels at a time, where func takes and returns
+// a __m256 holding two pixels. The in and out buffers could be the same buffer.
+template<typename Func>
+inline void avx2ApplyRGBA(const float * in, float * out, long numPixels, const Func & func)
+{
+    long idx = 0;
+    for (; idx + 2 <= numPixels; idx += 2)
+    {
+        _mm256_storeu_ps(out, func(_mm256_loadu_ps(in)));
+
+        in  += 8;
+        out += 8;
+    }
+
+    if (idx < numPixels)
+    {
+        // Last pixel only uses the lower half of the register.
+        const __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, 0, 0, 0, 0);
+        _mm256_maskstore_ps(out, mask, func(_mm256_maskload_ps(in, mask)));
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif // INCLUDED_OCIO_AVX2_H
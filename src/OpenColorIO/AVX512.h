@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_AVX512_H
+#define INCLUDED_OCIO_AVX512_H
+
+
+#ifdef USE_AVX512
+
+
+// This header must only be included by the translation units compiled for AVX-512
+// (i.e. the *_AVX512.cpp files), and their functions must only be called once
+// CPUInfo::hasAVX512() is checked. Only AVX-512 Foundation instructions are used.
+#if !defined(__AVX512F__)
+#if !defined(_MSC_VER)
+#error "AVX512.h requires the AVX-512 Foundation compiler flags."
+#endif
+#endif
+
+
+#include <immintrin.h>
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The unmasked forms of some intrinsics (e.g. _mm512_cvtepi32_ps) pass an undefined source to
+// their masked builtin, which GCC 12 reports as maybe uninitialized. The zero-masked forms with
+// all the lanes selected compute the same values without the warnings.
+static constexpr __mmask16 avx512AllLanes = (__mmask16)0xFFFF;
+
+// Bitwise operations on floats (i.e. _mm512_and_ps & co. need AVX-512 DQ).
+inline __m512 avx512And(const __m512 & a, const __m512 & b)
+{
+    return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+}
+
+inline __m512 avx512Or(const __m512 & a, const __m512 & b)
+{
+    return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)));
+}
+
+// Return the absolute values.
+inline __m512 avx512Abs(const __m512 x)
+{
+    return avx512And(x, _mm512_castsi512_ps(_mm512_set1_epi32(0x7fffffff)));
+}
+
+// Return the sign bits i.e. -0.0f for negative values (including -0, -NaN & -Inf) and 0 otherwise.
+inline __m512 avx512Sign(const __m512 x)
+{
+    return avx512And(x, _mm512_castsi512_ps(_mm512_set1_epi32((int)0x80000000)));
+}
+
+// log2 function in AVX-512, see avx2Log2().
+inline __m512 avx512Log2(__m512 x)
+{
+    const __m512i emask = _mm512_set1_epi32(0x7F800000);
+
+    const __m512 mantissa
+        = _mm512_castsi512_ps(
+            _mm512_or_si512(_mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(~0x7F800000)),
+                            _mm512_castps_si512(_mm512_set1_ps(1.0f))));
+
+    __m512 log2 = _mm512_set1_ps((float)+4.487361286440374006195e-2);
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm512_add_ps(_mm512_mul_ps(log2, mantissa), _mm512_set1_ps((float)-2.800364054395965731506));
+
+    const __m512i exponent
+        = _mm512_sub_epi32(
+            _mm512_maskz_srli_epi32(avx512AllLanes, _mm512_and_si512(_mm512_castps_si512(x), emask), 23),
+            _mm512_set1_epi32(127));
+
+    return _mm512_add_ps(log2, _mm512_maskz_cvtepi32_ps(avx512AllLanes, exponent));
+}
+
+// exp2 function in AVX-512, see avx2Exp2().
+inline __m512 avx512Exp2(__m512 x)
+{
+    // Same integer part as sseExp2() i.e. one is subtracted from all the negative values
+    // and from NaNs.
+    const __m512i trunc_x = _mm512_maskz_cvttps_epi32(avx512AllLanes, x);
+    const __m512i floor_x
+        = _mm512_mask_sub_epi32(trunc_x, _mm512_cmp_ps_mask(_mm512_setzero_ps(), x, _CMP_NLE_UQ),
+                                trunc_x, _mm512_set1_epi32(1));
+
+    const __m512 zf
+        = _mm512_castsi512_ps(
+            _mm512_maskz_slli_epi32(avx512AllLanes,
+                                    _mm512_add_epi32(floor_x, _mm512_set1_epi32(127)), 23));
+
+    const __m512 iexp = _mm512_maskz_cvtepi32_ps(avx512AllLanes, floor_x);
+    const __m512 fraction = _mm512_sub_ps(x, iexp);
+
+    __m512 mexp = _mm512_set1_ps((float)1.353416792833547468620e-2);
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), _mm512_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), _mm512_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), _mm512_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm512_add_ps(_mm512_mul_ps(mexp, fraction), _mm512_set1_ps((float)1.000002593370603213644));
+
+    __m512 exp2 = _mm512_mul_ps(zf, mexp);
+
+    // Handle underflow & overflow.
+    exp2 = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(iexp, _mm512_set1_ps(-126.0f), _CMP_LT_OQ),
+                                exp2, _mm512_setzero_ps());
+    exp2 = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(iexp, _mm512_set1_ps(127.0f), _CMP_GT_OQ),
+                                exp2, _mm512_castsi512_ps(_mm512_set1_epi32(0x7F800000)));
+
+    return exp2;
+}
+
+// Power function in AVX-512, see avx2Power().
+//
+// Results from base values smaller than zero are mapped to zero.
+inline __m512 avx512Power(__m512 x, __m512 exp)
+{
+    const __m512 values = avx512Exp2(_mm512_mul_ps(exp, avx512Log2(x)));
+
+    return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_GT_OQ), values);
+}
+
+// Call func on packed RGBA float pixels, four pixels at a time, where func takes and returns
+// a __m512 holding four pixels. The in and out buffers could be the same buffer.
+template<typename Func>
+inline void avx512ApplyRGBA(const float * in, float * out, long numPixels, const Func & func)
+{
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        _mm512_storeu_ps(out, func(_mm512_loadu_ps(in)));
+
+        in  += 16;
+        out += 16;
+    }
+
+    if (idx < numPixels)
+    {
+        // Up to three remaining pixels.
+        const __mmask16 mask = (__mmask16)((1u << (4 * (numPixels - idx))) - 1u);
+        _mm512_mask_storeu_ps(out, mask, func(_mm512_maskz_loadu_ps(mask, in)));
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX512
+
+#endif // INCLUDED_OCIO_AVX512_H
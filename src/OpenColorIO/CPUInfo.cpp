@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define OCIO_ARCH_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+#ifdef OCIO_ARCH_X86
+
+// Execute the CPUID instruction i.e. regs = { eax, ebx, ecx, edx }.
+void CPUID(unsigned leaf, unsigned subleaf, unsigned regs[4])
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    for (int idx = 0; idx < 4; ++idx)
+    {
+        regs[idx] = (unsigned)info[idx];
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// Read the XCR0 register i.e. the register states the OS saves on context switches.
+unsigned long long XGETBV()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned eax = 0, edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+
+#endif // OCIO_ARCH_X86
+
+} // anon
+
+const CPUInfo & CPUInfo::Instance()
+{
+    static const CPUInfo info;
+    return info;
+}
+
+CPUInfo::CPUInfo()
+{
+    std::memset(m_vendor, 0, sizeof(m_vendor));
+
+#ifdef OCIO_ARCH_X86
+    unsigned regs[4];
+
+    CPUID(0, 0, regs);
+    const unsigned maxLeaf = regs[0];
+
+    // The vendor string is in ebx, edx & ecx.
+    std::memcpy(m_vendor,     &regs[1], 4);
+    std::memcpy(m_vendor + 4, &regs[3], 4);
+    std::memcpy(m_vendor + 8, &regs[2], 4);
+
+    if (maxLeaf < 7)
+    {
+        return;
+    }
+
+    CPUID(1, 0, regs);
+    const bool hasFMA     = (regs[2] & (1u << 12)) != 0;
+    const bool hasOSXSAVE = (regs[2] & (1u << 27)) != 0;
+    const bool hasAVX     = (regs[2] & (1u << 28)) != 0;
+    const bool hasF16C    = (regs[2] & (1u << 29)) != 0;
+
+    if (!hasOSXSAVE || !hasAVX)
+    {
+        return;
+    }
+
+    // The instructions are only usable if the OS saves the corresponding registers.
+    const unsigned long long xcr0 = XGETBV();
+    const bool hasYMMState = (xcr0 & 0x06) == 0x06; // XMM & YMM.
+    const bool hasZMMState = (xcr0 & 0xe6) == 0xe6; // XMM, YMM, opmask & ZMM.
+
+    CPUID(7, 0, regs);
+    const bool hasAVX2    = (regs[1] & (1u << 5))  != 0;
+    const bool hasAVX512F = (regs[1] & (1u << 16)) != 0;
+
+    m_hasAVX2   = hasYMMState && hasFMA && hasF16C && hasAVX2;
+    m_hasAVX512 = m_hasAVX2 && hasZMMState && hasAVX512F;
+#endif
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_CPUINFO_H
+#define INCLUDED_OCIO_CPUINFO_H
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Instruction sets of the running CPU which are usable by the library. The AVX2 & AVX-512
+// kernels are compiled in dedicated translation units (see *_AVX2.cpp & *_AVX512.cpp) so the
+// renderer factories must check the CPU before selecting them.
+class CPUInfo
+{
+public:
+    // The CPU is only queried once.
+    static const CPUInfo & Instance();
+
+    // AVX2, FMA & F16C instructions, with the 256-bit registers enabled by the OS.
+    bool hasAVX2() const noexcept { return m_hasAVX2; }
+    // AVX-512 Foundation & FMA instructions, with the 512-bit registers enabled by the OS.
+    bool hasAVX512() const noexcept { return m_hasAVX512; }
+
+    // Vendor string (e.g. "GenuineIntel") or empty if unknown.
+    const char * getVendor() const noexcept { return m_vendor; }
+
+private:
+    CPUInfo();
+
+    bool m_hasAVX2   = false;
+    bool m_hasAVX512 = false;
+    char m_vendor[13];
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_CPUINFO_H
@@ -1,22 +1,92 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <string.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "CPUProcessor.h"
+#include "ImagePacking_AVX2.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
+#include "ops/matrix/MatrixOpCPU.h"
 #include "ops/range/RangeOpCPU.h"
 #include "ScanlineHelper.h"
+#include "ThreadPool.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+// 64 packed RGBA F32 pixels i.e. 1 KB per buffer, which leaves most of the L1 data cache to the ops.
+std::atomic<unsigned> g_blockSize{ 64 };
+}
+
+void SetCPUProcessorBlockSize(unsigned numPixels)
+{
+    g_blockSize = numPixels;
+}
+
+unsigned GetCPUProcessorBlockSize()
+{
+    return g_blockSize;
+}
+
+#ifdef USE_AVX2
+// AVX2 implementations of the bit-depth conversions from or to F32, which return false when
+// there is none.
+
+template<typename InType, typename OutType>
+inline bool ConvertAVX2(const InType *, OutType *, long, float, float)
+{
+    return false;
+}
+
+inline bool ConvertAVX2(const uint8_t * in, float * out, long numValues, float scale, float)
+{
+    ConvertToFloat_AVX2(in, out, numValues, scale);
+    return true;
+}
+
+inline bool ConvertAVX2(const uint16_t * in, float * out, long numValues, float scale, float)
+{
+    ConvertToFloat_AVX2(in, out, numValues, scale);
+    return true;
+}
+
+inline bool ConvertAVX2(const half * in, float * out, long numValues, float, float)
+{
+    ConvertHalfToFloat_AVX2(reinterpret_cast<const uint16_t *>(in), out, numValues);
+    return true;
+}
+
+inline bool ConvertAVX2(const float * in, uint8_t * out, long numValues, float scale, float maxValue)
+{
+    ConvertFromFloat_AVX2(in, out, numValues, scale, maxValue);
+    return true;
+}
+
+inline bool ConvertAVX2(const float * in, uint16_t * out, long numValues, float scale, float maxValue)
+{
+    ConvertFromFloat_AVX2(in, out, numValues, scale, maxValue);
+    return true;
+}
+
+inline bool ConvertAVX2(const float * in, half * out, long numValues, float, float)
+{
+    ConvertFloatToHalf_AVX2(in, reinterpret_cast<uint16_t *>(out), numValues);
+    return true;
+}
+#endif
+
 template<BitDepth inBD, BitDepth outBD>
 class BitDepthCast : public OpCPU
 {
@@ -32,6 +102,14 @@ public:
         const InType * in = reinterpret_cast<const InType*>(inImg);
         OutType * out = reinterpret_cast<OutType*>(outImg);
 
+#ifdef USE_AVX2
+        if(m_useAVX2
+            && ConvertAVX2(in, out, 4 * numPixels, m_scale, float(BitDepthInfo<outBD>::maxValue)))
+        {
+            return;
+        }
+#endif
+
         for(long pxl=0; pxl<numPixels; ++pxl)
         {
             out[0] = Converter<outBD>::CastValue(in[0] * m_scale);
@@ -47,6 +125,9 @@ public:
 protected:
     const float m_scale = float(BitDepthInfo<outBD>::maxValue)
                             / float(BitDepthInfo<inBD>::maxValue);
+#ifdef USE_AVX2
+    const bool m_useAVX2 = CPUInfo::Instance().hasAVX2();
+#endif
 };
 
 template<>
@@ -63,6 +144,17 @@ public:
             memcpy(outImg, inImg, 4*numPixels*sizeof(float));
         }
     }
+
+    void applyPlanar(const float * const * in, float * const * out, long numPixels) const override
+    {
+        for(int chan=0; chan<4; ++chan)
+        {
+            if(out[chan] && in[chan]!=out[chan])
+            {
+                memcpy(out[chan], in[chan], numPixels*sizeof(float));
+            }
+        }
+    }
 };
 
 ConstOpCPURcPtr CreateGenericBitDepthHelper(BitDepth in, BitDepth out)
@@ -119,6 +211,53 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+// Get the precision tier of the log, exp & pow evaluations.
+LogExpPowPrecision GetLogExpPowPrecision(OptimizationFlags oFlags)
+{
+    // The draft and accurate tiers are mutually exclusive (e.g. both are set by
+    // OPTIMIZATION_ALL), so the fast tier is the compromise when both are requested.
+    if (HasFlag(oFlags, OPTIMIZATION_DRAFT_LOG_EXP_POW)
+        && HasFlag(oFlags, OPTIMIZATION_ACCURATE_LOG_EXP_POW))
+    {
+        return LOG_EXP_POW_FAST;
+    }
+    else if (HasFlag(oFlags, OPTIMIZATION_DRAFT_LOG_EXP_POW))
+    {
+        return LOG_EXP_POW_DRAFT;
+    }
+    else if (HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW))
+    {
+        return LOG_EXP_POW_FAST;
+    }
+    else if (HasFlag(oFlags, OPTIMIZATION_ACCURATE_LOG_EXP_POW))
+    {
+        return LOG_EXP_POW_ACCURATE;
+    }
+
+    return LOG_EXP_POW_STD;
+}
+
+// Get the CPU op, where the LUT ops could store their values as half values.
+ConstOpCPURcPtr GetCPUOp(const ConstOpRcPtr & op, OptimizationFlags oFlags)
+{
+    const bool halfLutStorage = HasFlag(oFlags, OPTIMIZATION_LUT_HALF_STORAGE);
+    const bool refineLutInv   = HasFlag(oFlags, OPTIMIZATION_LUT_INV_REFINE);
+
+    ConstOpDataRcPtr opData = op->data();
+    if (halfLutStorage && opData->getType() == OpData::Lut1DType)
+    {
+        ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
+        return GetLut1DRenderer(lut, BIT_DEPTH_F32, BIT_DEPTH_F32, true);
+    }
+    else if ((halfLutStorage || refineLutInv) && opData->getType() == OpData::Lut3DType)
+    {
+        ConstLut3DOpDataRcPtr lut = DynamicPtrCast<const Lut3DOpData>(opData);
+        return GetLut3DRenderer(lut, halfLutStorage, refineLutInv);
+    }
+
+    return op->getCPUOp(GetLogExpPowPrecision(oFlags));
+}
+
 void CreateCPUEngine(const OpRcPtrVec & ops, 
                      BitDepth in, 
                      BitDepth out,
@@ -130,11 +269,42 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
                      // The bit-depth 'cast' or the last CPU Op.
                      ConstOpCPURcPtr & outBitDepthOp)
 {
-    const size_t maxOps = ops.size();
-    const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
-    for(size_t idx=0; idx<maxOps; ++idx)
+    // Unless all the optimizations are disabled, a Range following a Matrix is applied by the
+    // Matrix renderer, which saves a pass over the pixels without changing the results.
+    std::vector<ConstOpRcPtr> engineOps;
+    ConstOpCPURcPtrVec fusedOps;
+    for (size_t idx = 0; idx < ops.size(); ++idx)
     {
         ConstOpRcPtr op = ops[idx];
+        ConstOpRcPtr next = idx + 1 < ops.size() ? ops[idx + 1] : ConstOpRcPtr();
+        engineOps.push_back(op);
+
+        if (oFlags != OPTIMIZATION_NONE && next
+            && op->data()->getType() == OpData::MatrixType
+            && next->data()->getType() == OpData::RangeType)
+        {
+            ConstMatrixOpDataRcPtr mat = DynamicPtrCast<const MatrixOpData>(op->data());
+            ConstRangeOpDataRcPtr range = DynamicPtrCast<const RangeOpData>(next->data());
+
+            fusedOps.push_back(GetMatrixRenderer(mat, range));
+            ++idx;
+        }
+        else
+        {
+            fusedOps.push_back(ConstOpCPURcPtr());
+        }
+    }
+
+    auto getCPUOp = [&engineOps, &fusedOps, oFlags](size_t idx)
+    {
+        return fusedOps[idx] ? fusedOps[idx] : GetCPUOp(engineOps[idx], oFlags);
+    };
+
+    const size_t maxOps = engineOps.size();
+    const bool halfLutStorage = HasFlag(oFlags, OPTIMIZATION_LUT_HALF_STORAGE);
+    for(size_t idx=0; idx<maxOps; ++idx)
+    {
+        ConstOpRcPtr op = engineOps[idx];
         ConstOpDataRcPtr opData = op->data();
 
         if(idx==0)
@@ -142,16 +312,16 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             if(opData->getType()==OpData::Lut1DType)
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
-                inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32);
+                inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32, halfLutStorage);
             }
             else if(in==BIT_DEPTH_F32)
             {
-                inBitDepthOp = op->getCPUOp(fastLogExpPow);
+                inBitDepthOp = getCPUOp(idx);
             }
             else
             {
                 inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOps.push_back(getCPUOp(idx));
             }
 
             if(maxOps==1)
@@ -164,28 +334,29 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
             if(opData->getType()==OpData::Lut1DType)
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
-                outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out);
+                outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out, halfLutStorage);
             }
             else if(out==BIT_DEPTH_F32)
             {
-                outBitDepthOp = op->getCPUOp(fastLogExpPow);
+                outBitDepthOp = getCPUOp(idx);
             }
             else
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOps.push_back(getCPUOp(idx));
             }
         }
         else
         {
-            cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+            cpuOps.push_back(getCPUOp(idx));
         }
     }
 }
 
 
 ScanlineHelper * CreateScanlineHelper(BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
-                                      BitDepth out, const ConstOpCPURcPtr & outBitDepthOp)
+                                      BitDepth out, const ConstOpCPURcPtr & outBitDepthOp,
+                                      long blockSize)
 {
 
 #define ADD_OUT_BIT_DEPTH(in, out)                    \
@@ -193,7 +364,8 @@ case out:                                             \
 {                                                     \
     return new GenericScanlineHelper<BitDepthInfo<in>::Type,                      \
                                      BitDepthInfo<out>::Type>(in, inBitDepthOp,   \
-                                                              out, outBitDepthOp);\
+                                                              out, outBitDepthOp, \
+                                                              blockSize);         \
     break;                                            \
 }
 
@@ -377,22 +549,101 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
-void CPUProcessor::Impl::apply(ImageDesc & imgDesc) const
-{   
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+namespace
+{
 
-    // Prepare the processing.
-    scanlineBuilder->init(imgDesc);
+// Each thread reuses its scanline helpers (i.e. one per bit-depth combination) so the
+// steady-state processing does not allocate memory, the intermediate buffers only growing
+// when needed.
+class ThreadScanlineHelper
+{
+public:
+    ThreadScanlineHelper(BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
+                         BitDepth out, const ConstOpCPURcPtr & outBitDepthOp)
+    {
+        static constexpr int NUM_BIT_DEPTHS = BIT_DEPTH_F32 + 1;
 
+        thread_local std::unique_ptr<ScanlineHelper> helpers[NUM_BIT_DEPTHS][NUM_BIT_DEPTHS];
+        thread_local bool inUse = false;
+
+        const long blockSize = GetCPUProcessorBlockSize();
+
+        if(inUse || in<0 || in>=NUM_BIT_DEPTHS || out<0 || out>=NUM_BIT_DEPTHS)
+        {
+            // A nested processing (or invalid bit-depths) uses its own helper.
+            m_ownedHelper.reset(
+                CreateScanlineHelper(in, inBitDepthOp, out, outBitDepthOp, blockSize));
+            m_helper = m_ownedHelper.get();
+            return;
+        }
+
+        std::unique_ptr<ScanlineHelper> & helper = helpers[in][out];
+        if(!helper)
+        {
+            helper.reset(CreateScanlineHelper(in, inBitDepthOp, out, outBitDepthOp, blockSize));
+        }
+        else
+        {
+            helper->reset(inBitDepthOp, outBitDepthOp, blockSize);
+        }
+
+        m_helper = helper.get();
+        m_inUse  = &inUse;
+        inUse    = true;
+    }
+
+    ThreadScanlineHelper(const ThreadScanlineHelper &) = delete;
+    ThreadScanlineHelper & operator=(const ThreadScanlineHelper &) = delete;
+
+    ~ThreadScanlineHelper()
+    {
+        if(m_inUse)
+        {
+            m_helper->release();
+            *m_inUse = false;
+        }
+    }
+
+    ScanlineHelper & operator*() const { return *m_helper; }
+    ScanlineHelper * operator->() const { return m_helper; }
+
+private:
+    ScanlineHelper * m_helper = nullptr;
+    std::unique_ptr<ScanlineHelper> m_ownedHelper;
+    bool * m_inUse = nullptr;
+};
+
+} // anon
+
+void CPUProcessor::Impl::applyScanlines(ScanlineHelper & scanlineBuilder) const
+{
     float * rgbaBuffer = nullptr;
     long numPixels = 0;
 
+    if(scanlineBuilder.isPlanar())
+    {
+        float * planes[4] = { nullptr, nullptr, nullptr, nullptr };
+
+        while(true)
+        {
+            scanlineBuilder.prepPlanarScanline(planes, numPixels);
+            if(numPixels == 0) break;
+
+            const size_t numOps = m_cpuOps.size();
+            for(size_t i = 0; i<numOps; ++i)
+            {
+                m_cpuOps[i]->applyPlanar(planes, planes, numPixels);
+            }
+
+            scanlineBuilder.finishPlanarScanline();
+        }
+
+        return;
+    }
+
     while(true)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
+        scanlineBuilder.prepRGBAScanline(&rgbaBuffer, numPixels);
         if(numPixels == 0) break;
 
         const size_t numOps = m_cpuOps.size();
@@ -401,68 +652,281 @@ void CPUProcessor::Impl::apply(ImageDesc & imgDesc) const
             m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
         }
 
-        scanlineBuilder->finishRGBAScanline();
+        scanlineBuilder.finishRGBAScanline();
     }
 }
 
+void CPUProcessor::Impl::applyBands(const ImageDesc & srcImgDesc, const ImageROI * srcROI,
+                                    ImageDesc * dstImgDesc, const ImageROI * dstROI,
+                                    unsigned numThreads) const
+{
+    // Note: A null dstImgDesc means an in-place processing of srcImgDesc.
+
+    const long height = srcROI ? srcROI->m_height : srcImgDesc.getHeight();
+    numThreads = GetNumThreads(numThreads);
+
+    // Use a few bands per thread to balance the load when some lines are more expensive
+    // to process than others (e.g. pixel values triggering different code paths).
+    static constexpr long BANDS_PER_THREAD = 4;
+    const long numBands = std::max(1L, std::min(height, long(numThreads) * BANDS_PER_THREAD));
+
+    ParallelFor(numThreads, numBands, [&](long band)
+    {
+        // Each thread has its own scanline helper i.e. its own intermediate buffers.
+        ThreadScanlineHelper scanlineBuilder(m_inBitDepth, m_inBitDepthOp,
+                                             m_outBitDepth, m_outBitDepthOp);
+
+        if(dstImgDesc && srcROI)
+        {
+            scanlineBuilder->init(srcImgDesc, *srcROI, *dstImgDesc, *dstROI);
+        }
+        else if(dstImgDesc)
+        {
+            scanlineBuilder->init(srcImgDesc, *dstImgDesc);
+        }
+        else if(srcROI)
+        {
+            scanlineBuilder->init(srcImgDesc, *srcROI);
+        }
+        else
+        {
+            scanlineBuilder->init(srcImgDesc);
+        }
+
+        scanlineBuilder->setLineRange(height * band / numBands, height * (band + 1) / numBands);
+
+        applyScanlines(*scanlineBuilder);
+    });
+}
+
+void CPUProcessor::Impl::apply(ImageDesc & imgDesc) const
+{   
+    // Get the ScanlineHelper for this thread.
+    ThreadScanlineHelper scanlineBuilder(m_inBitDepth, m_inBitDepthOp,
+                                         m_outBitDepth, m_outBitDepthOp);
+
+    // Prepare the processing.
+    scanlineBuilder->init(imgDesc);
+
+    applyScanlines(*scanlineBuilder);
+}
+
 void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
 {
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+    // Get the ScanlineHelper for this thread.
+    ThreadScanlineHelper scanlineBuilder(m_inBitDepth, m_inBitDepthOp,
+                                         m_outBitDepth, m_outBitDepthOp);
 
     // Prepare the processing.
     scanlineBuilder->init(srcImgDesc, dstImgDesc);
 
-    float * rgbaBuffer = nullptr;
-    long numPixels = 0;
+    applyScanlines(*scanlineBuilder);
+}
 
-    while(true)
+void CPUProcessor::Impl::apply(ImageDesc & imgDesc, unsigned numThreads) const
+{
+    applyBands(imgDesc, nullptr, nullptr, nullptr, numThreads);
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc,
+                               unsigned numThreads) const
+{
+    applyBands(srcImgDesc, nullptr, &dstImgDesc, nullptr, numThreads);
+}
+
+void CPUProcessor::Impl::apply(ImageDesc & imgDesc, const ImageROI & roi, unsigned numThreads) const
+{
+    applyBands(imgDesc, &roi, nullptr, nullptr, numThreads);
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, const ImageROI & srcROI,
+                               ImageDesc & dstImgDesc, const ImageROI & dstROI,
+                               unsigned numThreads) const
+{
+    applyBands(srcImgDesc, &srcROI, &dstImgDesc, &dstROI, numThreads);
+}
+
+namespace
+{
+
+// Number of images waiting for their asynchronous processing beyond which the submission
+// blocks i.e. it bounds the memory held by the queued images.
+constexpr size_t ASYNC_QUEUE_CAPACITY = 2;
+
+// Copy of an image description i.e. the pixels are not copied. It allows the asynchronous
+// processing to outlive the image description instance of the caller.
+class ImageDescCopy : public ImageDesc
+{
+public:
+    explicit ImageDescCopy(const ImageDesc & img)
+        :   m_rData(img.getRData())
+        ,   m_gData(img.getGData())
+        ,   m_bData(img.getBData())
+        ,   m_aData(img.getAData())
+        ,   m_bitDepth(img.getBitDepth())
+        ,   m_width(img.getWidth())
+        ,   m_height(img.getHeight())
+        ,   m_xStrideBytes(img.getXStrideBytes())
+        ,   m_yStrideBytes(img.getYStrideBytes())
+        ,   m_isRGBAPacked(img.isRGBAPacked())
+        ,   m_isFloat(img.isFloat())
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
-        if(numPixels == 0) break;
+    }
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
+    void * getRData() const override { return m_rData; }
+    void * getGData() const override { return m_gData; }
+    void * getBData() const override { return m_bData; }
+    void * getAData() const override { return m_aData; }
+
+    BitDepth getBitDepth() const override { return m_bitDepth; }
+
+    long getWidth() const override { return m_width; }
+    long getHeight() const override { return m_height; }
+
+    ptrdiff_t getXStrideBytes() const override { return m_xStrideBytes; }
+    ptrdiff_t getYStrideBytes() const override { return m_yStrideBytes; }
+
+    bool isRGBAPacked() const override { return m_isRGBAPacked; }
+    bool isFloat() const override { return m_isFloat; }
+
+private:
+    void * const    m_rData;
+    void * const    m_gData;
+    void * const    m_bData;
+    void * const    m_aData;
+    const BitDepth  m_bitDepth;
+    const long      m_width;
+    const long      m_height;
+    const ptrdiff_t m_xStrideBytes;
+    const ptrdiff_t m_yStrideBytes;
+    const bool      m_isRGBAPacked;
+    const bool      m_isFloat;
+};
+
+} // anon
+
+std::future<void> CPUProcessor::Impl::queueApply(const ImageDesc & srcImgDesc,
+                                                 ImageDesc * dstImgDesc,
+                                                 unsigned numThreads) const
+{
+    auto src = std::make_shared<ImageDescCopy>(srcImgDesc);
+    auto dst = dstImgDesc ? std::make_shared<ImageDescCopy>(*dstImgDesc)
+                          : std::shared_ptr<ImageDescCopy>();
+
+    // The promise is shared as the task must be copyable.
+    auto promise = std::make_shared<std::promise<void>>();
+    std::future<void> future = promise->get_future();
+
+    TaskQueue * queue = nullptr;
+    {
+        AutoMutex lock(m_asyncMutex);
+        if (!m_asyncQueue)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            m_asyncQueue.reset(new TaskQueue(ASYNC_QUEUE_CAPACITY));
         }
-
-        scanlineBuilder->finishRGBAScanline();
+        queue = m_asyncQueue.get();
     }
+
+    // Note that the push could block so it is done outside of the lock.
+    queue->push([this, src, dst, promise, numThreads]()
+    {
+        try
+        {
+            if (dst)
+            {
+                apply(*src, *dst, numThreads);
+            }
+            else
+            {
+                apply(*src, numThreads);
+            }
+            promise->set_value();
+        }
+        catch (...)
+        {
+            promise->set_exception(std::current_exception());
+        }
+    });
+
+    return future;
 }
 
-void CPUProcessor::Impl::applyRGB(float * pixel) const
+std::future<void> CPUProcessor::Impl::applyAsync(ImageDesc & imgDesc, unsigned numThreads) const
 {
-    float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
+    return queueApply(imgDesc, nullptr, numThreads);
+}
 
-    m_inBitDepthOp->apply(v, v, 1);
+std::future<void> CPUProcessor::Impl::applyAsync(const ImageDesc & srcImgDesc,
+                                                 ImageDesc & dstImgDesc,
+                                                 unsigned numThreads) const
+{
+    return queueApply(srcImgDesc, &dstImgDesc, numThreads);
+}
+
+void CPUProcessor::Impl::applyOps(float * rgba, long numPixels) const
+{
+    m_inBitDepthOp->apply(rgba, rgba, numPixels);
 
     const size_t numOps = m_cpuOps.size();
     for(size_t i = 0; i<numOps; ++i)
     {
-        m_cpuOps[i]->apply(pixel, pixel, 1);
+        m_cpuOps[i]->apply(rgba, rgba, numPixels);
     }
 
-    m_outBitDepthOp->apply(v, v, 1);
+    m_outBitDepthOp->apply(rgba, rgba, numPixels);
+}
 
-    pixel[0] = v[0];
-    pixel[1] = v[1];
-    pixel[2] = v[2];
+void CPUProcessor::Impl::applyRGB(float * pixel) const
+{
+    applyRGBs(pixel, 1);
 }
 
 void CPUProcessor::Impl::applyRGBA(float * pixel) const
 {
-    m_inBitDepthOp->apply(pixel, pixel, 1);
+    applyOps(pixel, 1);
+}
 
-    const size_t numOps = m_cpuOps.size();
-    for(size_t i = 0; i<numOps; ++i)
+void CPUProcessor::Impl::applyRGBs(float * pixels, size_t numPixels) const
+{
+    // The RGB pixels are processed in blocks of RGBA pixels (i.e. with a zero alpha)
+    // small enough to stay in the L1 cache.
+    static constexpr size_t BLOCK_PIXELS = 256;
+    float rgba[4 * BLOCK_PIXELS];
+
+    for(size_t first = 0; first < numPixels; first += BLOCK_PIXELS)
     {
-        m_cpuOps[i]->apply(pixel, pixel, 1);
+        const size_t num = std::min(BLOCK_PIXELS, numPixels - first);
+        float * rgb = pixels + 3 * first;
+
+        for(size_t idx = 0; idx < num; ++idx)
+        {
+            rgba[4 * idx + 0] = rgb[3 * idx + 0];
+            rgba[4 * idx + 1] = rgb[3 * idx + 1];
+            rgba[4 * idx + 2] = rgb[3 * idx + 2];
+            rgba[4 * idx + 3] = 0.0f;
+        }
+
+        applyOps(rgba, long(num));
+
+        for(size_t idx = 0; idx < num; ++idx)
+        {
+            rgb[3 * idx + 0] = rgba[4 * idx + 0];
+            rgb[3 * idx + 1] = rgba[4 * idx + 1];
+            rgb[3 * idx + 2] = rgba[4 * idx + 2];
+        }
     }
+}
+
+void CPUProcessor::Impl::applyRGBAs(float * pixels, size_t numPixels) const
+{
+    // Same blocks of pixels as the image processing.
+    const size_t blockSize = GetCPUProcessorBlockSize();
+    const size_t blockPixels = blockSize > 0 ? blockSize : numPixels;
 
-    m_outBitDepthOp->apply(pixel, pixel, 1);
+    for(size_t first = 0; first < numPixels; first += blockPixels)
+    {
+        applyOps(pixels + 4 * first, long(std::min(blockPixels, numPixels - first)));
+    }
 }
 
 
@@ -534,6 +998,40 @@ void CPUProcessor::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) c
     getImpl()->apply(srcImgDesc, dstImgDesc);
 }
 
+void CPUProcessor::apply(ImageDesc & imgDesc, unsigned numThreads) const
+{
+    getImpl()->apply(imgDesc, numThreads);
+}
+
+void CPUProcessor::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc,
+                         unsigned numThreads) const
+{
+    getImpl()->apply(srcImgDesc, dstImgDesc, numThreads);
+}
+
+void CPUProcessor::apply(ImageDesc & imgDesc, const ImageROI & roi, unsigned numThreads) const
+{
+    getImpl()->apply(imgDesc, roi, numThreads);
+}
+
+void CPUProcessor::apply(const ImageDesc & srcImgDesc, const ImageROI & srcROI,
+                         ImageDesc & dstImgDesc, const ImageROI & dstROI,
+                         unsigned numThreads) const
+{
+    getImpl()->apply(srcImgDesc, srcROI, dstImgDesc, dstROI, numThreads);
+}
+
+std::future<void> CPUProcessor::applyAsync(ImageDesc & imgDesc, unsigned numThreads) const
+{
+    return getImpl()->applyAsync(imgDesc, numThreads);
+}
+
+std::future<void> CPUProcessor::applyAsync(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc,
+                                           unsigned numThreads) const
+{
+    return getImpl()->applyAsync(srcImgDesc, dstImgDesc, numThreads);
+}
+
 void CPUProcessor::applyRGB(float * pixel) const
 {
     getImpl()->applyRGB(pixel);
@@ -544,5 +1042,15 @@ void CPUProcessor::applyRGBA(float * pixel) const
     getImpl()->applyRGBA(pixel);
 }
 
+void CPUProcessor::applyRGBs(float * pixels, size_t numPixels) const
+{
+    getImpl()->applyRGBs(pixels, numPixels);
+}
+
+void CPUProcessor::applyRGBAs(float * pixels, size_t numPixels) const
+{
+    getImpl()->applyRGBAs(pixels, numPixels);
+}
+
 } // namespace OCIO_NAMESPACE
 
@@ -1,75 +1,115 @@
-// SPDX-License-Identifier: BSD-3-Clause
-// Copyright Contributors to the OpenColorIO Project.
-
-
-#ifndef INCLUDED_OCIO_CPUPROCESSOR_H
-#define INCLUDED_OCIO_CPUPROCESSOR_H
-
-
-#include <OpenColorIO/OpenColorIO.h>
-
-#include "Op.h"
-
-
-namespace OCIO_NAMESPACE
-{
-
-class ScanlineHelper;
-
-class CPUProcessor::Impl
-{
-public:
-    Impl() = default;
-    Impl(const Impl &) = delete;
-    Impl& operator=(const Impl &) = delete;
-
-    ~Impl() = default;
-
-    // Note: The in and out bit-depths must be equal for isNoOp to be true.
-    bool isNoOp() const noexcept { return m_isNoOp; }
-
-    // Note: Equivalent to isNoOp from the underlying Processor, 
-    // i.e., it ignores in/out bit-depth differences.
-    bool isIdentity() const noexcept { return m_isIdentity; }
-
-    bool hasChannelCrosstalk() const noexcept { return m_hasChannelCrosstalk; }
-
-    const char * getCacheID() const noexcept { return m_cacheID.c_str(); }
-
-    BitDepth getInputBitDepth() const noexcept { return m_inBitDepth; }
-    BitDepth getOutputBitDepth() const noexcept { return m_outBitDepth; }
-
-    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
-
-    void apply(ImageDesc & imgDesc) const;
-    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
-
-    // Note that the method only accepts one packed RGB and 32-bit float pixel.
-    void applyRGB(float * pixel) const;
-    // Note that the method only accepts one packed RGBA and 32-bit float pixel.
-    void applyRGBA(float * pixel) const;
-
-    ////////////////////////////////////////////
-    //
-    // Functions not exposed to the OCIO public API.
-
-    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
-
-private:
-    ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
-    ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
-                                       // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
-    ConstOpCPURcPtr    m_outBitDepthOp;// Converts from F32 to out. It could be done by the last op.
-
-    BitDepth           m_inBitDepth = BIT_DEPTH_F32;
-    BitDepth           m_outBitDepth = BIT_DEPTH_F32;
-    bool               m_isNoOp = false;
-    bool               m_isIdentity = false;
-    bool               m_hasChannelCrosstalk = true;
-    std::string        m_cacheID;
-    Mutex              m_mutex;
-};
-
-} // namespace OCIO_NAMESPACE
-
-#endif // INCLUDED_OCIO_CPUPROCESSOR_H
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_CPUPROCESSOR_H
+#define INCLUDED_OCIO_CPUPROCESSOR_H
+
+
+#include <memory>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+#include "ThreadPool.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+class ScanlineHelper;
+
+class CPUProcessor::Impl
+{
+public:
+    Impl() = default;
+    Impl(const Impl &) = delete;
+    Impl& operator=(const Impl &) = delete;
+
+    ~Impl() = default;
+
+    // Note: The in and out bit-depths must be equal for isNoOp to be true.
+    bool isNoOp() const noexcept { return m_isNoOp; }
+
+    // Note: Equivalent to isNoOp from the underlying Processor, 
+    // i.e., it ignores in/out bit-depth differences.
+    bool isIdentity() const noexcept { return m_isIdentity; }
+
+    bool hasChannelCrosstalk() const noexcept { return m_hasChannelCrosstalk; }
+
+    const char * getCacheID() const noexcept { return m_cacheID.c_str(); }
+
+    BitDepth getInputBitDepth() const noexcept { return m_inBitDepth; }
+    BitDepth getOutputBitDepth() const noexcept { return m_outBitDepth; }
+
+    DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
+
+    void apply(ImageDesc & imgDesc) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
+
+    void apply(ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
+    void apply(ImageDesc & imgDesc, const ImageROI & roi, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, const ImageROI & srcROI,
+               ImageDesc & dstImgDesc, const ImageROI & dstROI,
+               unsigned numThreads) const;
+
+    std::future<void> applyAsync(ImageDesc & imgDesc, unsigned numThreads) const;
+    std::future<void> applyAsync(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc,
+                                 unsigned numThreads) const;
+
+    // Note that the method only accepts one packed RGB and 32-bit float pixel.
+    void applyRGB(float * pixel) const;
+    // Note that the method only accepts one packed RGBA and 32-bit float pixel.
+    void applyRGBA(float * pixel) const;
+
+    // Note that the methods only accept packed RGB or RGBA and 32-bit float pixels.
+    void applyRGBs(float * pixels, size_t numPixels) const;
+    void applyRGBAs(float * pixels, size_t numPixels) const;
+
+    ////////////////////////////////////////////
+    //
+    // Functions not exposed to the OCIO public API.
+
+    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
+
+private:
+    // Process all the lines of a scanline helper already initialized.
+    void applyScanlines(ScanlineHelper & scanlineBuilder) const;
+
+    // Process packed RGBA F32 pixels in-place.
+    void applyOps(float * rgba, long numPixels) const;
+
+    // Queue the processing of an image where a null destination means an in-place processing.
+    std::future<void> queueApply(const ImageDesc & srcImgDesc, ImageDesc * dstImgDesc,
+                                 unsigned numThreads) const;
+
+    // Process the image in bands of lines using several threads, where a null region of
+    // interest means the complete image.
+    void applyBands(const ImageDesc & srcImgDesc, const ImageROI * srcROI,
+                    ImageDesc * dstImgDesc, const ImageROI * dstROI,
+                    unsigned numThreads) const;
+
+    ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
+    ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
+                                       // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
+    ConstOpCPURcPtr    m_outBitDepthOp;// Converts from F32 to out. It could be done by the last op.
+
+    BitDepth           m_inBitDepth = BIT_DEPTH_F32;
+    BitDepth           m_outBitDepth = BIT_DEPTH_F32;
+    bool               m_isNoOp = false;
+    bool               m_isIdentity = false;
+    bool               m_hasChannelCrosstalk = true;
+    std::string        m_cacheID;
+    Mutex              m_mutex;
+
+    // Lazily created by the first asynchronous apply. It must be the last member as its
+    // destruction waits for the queued images which need all the other members.
+    mutable Mutex                      m_asyncMutex;
+    mutable std::unique_ptr<TaskQueue> m_asyncQueue;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_CPUPROCESSOR_H
@@ -6,6 +6,8 @@
 
 #include "Caching.h"
 #include "transforms/CDLTransform.h"
+#include "ops/lut3d/Lut3DOpCPU.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "PathUtils.h"
 #include "transforms/FileTransform.h"
 
@@ -26,5 +28,28 @@ void ClearAllCaches()
     ClearPathCaches();
     ClearFileTransformCaches();
     ClearCDLTransformFileCache();
+    ClearLut3DRendererCaches();
+    ClearLut3DComposeCache();
+}
+
+void ResetGlobalCacheStats()
+{
+    ResetPathCacheStats();
+    ResetFileTransformCacheStats();
+    ResetLut3DRendererCacheStats();
+    ResetLut3DComposeCacheStats();
+}
+
+std::ostream & operator<<(std::ostream & os, const CacheStats & stats)
+{
+    os << "<CacheStats ";
+    os << "hits=" << stats.m_hits << ", ";
+    os << "misses=" << stats.m_misses << ", ";
+    os << "inserts=" << stats.m_inserts << ", ";
+    os << "evictions=" << stats.m_evictions << ", ";
+    os << "entries=" << stats.m_entries << ", ";
+    os << "bytes=" << stats.m_bytes;
+    os << ">";
+    return os;
 }
 } // namespace OCIO_NAMESPACE
@@ -6,6 +6,10 @@
 #define INCLUDED_OCIO_CACHING_H
 
 
+#include <exception>
+#include <functional>
+#include <future>
+#include <list>
 #include <map>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -21,14 +25,33 @@ namespace OCIO_NAMESPACE
 // instance type of the key. Note that having efficient key generation & comparison are critical.
 // For example integer comparison is efficent but string one could be far less efficient depending
 // of its length & where changes occur (e.g. absolute filepaths are inefficient). 
+//
+// The cache is unbounded by default. A capacity in number of entries and/or in estimated bytes
+// could be set, the least recently used entries being then evicted to stay within the capacity.
+// Evicting an entry only releases the reference the cache holds on it.
+//
+// The cache also counts its hits, misses, inserts & evictions, see getStats().
 template<typename KeyType, typename EntryType>
 class GenericCache
 {
 public:
 
-    using Entries = std::map<KeyType, EntryType>;
+    using LRU = std::list<KeyType>;
+
+    struct Node
+    {
+        EntryType m_entry;
+        // Position in the list of the keys from the most to the least recently used.
+        typename LRU::iterator m_lruPos;
+        size_t m_bytes = 0;
+    };
+
+    using Entries = std::map<KeyType, Node>;
     using Iterator = typename Entries::iterator;
 
+    // Estimate the memory size of an entry, for the capacity in bytes.
+    using SizeEstimator = std::function<size_t(const KeyType &, const EntryType &)>;
+
     // Forbid copy & move semantics. 
     GenericCache(const GenericCache &)  = delete;
     GenericCache(GenericCache && other) = delete;
@@ -40,13 +63,19 @@ public:
     {
     }
 
+    explicit GenericCache(const SizeEstimator & estimator)
+        :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES))
+        ,   m_sizeEstimator(estimator)
+    {
+    }
+
     virtual ~GenericCache() = default;
 
     void clear() noexcept
     {
         AutoMutex lock(m_mutex);
 
-        m_entries.clear();
+        clearEntries();
     }
 
     inline void enable(bool enable) noexcept
@@ -57,12 +86,69 @@ public:
         
         if (!isEnabled())
         {
-            m_entries.clear();
+            clearEntries();
         }
     }
 
     inline bool isEnabled() const noexcept { return !m_envDisableAllCaches && m_enabled; }
 
+    // Set the maximum number of entries and the maximum estimated size in bytes of the entries,
+    // where 0 means unbounded. The least recently used entries are evicted if needed.
+    void setCapacity(size_t maxEntries, size_t maxBytes) noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        m_maxEntries = maxEntries;
+        m_maxBytes   = maxBytes;
+
+        evict(0);
+    }
+
+    // To only use when lock is off.
+    size_t getMaxEntries() const noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        return m_maxEntries;
+    }
+
+    size_t getMaxBytes() const noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        return m_maxBytes;
+    }
+
+    // The size of an entry is estimated when inserted in the cache i.e. the estimator should not
+    // rely on the entry content when the entry is inserted by operator[]. Without estimator, the
+    // capacity in bytes does not apply.
+    void setSizeEstimator(const SizeEstimator & estimator)
+    {
+        AutoMutex lock(m_mutex);
+
+        m_sizeEstimator = estimator;
+    }
+
+    // Get the usage statistics of the cache.
+    // To only use when lock is off.
+    CacheStats getStats() const
+    {
+        AutoMutex lock(m_mutex);
+
+        CacheStats stats = m_stats;
+        stats.m_entries = m_entries.size();
+        stats.m_bytes   = m_bytes;
+        return stats;
+    }
+
+    // Reset the hit, miss, insert & eviction counters.
+    void resetStats() noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        m_stats = CacheStats();
+    }
+
     // Get and lock the mutex before accessing to a cache entry.
     Mutex & lock() noexcept { return m_mutex; }
 
@@ -73,17 +159,115 @@ public:
         return isEnabled() && m_entries.end() != m_entries.find(key);
     }
 
-    // Get a cache entry. It creates the cache entry if not existing.
+    // Get the number of entries & their estimated size in bytes.
     // To only use when lock is on to protect the cache access.
-    EntryType & operator[](const KeyType & key) noexcept
+    size_t size() const noexcept { return m_entries.size(); }
+    size_t bytes() const noexcept { return m_bytes; }
+
+    // Get a cache entry. It creates the cache entry if not existing, which could evict the least
+    // recently used entries. An empty entry counts as a miss, so the caller should only call it
+    // once per lookup.
+    // To only use when lock is on to protect the cache access.
+    EntryType & operator[](const KeyType & key)
     {
         static EntryType dummy;
-        return isEnabled() ? m_entries[key] : dummy;
+        if (!isEnabled())
+        {
+            return dummy;
+        }
+
+        Node & node = access(key);
+        if (node.m_entry)
+        {
+            ++m_stats.m_hits;
+        }
+        else
+        {
+            ++m_stats.m_misses;
+        }
+        return node.m_entry;
     }
 
+    // Iterate over the entries without changing their least recently used order.
+    // To only use when lock is on to protect the cache access.
     Iterator begin() noexcept { return m_entries.begin(); }
     Iterator end()   noexcept { return m_entries.end();   }
 
+    // Get a cache entry, calling create() to build it if not existing. The cache is only locked
+    // to look up & insert the entry so entries with different keys are created concurrently,
+    // while the concurrent requests of a key being created wait for that single creation (and
+    // get the same exception if it fails). The creator is free to lock the cache.
+    // To only use when lock is off.
+    template<typename Creator>
+    EntryType getOrCreate(const KeyType & key, Creator create)
+    {
+        std::promise<EntryType> promise;
+        std::shared_future<EntryType> pending;
+
+        {
+            AutoMutex lock(m_mutex);
+
+            if (isEnabled())
+            {
+                auto it = m_entries.find(key);
+                if (it != m_entries.end())
+                {
+                    ++m_stats.m_hits;
+                    return access(key).m_entry;
+                }
+
+                // Waiting for the creation of the entry by another request is also a hit.
+                auto itPending = m_pending.find(key);
+                if (itPending != m_pending.end())
+                {
+                    ++m_stats.m_hits;
+                    pending = itPending->second;
+                }
+                else
+                {
+                    ++m_stats.m_misses;
+                    m_pending[key] = promise.get_future().share();
+                }
+            }
+        }
+
+        if (pending.valid())
+        {
+            return pending.get();
+        }
+
+        try
+        {
+            EntryType entry = create();
+
+            {
+                AutoMutex lock(m_mutex);
+
+                if (isEnabled())
+                {
+                    Node & node = access(key);
+                    node.m_entry = entry;
+                    updateSize(key, node);
+                    evict(1);
+                }
+                m_pending.erase(key);
+            }
+
+            promise.set_value(entry);
+            return entry;
+        }
+        catch (...)
+        {
+            {
+                AutoMutex lock(m_mutex);
+                m_pending.erase(key);
+            }
+
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+    }
+
 protected:
     explicit GenericCache(bool disableCaches)
         :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES) || disableCaches)
@@ -94,8 +278,69 @@ protected:
     bool m_enabled = true;
 
 private:
-    Mutex m_mutex;
+    // Get the node of the key, creating it if needed, and make it the most recently used one.
+    // A new node evicts the least recently used entries exceeding the capacity.
+    Node & access(const KeyType & key)
+    {
+        auto it = m_entries.find(key);
+        if (it != m_entries.end())
+        {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.m_lruPos);
+            return it->second;
+        }
+
+        ++m_stats.m_inserts;
+
+        m_lru.push_front(key);
+        Node & node = m_entries[key];
+        node.m_lruPos = m_lru.begin();
+        updateSize(key, node);
+        evict(1);
+        return node;
+    }
+
+    void updateSize(const KeyType & key, Node & node)
+    {
+        m_bytes -= node.m_bytes;
+        node.m_bytes = m_sizeEstimator ? m_sizeEstimator(key, node.m_entry) : 0;
+        m_bytes += node.m_bytes;
+    }
+
+    // Evict the least recently used entries exceeding the capacity, while always keeping the
+    // numToKeep most recently used ones.
+    void evict(size_t numToKeep)
+    {
+        while (m_lru.size() > numToKeep
+               && ((m_maxEntries != 0 && m_lru.size() > m_maxEntries)
+                   || (m_maxBytes != 0 && m_bytes > m_maxBytes)))
+        {
+            auto it = m_entries.find(m_lru.back());
+            m_bytes -= it->second.m_bytes;
+            m_entries.erase(it);
+            m_lru.pop_back();
+
+            ++m_stats.m_evictions;
+        }
+    }
+
+    void clearEntries() noexcept
+    {
+        m_entries.clear();
+        m_lru.clear();
+        m_bytes = 0;
+    }
+
+    mutable Mutex m_mutex;
     Entries m_entries;
+    LRU m_lru;
+    size_t m_bytes = 0;
+    size_t m_maxEntries = 0;
+    size_t m_maxBytes = 0;
+    SizeEstimator m_sizeEstimator;
+    // Only the entries & bytes members are not maintained.
+    CacheStats m_stats;
+    // The entries being created by getOrCreate().
+    std::map<KeyType, std::shared_future<EntryType>> m_pending;
 };
 
 // A Processor instance uses this class to cache its derived optimized, CPU, and GPU Processors.
@@ -2,11 +2,13 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -317,6 +319,11 @@ public:
 
     ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
     mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
+    // Index of the processors by processor cache ID for the processor cache fallback. It does not
+    // keep the processors alive i.e. it is pruned from the released ones once its size doubles.
+    // To only use when the processor cache lock is on.
+    mutable std::unordered_map<std::string, std::weak_ptr<Processor>> m_processorCacheIDIndex;
+    mutable size_t m_processorCacheIDIndexPruneSize = 64;
 
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
@@ -353,6 +360,11 @@ public:
         m_inactiveColorSpaceNamesEnv = StringUtils::Trim(m_inactiveColorSpaceNamesEnv);
 
         m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+        m_processorCache.setSizeEstimator(
+            [](const std::size_t &, const ProcessorRcPtr & processor) -> size_t
+            {
+                return processor ? processor->getImpl()->getMemorySizeEstimate() : 0;
+            });
 
         // This is used to allow the YAML writer to not save any virtual displays that were
         // instantiated.
@@ -425,8 +437,10 @@ public:
             
             m_cacheFlags = rhs.m_cacheFlags;
 
-            m_processorCache.clear();
+            clearProcessorCache();
             m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+            m_processorCache.setCapacity(rhs.m_processorCache.getMaxEntries(),
+                                         rhs.m_processorCache.getMaxBytes());
         }
         return *this;
     }
@@ -515,6 +529,14 @@ public:
     // thread safe manner by acquiring the m_cacheidMutex.
     void resetCacheIDs();
 
+    // Flush the processor cache & its index by processor cache ID.
+    void clearProcessorCache() const;
+
+    // Get an existing processor with the same cache ID as the processor if any, otherwise index
+    // the processor and return it. It uses an index so the cost does not depend on the number of
+    // cached processors.
+    ProcessorRcPtr getEquivalentProcessor(const ProcessorRcPtr & processor) const;
+
     // Get all internal transforms (to generate cacheIDs, validation, etc).
     // This currently crawls colorspaces + looks + view transforms.
     void getAllInternalTransforms(ConstTransformVec & transformVec) const;
@@ -3467,8 +3489,6 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
     if (getImpl()->m_processorCache.isEnabled())
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
-
         std::ostringstream oss;
         oss << (needContextVariables ? std::string(usedContext->getCacheID()) : "")
             << std::string(src->getName())
@@ -3476,43 +3496,27 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
-        if (!processor)
+        // The cache is not locked while the processor is created so processors of different keys
+        // are created concurrently, while the concurrent requests of the same key wait for it.
+        return getImpl()->m_processorCache.getOrCreate(key, [&]() -> ProcessorRcPtr
         {
             ProcessorRcPtr proc = CreateProcessor(*this, context, src, dst);
 
             const bool doFallback = !Platform::isEnvPresent(OCIO_DISABLE_CACHE_FALLBACK);
             if (doFallback)
             {
-                // If an entry with the same cache ID already exists in the cache then reuse it instead
-                // of the newly created one. Even with different context, the same processor could be
+                // If a processor with the same cache ID already exists then reuse it instead of the
+                // newly created one. Even with different context, the same processor could be
                 // created (e.g. the processor creation does not rely on some context variables).
 
                 // The benefit to using the existing one is that it may already have an optimized
                 // Processor, CPUProcessor, or GPUProcessor inside it.
 
-                // TODO: With the original context part of the cache data, the code could first compare
-                // the two contexts before doing the lengthy Processor::getCacheID() computation.
-
-                for (auto & entry : getImpl()->m_processorCache)
-                {
-                    if (entry.second && 0 == strcmp(entry.second->getCacheID(), proc->getCacheID()))
-                    {
-                        processor = entry.second;
-                        break;
-                    }
-                } 
+                return getImpl()->getEquivalentProcessor(proc);
             }
 
-            if (!processor)
-            {
-                processor = proc;
-            }
-        }
-
-        return processor;
+            return proc;
+        });
     }
     else
     {
@@ -3626,8 +3630,6 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
     if (getImpl()->m_processorCache.isEnabled())
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
-
         // Note that the key includes a string description of the transform which does not include
         // all the LUT entries (just the arguments of the FileTransforms for LUTs).
         std::ostringstream oss;
@@ -3637,37 +3639,24 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
-        if (!processor)
+        // The cache is not locked while the processor is created so processors of different keys
+        // are created concurrently, while the concurrent requests of the same key wait for it.
+        return getImpl()->m_processorCache.getOrCreate(key, [&]() -> ProcessorRcPtr
         {
             ProcessorRcPtr proc = CreateProcessor(*this, context, transform, direction);
 
             const bool doFallback = !Platform::isEnvPresent(OCIO_DISABLE_CACHE_FALLBACK);
             if (doFallback)
             {
-                // If an entry with the same cache ID already exists in the cache then reuse it instead
-                // of the newly created one. Even with different context, the same processor could be
+                // If a processor with the same cache ID already exists then reuse it instead of the
+                // newly created one. Even with different context, the same processor could be
                 // created (e.g. the processor creation does not rely on some context variables).
 
-                for (auto & entry : getImpl()->m_processorCache)
-                {
-                    if (entry.second && 0 == strcmp(entry.second->getCacheID(), proc->getCacheID()))
-                    {
-                        processor = entry.second;
-                        break;
-                    }
-                }
+                return getImpl()->getEquivalentProcessor(proc);
             }
 
-            if (!processor)
-            {
-                processor = proc;
-            }
-        }
-
-        return processor;
+            return proc;
+        });
     }
     else
     {
@@ -3913,6 +3902,31 @@ void Config::setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept
     getImpl()->setProcessorCacheFlags(flags);
 }
 
+void Config::setProcessorCacheCapacity(size_t maxEntries, size_t maxBytes) noexcept
+{
+    getImpl()->m_processorCache.setCapacity(maxEntries, maxBytes);
+}
+
+size_t Config::getProcessorCacheMaxEntries() const noexcept
+{
+    return getImpl()->m_processorCache.getMaxEntries();
+}
+
+size_t Config::getProcessorCacheMaxBytes() const noexcept
+{
+    return getImpl()->m_processorCache.getMaxBytes();
+}
+
+CacheStats Config::getProcessorCacheStats() const
+{
+    return getImpl()->m_processorCache.getStats();
+}
+
+void Config::resetProcessorCacheStats() noexcept
+{
+    getImpl()->m_processorCache.resetStats();
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 //  Config::Impl
@@ -3982,7 +3996,44 @@ void Config::Impl::resetCacheIDs()
 
     // As any changes could impact the cache keys, it's better to always flush the cache
     // of processors to not keep in memory useless instances.
+    clearProcessorCache();
+}
+
+void Config::Impl::clearProcessorCache() const
+{
     m_processorCache.clear();
+
+    AutoMutex guard(m_processorCache.lock());
+    m_processorCacheIDIndex.clear();
+    m_processorCacheIDIndexPruneSize = 64;
+}
+
+ProcessorRcPtr Config::Impl::getEquivalentProcessor(const ProcessorRcPtr & processor) const
+{
+    // The cache ID computation could be lengthy (e.g. LUT hashing) so it is done unlocked, and
+    // it is the only one needed as the ones of the indexed processors are already known.
+    const std::string cacheID = processor->getCacheID();
+
+    AutoMutex guard(m_processorCache.lock());
+
+    std::weak_ptr<Processor> & entry = m_processorCacheIDIndex[cacheID];
+    if (ProcessorRcPtr existingProcessor = entry.lock())
+    {
+        return existingProcessor;
+    }
+
+    entry = processor;
+
+    if (m_processorCacheIDIndex.size() > m_processorCacheIDIndexPruneSize)
+    {
+        for (auto it = m_processorCacheIDIndex.begin(); it != m_processorCacheIDIndex.end(); )
+        {
+            it = it->second.expired() ? m_processorCacheIDIndex.erase(it) : std::next(it);
+        }
+        m_processorCacheIDIndexPruneSize = std::max<size_t>(64, 2 * m_processorCacheIDIndex.size());
+    }
+
+    return processor;
 }
 
 void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) const
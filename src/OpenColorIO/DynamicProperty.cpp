@@ -263,6 +263,8 @@ void DynamicPropertyGradingRGBCurveImpl::precompute()
         curveImpl->computeKnotsAndCoefs(m_knotsCoefs, static_cast<int>(c));
     }
     if (m_knotsCoefs.m_knotsArray.empty()) m_knotsCoefs.m_localBypass = true;
+
+    m_sampledCurves.sample(m_knotsCoefs);
 }
 
 DynamicPropertyGradingRGBCurveImplRcPtr DynamicPropertyGradingRGBCurveImpl::createEditableCopy() const
@@ -157,6 +157,10 @@ public:
     const float * getCoefsArray() const;
 
     const GradingBSplineCurveImpl::KnotsCoefs & getKnotsCoefs() const { return m_knotsCoefs; }
+    const GradingBSplineCurveImpl::SampledCurves & getSampledCurves() const
+    {
+        return m_sampledCurves;
+    }
 
     static unsigned int GetMaxKnots();
     static unsigned int GetMaxCoefs();
@@ -170,6 +174,8 @@ private:
 
     // Holds curve data as knots and coefs. There are 4 curves.
     GradingBSplineCurveImpl::KnotsCoefs m_knotsCoefs{ 4 };
+    // Dense sampling of the same curves for the CPU renderers, refreshed by precompute().
+    GradingBSplineCurveImpl::SampledCurves m_sampledCurves{ 4 };
 };
 
 class DynamicPropertyGradingToneImpl;
@@ -1,46 +1,126 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <cstring>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "HashUtils.h"
-#include "md5/md5.h"
-
-#include <sstream>
-#include <iostream>
 
 namespace OCIO_NAMESPACE
 {
-std::string CacheIDHash(const char * array, int size)
+
+namespace
+{
+
+// Secret constants of the wyhash family i.e. odd 64-bit values with balanced bits.
+constexpr uint64_t P0 = 0xa0761d6478bd642fULL;
+constexpr uint64_t P1 = 0xe7037ed1a0b428dbULL;
+constexpr uint64_t P2 = 0x8ebc6af09c88c6e3ULL;
+constexpr uint64_t P3 = 0x589965cc75374cc3ULL;
+
+// Read the bytes in little-endian order so the hashes do not depend on the platform (compilers
+// turn it into a single load on little-endian platforms).
+inline uint64_t Read64(const uint8_t * ptr)
+{
+    return  static_cast<uint64_t>(ptr[0])        | (static_cast<uint64_t>(ptr[1]) << 8)
+         | (static_cast<uint64_t>(ptr[2]) << 16) | (static_cast<uint64_t>(ptr[3]) << 24)
+         | (static_cast<uint64_t>(ptr[4]) << 32) | (static_cast<uint64_t>(ptr[5]) << 40)
+         | (static_cast<uint64_t>(ptr[6]) << 48) | (static_cast<uint64_t>(ptr[7]) << 56);
+}
+
+// Fold the 128-bit product of the two values.
+inline uint64_t Mix(uint64_t a, uint64_t b)
 {
-    md5_state_t state;
-    md5_byte_t digest[16];
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t r = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#else
+    const uint64_t ha = a >> 32, la = static_cast<uint32_t>(a);
+    const uint64_t hb = b >> 32, lb = static_cast<uint32_t>(b);
+
+    const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
 
-    md5_init(&state);
-    md5_append(&state, (const md5_byte_t *)array, size);
-    md5_finish(&state, digest);
+    const uint64_t t = rl + (rm0 << 32);
+    uint64_t carry = t < rl ? 1 : 0;
+    const uint64_t lo = t + (rm1 << 32);
+    carry += lo < t ? 1 : 0;
+    const uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
 
-    return GetPrintableHash(digest);
+    return lo ^ hi;
+#endif
 }
 
-std::string GetPrintableHash(const md5_byte_t * digest)
+// Process a 64-byte stripe using four independent lanes so the multiplications pipeline well.
+inline void MixStripe(const uint8_t * ptr, uint64_t (&h)[4])
 {
-    static char charmap[] = "0123456789abcdef";
+    h[0] ^= Mix(Read64(ptr)      ^ P0, Read64(ptr +  8) ^ h[0]);
+    h[1] ^= Mix(Read64(ptr + 16) ^ P1, Read64(ptr + 24) ^ h[1]);
+    h[2] ^= Mix(Read64(ptr + 32) ^ P2, Read64(ptr + 40) ^ h[2]);
+    h[3] ^= Mix(Read64(ptr + 48) ^ P3, Read64(ptr + 56) ^ h[3]);
+}
 
-    char printableResult[34];
-    char *ptr = printableResult;
+void Hash128(const uint8_t * ptr, size_t size, uint8_t (&digest)[16])
+{
+    // The size is part of the seed so inputs only differing by trailing zeros differ.
+    const uint64_t seed = P0 ^ Mix(static_cast<uint64_t>(size) ^ P1, P2);
+    uint64_t h[4] = { seed, seed ^ P3 ^ P1, seed ^ P2, seed ^ P1 ^ P3 };
 
-    // build a printable string from unprintable chars.  first character
-    // of hashed cache IDs is '$', to later check if it's already been hashed
-    *ptr++ = '$';
-    for (int i=0;i<16;++i)
+    size_t remaining = size;
+    while (remaining >= 64)
     {
-        *ptr++ = charmap[(digest[i] & 0x0F)];
-        *ptr++ = charmap[(digest[i] >> 4)];
+        MixStripe(ptr, h);
+        ptr       += 64;
+        remaining -= 64;
     }
-    *ptr++ = 0;
 
-    return std::string(printableResult);
+    uint8_t tail[64] = { 0 };
+    if (remaining > 0)
+    {
+        std::memcpy(tail, ptr, remaining);
+    }
+    MixStripe(tail, h);
+
+    const uint64_t lo = Mix(h[0] ^ P1, h[1] ^ P2) ^ Mix(h[2] ^ P3, h[3] ^ P0);
+    const uint64_t hi = Mix(h[1] ^ lo ^ P0, h[2] ^ P1) ^ Mix(h[3] ^ P2, h[0] ^ lo ^ P3);
+
+    for (unsigned idx = 0; idx < 8; ++idx)
+    {
+        digest[idx]     = static_cast<uint8_t>(lo >> (8 * idx));
+        digest[idx + 8] = static_cast<uint8_t>(hi >> (8 * idx));
+    }
+}
+
+} // anon.
+
+std::string CacheIDHash(const char * array, int size)
+{
+    uint8_t digest[16];
+    Hash128(reinterpret_cast<const uint8_t *>(array), size > 0 ? static_cast<size_t>(size) : 0,
+            digest);
+
+    return GetPrintableHash(digest, sizeof(digest));
+}
+
+std::string GetPrintableHash(const uint8_t * digest, size_t size)
+{
+    static const char charmap[] = "0123456789abcdef";
+
+    // Build a printable string from unprintable chars.  First character
+    // of hashed cache IDs is '$', to later check if it's already been hashed.
+    std::string printableResult(1 + 2 * size, '$');
+    for (size_t i = 0; i < size; ++i)
+    {
+        printableResult[1 + 2 * i]     = charmap[(digest[i] & 0x0F)];
+        printableResult[1 + 2 * i + 1] = charmap[(digest[i] >> 4)];
+    }
+
+    return printableResult;
+}
+
+void MemoizedHash::invalidate() noexcept
+{
+    m_valid = false;
 }
 
 } // namespace OCIO_NAMESPACE
@@ -7,17 +7,82 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
-#include "md5/md5.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
+#include "Mutex.h"
+
 namespace OCIO_NAMESPACE
 {
+
+// Compute a printable 128-bit hash of the byte array. The hash function is a fast
+// non-cryptographic one (i.e. a multiply-mix hash of the wyhash family) as the cache IDs only
+// need to discriminate content, and the result starts with a '$' to later check if a string
+// has already been hashed.
 std::string CacheIDHash(const char * array, int size);
 
-// TODO: get rid of md5.h include, make this a generic byte array
-std::string GetPrintableHash(const md5_byte_t * digest);
+// Build the printable string from the digest bytes i.e. '$' followed by two hexadecimal
+// characters per byte.
+std::string GetPrintableHash(const uint8_t * digest, size_t size);
+
+// Memoize a hash (e.g. the hash of the values of a LUT) to avoid recomputing it each time a
+// cache ID is requested. The object owning the hashed content must call invalidate() whenever
+// the content could change, and copies keep the hash as they copy the content.
+class MemoizedHash
+{
+public:
+    MemoizedHash() = default;
+
+    MemoizedHash(const MemoizedHash & rhs)
+    {
+        *this = rhs;
+    }
+
+    MemoizedHash & operator=(const MemoizedHash & rhs)
+    {
+        if (this != &rhs)
+        {
+            std::string hash;
+            bool valid = false;
+            {
+                AutoMutex guard(rhs.m_mutex);
+                hash  = rhs.m_hash;
+                valid = rhs.m_valid;
+            }
+
+            AutoMutex guard(m_mutex);
+            m_hash  = hash;
+            m_valid = valid;
+        }
+        return *this;
+    }
+
+    // Return the memoized hash, computing it with the function if needed.
+    template<typename Fn>
+    std::string get(Fn computeHash) const
+    {
+        AutoMutex guard(m_mutex);
+        if (!m_valid)
+        {
+            m_hash  = computeHash();
+            m_valid = true;
+        }
+        return m_hash;
+    }
+
+    // Cheap enough to be called on all the non-const accesses to the hashed content. It is out
+    // of line as GCC 12 reports false -Wstringop-overflow warnings on the atomic store once it is
+    // inlined in the LUT array accessors.
+    void invalidate() noexcept;
+
+private:
+    mutable Mutex m_mutex;
+    mutable std::string m_hash;
+    mutable std::atomic<bool> m_valid{ false };
+};
 
 } // namespace OCIO_NAMESPACE
 
 #endif
-
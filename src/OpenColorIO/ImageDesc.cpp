@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstdlib>
 #include <sstream>
 
@@ -57,6 +58,17 @@ std::ostream& operator<< (std::ostream& os, const ImageDesc& img)
     return os;
 }
 
+std::ostream & operator<<(std::ostream & os, const ImageROI & roi)
+{
+    os << "<ImageROI ";
+    os << "x=" << roi.m_x << ", ";
+    os << "y=" << roi.m_y << ", ";
+    os << "width=" << roi.m_width << ", ";
+    os << "height=" << roi.m_height;
+    os << ">";
+    return os;
+}
+
 ImageDesc::ImageDesc()
 {
 
@@ -71,7 +83,8 @@ ImageDesc::~ImageDesc()
 ///////////////////////////////////////////////////////////////////////////
 
 
-void GenericImageDesc::init(const ImageDesc & img, BitDepth bitDepth, const ConstOpCPURcPtr & bitDepthOp)
+void GenericImageDesc::init(const ImageDesc & img, BitDepth bitDepth, const ConstOpCPURcPtr & bitDepthOp,
+                            const ImageROI * roi)
 {
     m_bitDepthOp = bitDepthOp;
 
@@ -93,6 +106,74 @@ void GenericImageDesc::init(const ImageDesc & img, BitDepth bitDepth, const Cons
     {
         throw Exception("Bit-depth mismatch between the image buffer and the finalization setting.");
     }
+
+    if(roi)
+    {
+        if(roi->m_x<0 || roi->m_y<0 || roi->m_width<=0 || roi->m_height<=0
+            || roi->m_width>m_width - roi->m_x || roi->m_height>m_height - roi->m_y)
+        {
+            std::ostringstream oss;
+            oss << "The region of interest " << *roi << " is not inside the image buffer of "
+                << m_width << "x" << m_height << " pixels.";
+            throw Exception(oss.str().c_str());
+        }
+
+        // The region of interest is an image buffer starting at its first pixel with the
+        // same strides i.e. the pixels are neither copied nor moved.
+
+        const ptrdiff_t offset = m_yStrideBytes * roi->m_y + m_xStrideBytes * roi->m_x;
+
+        m_rData += offset;
+        m_gData += offset;
+        m_bData += offset;
+        if(m_aData)
+        {
+            m_aData += offset;
+        }
+
+        m_width  = roi->m_width;
+        m_height = roi->m_height;
+    }
+
+    // Detect the interleaved layouts i.e. find the position of each channel in a pixel.
+
+    m_numChannels = 0;
+
+    const unsigned numChannels = m_aData ? 4 : 3;
+    const ptrdiff_t chanBytes  = GetChannelSizeInBytes(bitDepth);
+
+    if(m_xStrideBytes==ptrdiff_t(numChannels * chanBytes))
+    {
+        char * channels[4] = { m_rData, m_gData, m_bData, m_aData };
+
+        const char * pixel = std::min(std::min(m_rData, m_gData), m_bData);
+        if(m_aData)
+        {
+            pixel = std::min(pixel, (const char *)m_aData);
+        }
+
+        unsigned foundChannels = 0;
+        for(unsigned chan = 0; chan < numChannels; ++chan)
+        {
+            const ptrdiff_t offset = channels[chan] - pixel;
+            if(offset % chanBytes != 0 || offset / chanBytes >= ptrdiff_t(numChannels))
+            {
+                return;
+            }
+
+            m_chanIndex[chan] = int(offset / chanBytes);
+            foundChannels |= 1 << m_chanIndex[chan];
+        }
+
+        if(foundChannels==((1u << numChannels) - 1))
+        {
+            m_numChannels = numChannels;
+            if(!m_aData)
+            {
+                m_chanIndex[3] = -1;
+            }
+        }
+    }
 }
 
 bool GenericImageDesc::isPackedFloatRGBA() const
@@ -110,6 +191,11 @@ bool GenericImageDesc::isFloat() const
     return m_isFloat;
 }
 
+bool GenericImageDesc::isInterleaved() const
+{
+    return m_numChannels!=0;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -11,7 +11,9 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ImagePacking.h"
+#include "ImagePacking_AVX2.h"
 
 
 namespace OCIO_NAMESPACE
@@ -64,6 +66,20 @@ void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
 
     // Process one single, complete scanline.
     int pixelsCopied = 0;
+
+#ifdef USE_AVX2
+    if(srcImg.isInterleaved() && CPUInfo::Instance().hasAVX2())
+    {
+        const char * pixel
+            = reinterpret_cast<const char*>(rPtr) - srcImg.m_chanIndex[0] * sizeof(Type);
+
+        PackRGBA_AVX2(pixel, reinterpret_cast<char*>(inBitDepthBuffer), outputBufferSize,
+                      sizeof(Type), srcImg.m_numChannels, srcImg.m_chanIndex);
+
+        pixelsCopied = outputBufferSize;
+    }
+#endif
+
     while(pixelsCopied < outputBufferSize)
     {
         // Reorder channels from arbitrary channel ordering to RGBA 32-bit float.
@@ -134,6 +150,20 @@ void Generic<float>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
 
     // Process one single, complete scanline.
     int pixelsCopied = 0;
+
+#ifdef USE_AVX2
+    if(srcImg.isInterleaved() && CPUInfo::Instance().hasAVX2())
+    {
+        const char * pixel
+            = reinterpret_cast<const char*>(rPtr) - srcImg.m_chanIndex[0] * sizeof(float);
+
+        PackRGBA_AVX2(pixel, reinterpret_cast<char*>(outputBuffer), outputBufferSize,
+                      sizeof(float), srcImg.m_numChannels, srcImg.m_chanIndex);
+
+        pixelsCopied = outputBufferSize;
+    }
+#endif
+
     while(pixelsCopied < outputBufferSize)
     {
         // Reorder channels from arbitrary channel ordering to RGBA 32-bit float.
@@ -207,6 +237,19 @@ void Generic<Type>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
 
     // Process one single, complete scanline.
     int pixelsCopied = 0;
+
+#ifdef USE_AVX2
+    if(dstImg.isInterleaved() && CPUInfo::Instance().hasAVX2())
+    {
+        char * pixel = reinterpret_cast<char*>(rPtr) - dstImg.m_chanIndex[0] * sizeof(Type);
+
+        UnpackRGBA_AVX2(reinterpret_cast<const char*>(outBitDepthBuffer), pixel, numPixelsToUnpack,
+                        sizeof(Type), dstImg.m_numChannels, dstImg.m_chanIndex);
+
+        pixelsCopied = numPixelsToUnpack;
+    }
+#endif
+
     while(pixelsCopied < numPixelsToUnpack)
     {
         // Copy from RGBA buffer to arbitrary channel ordering.
@@ -277,6 +320,19 @@ void Generic<float>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
 
     // Process one single, complete scanline.
     int pixelsCopied = 0;
+
+#ifdef USE_AVX2
+    if(dstImg.isInterleaved() && CPUInfo::Instance().hasAVX2())
+    {
+        char * pixel = reinterpret_cast<char*>(rPtr) - dstImg.m_chanIndex[0] * sizeof(float);
+
+        UnpackRGBA_AVX2(reinterpret_cast<const char*>(inputBuffer), pixel, numPixelsToUnpack,
+                        sizeof(float), dstImg.m_numChannels, dstImg.m_chanIndex);
+
+        pixelsCopied = numPixelsToUnpack;
+    }
+#endif
+
     while(pixelsCopied < numPixelsToUnpack)
     {
         // Copy from RGBA buffer to arbitrary channel ordering.
@@ -34,9 +34,19 @@ struct GenericImageDesc
     // Is the image buffer a 32-bit float image buffer?
     bool m_isFloat      = false;
 
+    // Number of channels of an interleaved image buffer (i.e. the channels of a pixel and the
+    // pixels of a line are contiguous, like RGB or BGRA packed buffers), or 0 if the image
+    // buffer has another layout.
+    unsigned m_numChannels = 0;
+    // Position in a pixel of the red, green, blue & alpha channels of an interleaved image
+    // buffer, where -1 means there is no alpha channel.
+    int m_chanIndex[4] = { 0, 1, 2, 3 };
 
-    // Resolves all AutoStride.
-    void init(const ImageDesc & img, BitDepth bitDepth, const ConstOpCPURcPtr & bitDepthOp);
+
+    // Resolves all AutoStride. When roi is not null, only the region of interest of the image
+    // buffer is described (i.e. its first pixel, width & height).
+    void init(const ImageDesc & img, BitDepth bitDepth, const ConstOpCPURcPtr & bitDepthOp,
+              const ImageROI * roi = nullptr);
 
     // Is the image buffer a packed RGBA 32-bit float buffer?
     bool isPackedFloatRGBA() const;
@@ -44,6 +54,8 @@ struct GenericImageDesc
     bool isRGBAPacked() const;
     // Is the image buffer a 32-bit float image buffer?
     bool isFloat() const;
+    // Is the image buffer an interleaved buffer (e.g. RGB or BGRA packed buffers)?
+    bool isInterleaved() const;
 };
 
 template<typename Type>
@@ -0,0 +1,337 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ImagePacking_AVX2.h"
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// A 128-bit lane always holds 16 bytes of RGBA pixels i.e. 4 / chanBytes pixels, which are
+// 4 * numChannels bytes of interleaved pixels whatever the channel size is.
+
+// Build the byte shuffle from interleaved pixels to RGBA pixels for one 128-bit lane.
+__m256i GetPackShuffle(unsigned chanBytes, unsigned numChannels, const int (&chanIndex)[4])
+{
+    alignas(32) char shuffle[32];
+    for (unsigned idx = 0; idx < 16; ++idx)
+    {
+        const unsigned pxl  = idx / (4 * chanBytes);
+        const unsigned chan = (idx / chanBytes) % 4;
+        const unsigned byte = idx % chanBytes;
+
+        // Bytes with the high bit set are zeroed by the shuffle.
+        shuffle[idx] = chanIndex[chan] < 0
+            ? (char)0x80
+            : (char)(pxl * numChannels * chanBytes + (unsigned)chanIndex[chan] * chanBytes + byte);
+
+        shuffle[idx + 16] = shuffle[idx];
+    }
+    return _mm256_load_si256((const __m256i *)shuffle);
+}
+
+// Build the byte shuffle from RGBA pixels to interleaved pixels for one 128-bit lane.
+__m256i GetUnpackShuffle(unsigned chanBytes, unsigned numChannels, const int (&chanIndex)[4])
+{
+    alignas(32) char shuffle[32];
+    for (unsigned idx = 0; idx < 16; ++idx)
+    {
+        shuffle[idx] = (char)0x80;
+    }
+
+    const unsigned numPixels = 4 / chanBytes;
+    for (unsigned pxl = 0; pxl < numPixels; ++pxl)
+    {
+        for (unsigned chan = 0; chan < 4; ++chan)
+        {
+            if (chanIndex[chan] < 0)
+            {
+                continue;
+            }
+
+            for (unsigned byte = 0; byte < chanBytes; ++byte)
+            {
+                const unsigned dst = pxl * numChannels * chanBytes
+                                     + (unsigned)chanIndex[chan] * chanBytes + byte;
+                shuffle[dst] = (char)(pxl * 4 * chanBytes + chan * chanBytes + byte);
+            }
+        }
+    }
+
+    for (unsigned idx = 0; idx < 16; ++idx)
+    {
+        shuffle[idx + 16] = shuffle[idx];
+    }
+    return _mm256_load_si256((const __m256i *)shuffle);
+}
+
+// Pack the eight 32-bit integers to 16-bit unsigned integers with saturation.
+inline __m128i PackUInt16(const __m256i values)
+{
+    return _mm_packus_epi32(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1));
+}
+
+// Round and clamp the float values (i.e. same as Converter::CastValue()).
+inline __m256i RoundAndClamp(const __m256 values, const __m256 scale, const __m256 maxValue)
+{
+    __m256 v = _mm256_add_ps(_mm256_mul_ps(values, scale), _mm256_set1_ps(0.5f));
+    // Note that _mm256_max_ps() returns the second operand if the first one is a NaN.
+    v = _mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), maxValue);
+    return _mm256_cvttps_epi32(v);
+}
+
+} // anon
+
+void PackRGBA_AVX2(const char * in, char * out, long numPixels,
+                   unsigned chanBytes, unsigned numChannels, const int (&chanIndex)[4])
+{
+    const __m256i shuffle = GetPackShuffle(chanBytes, numChannels, chanIndex);
+
+    const long lanePixels = 4 / chanBytes;
+    const long laneBytes  = 4 * numChannels;
+    const long pxlBytes   = numChannels * chanBytes;
+    const long inBytes    = numPixels * pxlBytes;
+
+    // Each iteration reads 16 bytes for each of the two lanes, which is more than needed
+    // when numChannels is 3.
+    long idx = 0;
+    for (; idx + 2 * lanePixels <= numPixels && idx * pxlBytes + laneBytes + 16 <= inBytes;
+         idx += 2 * lanePixels)
+    {
+        const __m128i lo = _mm_loadu_si128((const __m128i *)in);
+        const __m128i hi = _mm_loadu_si128((const __m128i *)(in + laneBytes));
+
+        const __m256i pix = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        _mm256_storeu_si256((__m256i *)out, _mm256_shuffle_epi8(pix, shuffle));
+
+        in  += 2 * laneBytes;
+        out += 32;
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        for (unsigned chan = 0; chan < 4; ++chan)
+        {
+            for (unsigned byte = 0; byte < chanBytes; ++byte)
+            {
+                out[chan * chanBytes + byte]
+                    = chanIndex[chan] < 0 ? 0 : in[(unsigned)chanIndex[chan] * chanBytes + byte];
+            }
+        }
+
+        in  += pxlBytes;
+        out += 4 * chanBytes;
+    }
+}
+
+void UnpackRGBA_AVX2(const char * in, char * out, long numPixels,
+                     unsigned chanBytes, unsigned numChannels, const int (&chanIndex)[4])
+{
+    const __m256i shuffle = GetUnpackShuffle(chanBytes, numChannels, chanIndex);
+
+    const long lanePixels = 4 / chanBytes;
+    const long laneBytes  = 4 * numChannels;
+    const long pxlBytes   = numChannels * chanBytes;
+    const long outBytes   = numPixels * pxlBytes;
+
+    // Each iteration writes 16 bytes for each of the two lanes (i.e. the extra bytes of the
+    // first lane are then overwritten) so it must stay in the output buffer.
+    long idx = 0;
+    for (; idx + 2 * lanePixels <= numPixels && idx * pxlBytes + laneBytes + 16 <= outBytes;
+         idx += 2 * lanePixels)
+    {
+        const __m256i pix
+            = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)in), shuffle);
+
+        _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(pix));
+        _mm_storeu_si128((__m128i *)(out + laneBytes), _mm256_extracti128_si256(pix, 1));
+
+        in  += 32;
+        out += 2 * laneBytes;
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        for (unsigned chan = 0; chan < 4; ++chan)
+        {
+            if (chanIndex[chan] < 0)
+            {
+                continue;
+            }
+
+            for (unsigned byte = 0; byte < chanBytes; ++byte)
+            {
+                out[(unsigned)chanIndex[chan] * chanBytes + byte] = in[chan * chanBytes + byte];
+            }
+        }
+
+        in  += 4 * chanBytes;
+        out += pxlBytes;
+    }
+}
+
+void ConvertToFloat_AVX2(const uint8_t * in, float * out, long numValues, float scale)
+{
+    const __m256 mm_scale = _mm256_set1_ps(scale);
+
+    long idx = 0;
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        const __m256i values = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(in + idx)));
+        _mm256_storeu_ps(out + idx, _mm256_mul_ps(_mm256_cvtepi32_ps(values), mm_scale));
+    }
+
+    for (; idx < numValues; ++idx)
+    {
+        out[idx] = (float)in[idx] * scale;
+    }
+}
+
+void ConvertToFloat_AVX2(const uint16_t * in, float * out, long numValues, float scale)
+{
+    const __m256 mm_scale = _mm256_set1_ps(scale);
+
+    long idx = 0;
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        const __m256i values = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(in + idx)));
+        _mm256_storeu_ps(out + idx, _mm256_mul_ps(_mm256_cvtepi32_ps(values), mm_scale));
+    }
+
+    for (; idx < numValues; ++idx)
+    {
+        out[idx] = (float)in[idx] * scale;
+    }
+}
+
+void ConvertHalfToFloat_AVX2(const uint16_t * in, float * out, long numValues)
+{
+    long idx = 0;
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        _mm256_storeu_ps(out + idx, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(in + idx))));
+    }
+
+    if (idx < numValues)
+    {
+        uint16_t buffer[8] = { 0 };
+        for (long i = idx; i < numValues; ++i)
+        {
+            buffer[i - idx] = in[i];
+        }
+
+        alignas(32) float values[8];
+        _mm256_store_ps(values, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)buffer)));
+
+        for (long i = idx; i < numValues; ++i)
+        {
+            out[i] = values[i - idx];
+        }
+    }
+}
+
+void ConvertFromFloat_AVX2(const float * in, uint8_t * out, long numValues,
+                           float scale, float maxValue)
+{
+    const __m256 mm_scale = _mm256_set1_ps(scale);
+    const __m256 mm_max   = _mm256_set1_ps(maxValue);
+
+    long idx = 0;
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        const __m128i values = PackUInt16(RoundAndClamp(_mm256_loadu_ps(in + idx), mm_scale, mm_max));
+        _mm_storel_epi64((__m128i *)(out + idx), _mm_packus_epi16(values, values));
+    }
+
+    if (idx < numValues)
+    {
+        alignas(32) float buffer[8] = { 0 };
+        for (long i = idx; i < numValues; ++i)
+        {
+            buffer[i - idx] = in[i];
+        }
+
+        const __m128i values = PackUInt16(RoundAndClamp(_mm256_load_ps(buffer), mm_scale, mm_max));
+
+        alignas(16) uint8_t results[16];
+        _mm_store_si128((__m128i *)results, _mm_packus_epi16(values, values));
+
+        for (long i = idx; i < numValues; ++i)
+        {
+            out[i] = results[i - idx];
+        }
+    }
+}
+
+void ConvertFromFloat_AVX2(const float * in, uint16_t * out, long numValues,
+                           float scale, float maxValue)
+{
+    const __m256 mm_scale = _mm256_set1_ps(scale);
+    const __m256 mm_max   = _mm256_set1_ps(maxValue);
+
+    long idx = 0;
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        const __m128i values = PackUInt16(RoundAndClamp(_mm256_loadu_ps(in + idx), mm_scale, mm_max));
+        _mm_storeu_si128((__m128i *)(out + idx), values);
+    }
+
+    if (idx < numValues)
+    {
+        alignas(32) float buffer[8] = { 0 };
+        for (long i = idx; i < numValues; ++i)
+        {
+            buffer[i - idx] = in[i];
+        }
+
+        alignas(16) uint16_t results[8];
+        _mm_store_si128((__m128i *)results,
+                        PackUInt16(RoundAndClamp(_mm256_load_ps(buffer), mm_scale, mm_max)));
+
+        for (long i = idx; i < numValues; ++i)
+        {
+            out[i] = results[i - idx];
+        }
+    }
+}
+
+void ConvertFloatToHalf_AVX2(const float * in, uint16_t * out, long numValues)
+{
+    long idx = 0;
+    for (; idx + 8 <= numValues; idx += 8)
+    {
+        _mm_storeu_si128((__m128i *)(out + idx),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(in + idx), _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    if (idx < numValues)
+    {
+        alignas(32) float buffer[8] = { 0 };
+        for (long i = idx; i < numValues; ++i)
+        {
+            buffer[i - idx] = in[i];
+        }
+
+        alignas(16) uint16_t results[8];
+        _mm_store_si128((__m128i *)results,
+                        _mm256_cvtps_ph(_mm256_load_ps(buffer), _MM_FROUND_TO_NEAREST_INT));
+
+        for (long i = idx; i < numValues; ++i)
+        {
+            out[i] = results[i - idx];
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_IMAGEPACKING_AVX2_H
+#define INCLUDED_OCIO_IMAGEPACKING_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <cstdint>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Only call these functions if CPUInfo::hasAVX2() is true. Note that the half values are
+// processed as their 16-bit representation.
+
+// Copy interleaved pixels (i.e. numChannels contiguous channels of chanBytes bytes) to packed
+// RGBA pixels of the same type. The chanIndex array holds the position in the pixel of the red,
+// green, blue & alpha channels, where -1 means that the alpha channel is missing (i.e. numChannels
+// is 3) and set to zero.
+void PackRGBA_AVX2(const char * in, char * out, long numPixels,
+                   unsigned chanBytes, unsigned numChannels, const int (&chanIndex)[4]);
+
+// Copy packed RGBA pixels to interleaved pixels, see PackRGBA_AVX2(). A missing alpha channel
+// is not copied.
+void UnpackRGBA_AVX2(const char * in, char * out, long numPixels,
+                     unsigned chanBytes, unsigned numChannels, const int (&chanIndex)[4]);
+
+// Convert integer or half values to float values i.e. out = in * scale.
+void ConvertToFloat_AVX2(const uint8_t * in, float * out, long numValues, float scale);
+void ConvertToFloat_AVX2(const uint16_t * in, float * out, long numValues, float scale);
+void ConvertHalfToFloat_AVX2(const uint16_t * in, float * out, long numValues);
+
+// Convert float values to integer or half values i.e. out = in * scale, where the integer values
+// are rounded and clamped to [0, maxValue] (NaN becomes 0).
+void ConvertFromFloat_AVX2(const float * in, uint8_t * out, long numValues,
+                           float scale, float maxValue);
+void ConvertFromFloat_AVX2(const float * in, uint16_t * out, long numValues,
+                           float scale, float maxValue);
+void ConvertFloatToHalf_AVX2(const float * in, uint16_t * out, long numValues);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
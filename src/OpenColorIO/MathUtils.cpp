@@ -159,6 +159,12 @@ float SanitizeFloat(float f)
     return f;
 }
 
+half SanitizeHalf(float f)
+{
+    // NaNs become 0.
+    return half(IsNan(f) ? 0.0f : Clamp(f, -HALF_MAX, HALF_MAX));
+}
+
 template<typename T>
 bool IsM44Identity(const T * m44)
 {
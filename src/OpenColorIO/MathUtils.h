@@ -75,6 +75,10 @@ inline T Clamp(T a, T min, T max)
 // Return the sanitized float
 float SanitizeFloat(float f);
 
+// Same as SanitizeFloat() but for half values i.e. the values outside the half domain are
+// clamped to -HALF_MAX & HALF_MAX (instead of becoming infinities) and NaN becomes 0.
+half SanitizeHalf(float f);
+
 // Checks within fltmin tolerance
 template<typename T>
 bool IsScalarEqualToZero(T v);
@@ -219,6 +223,21 @@ bool FloatsDiffer(const float expected, const float actual,
 // Inf is treated like any other value (diff from HALFMAX is 1).
 bool HalfsDiffer(const half expected, const half actual, const int tolerance);
 
+// Precision tiers of the log, exp & pow evaluations of the CPU renderers, selected by the
+// OPTIMIZATION_*_LOG_EXP_POW flags. Apart from LOG_EXP_POW_STD, the renderers use the SIMD
+// approximations when available (see SSE.h & AVX2.h).
+enum LogExpPowPrecision
+{
+    // The std:: functions. The renderers that are always vectorized use the accurate tier.
+    LOG_EXP_POW_STD = 0,
+    // Relative error of about 1e-7 i.e. close to the float rounding.
+    LOG_EXP_POW_ACCURATE,
+    // Relative error of about 1e-5.
+    LOG_EXP_POW_FAST,
+    // Relative error of about 1e-4.
+    LOG_EXP_POW_DRAFT
+};
+
 } // namespace OCIO_NAMESPACE
 
 #endif
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 
@@ -33,6 +34,44 @@ DynamicPropertyRcPtr OpCPU::getDynamicProperty(DynamicPropertyType type) const
     throw Exception("Op does not implement dynamic property.");
 }
 
+void OpCPU::applyPlanar(const float * const * in, float * const * out,
+                        long numPixels) const
+{
+    // Small enough to stay in the L1 cache.
+    static constexpr long BLOCK_PIXELS = 256;
+    float rgba[4 * BLOCK_PIXELS];
+
+    for (long first = 0; first < numPixels; first += BLOCK_PIXELS)
+    {
+        const long num = std::min(BLOCK_PIXELS, numPixels - first);
+
+        for (long idx = 0; idx < num; ++idx)
+        {
+            rgba[4 * idx + 0] = in[0][first + idx];
+            rgba[4 * idx + 1] = in[1][first + idx];
+            rgba[4 * idx + 2] = in[2][first + idx];
+            rgba[4 * idx + 3] = in[3] ? in[3][first + idx] : 0.0f;
+        }
+
+        apply(rgba, rgba, num);
+
+        for (long idx = 0; idx < num; ++idx)
+        {
+            out[0][first + idx] = rgba[4 * idx + 0];
+            out[1][first + idx] = rgba[4 * idx + 1];
+            out[2][first + idx] = rgba[4 * idx + 2];
+        }
+
+        if (out[3])
+        {
+            for (long idx = 0; idx < num; ++idx)
+            {
+                out[3][first + idx] = rgba[4 * idx + 3];
+            }
+        }
+    }
+}
+
 
 OpData::OpData()
     :   m_metadata()
@@ -12,6 +12,7 @@
 
 #include "DynamicProperty.h"
 #include "fileformats/FormatMetadata.h"
+#include "MathUtils.h"
 #include "Mutex.h"
 
 namespace OCIO_NAMESPACE
@@ -56,6 +57,13 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // Process planar 32-bit float pixels i.e. the R, G, B & A channels are separate planes,
+    // where in & out are arrays of four planes. The in & out planes could be the same planes, and both alpha planes are null when
+    // there is no alpha channel (i.e. the alpha values are then zero). The default
+    // implementation packs small blocks of pixels to RGBA in order to call apply().
+    virtual void applyPlanar(const float * const * in, float * const * out,
+                             long numPixels) const;
+
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
     virtual void unifyDynamicProperty(DynamicPropertyType type,
@@ -257,13 +265,13 @@ public:
     // internally, or rely on external caching, must thus be appropriately mutexed.
     //
     // Note: These apply calls are intended for unit test usage rather than general purpose
-    // use and so it is ok to hard-code the fastLogExpPow to false.
+    // use and so it is ok to hard-code the std:: log, exp & pow precision.
 
     virtual void apply(void * img, long numPixels) const
-    { getCPUOp(false)->apply(img, img, numPixels); }
+    { getCPUOp(LOG_EXP_POW_STD)->apply(img, img, numPixels); }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const
-    { getCPUOp(false)->apply(inImg, outImg, numPixels); }
+    { getCPUOp(LOG_EXP_POW_STD)->apply(inImg, outImg, numPixels); }
 
 
     // Is this op supported by the legacy shader text generator?
@@ -300,7 +308,7 @@ public:
     virtual void removeDynamicProperties() {}
 
     // On-demand creation of the OpCPU instance. Op has to be finalized.
-    virtual ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const = 0;
+    virtual ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const = 0;
 
     ConstOpDataRcPtr data() const { return std::const_pointer_cast<const OpData>(m_data); }
 
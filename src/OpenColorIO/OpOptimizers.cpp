@@ -2,6 +2,8 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <iterator>
 #include <sstream>
 
@@ -10,12 +12,31 @@
 #include "BitDepthUtils.h"
 #include "Logging.h"
 #include "Op.h"
+#include "ops/cdl/CDLOpData.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
+#include "ops/OpTools.h"
+#include "ops/range/RangeOpData.h"
 
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+// Half a 10-bit code value.
+std::atomic<float> g_lut3DBakeMaxError{ 0.5f / 1023.0f };
+}
+
+void SetLut3DBakeMaxError(float maxError)
+{
+    g_lut3DBakeMaxError = maxError;
+}
+
+float GetLut3DBakeMaxError()
+{
+    return g_lut3DBakeMaxError;
+}
+
 namespace
 {
 
@@ -127,6 +148,43 @@ int RemoveNoOps(OpRcPtrVec & opVec)
     return count;
 }
 
+// A clamping CDL op limits its output values to [0, 1], so a following Range op that does not
+// scale and whose bounds include [0, 1] does nothing. (Note that a Range following a Matrix
+// op does not cost a separate pass over the pixels either, see CreateCPUEngine().)
+int RemoveRedundantRanges(OpRcPtrVec & opVec)
+{
+    int count = 0;
+
+    size_t idx = 1;
+    while (idx < opVec.size())
+    {
+        ConstOpRcPtr prevOp = opVec[idx - 1];
+        ConstOpRcPtr op = opVec[idx];
+        ConstOpDataRcPtr prevData = prevOp->data();
+        ConstOpDataRcPtr data = op->data();
+
+        if (prevData->getType() == OpData::CDLType && data->getType() == OpData::RangeType)
+        {
+            ConstCDLOpDataRcPtr cdl = DynamicPtrCast<const CDLOpData>(prevData);
+            ConstRangeOpDataRcPtr range = DynamicPtrCast<const RangeOpData>(data);
+
+            if (cdl->isClamping() && range->getDirection() == TRANSFORM_DIR_FORWARD
+                && !range->scales()
+                && (range->minIsEmpty() || range->getMinOutValue() <= 0.)
+                && (range->maxIsEmpty() || range->getMaxOutValue() >= 1.))
+            {
+                opVec.erase(opVec.begin() + idx);
+                ++count;
+                continue;
+            }
+        }
+
+        ++idx;
+    }
+
+    return count;
+}
+
 void FinalizeOps(OpRcPtrVec & opVec)
 {
     for (auto op : opVec)
@@ -549,6 +607,238 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
 
     ops.insert(ops.begin(), lutOps.begin(), lutOps.end());
 }
+
+bool IsInexpensiveOp(const ConstOpRcPtr & op)
+{
+    const OpData::Type type = op->data()->getType();
+    return type == OpData::MatrixType || type == OpData::RangeType;
+}
+
+// Apply the ops to packed RGBA F32 pixels.
+void ApplyOps(const OpRcPtrVec & ops, float * rgba, long numPixels)
+{
+    for (const auto & op : ops)
+    {
+        op->apply(rgba, rgba, numPixels);
+    }
+}
+
+// Return the largest absolute difference between the results of the two lists of ops, for
+// input values sampled near the centers of the cells of a 3D LUT of gridSize.
+float ComputeMaxError(const OpRcPtrVec & ops, const OpRcPtrVec & bakedOps,
+                      BitDepth in, unsigned long gridSize)
+{
+    // Sample at most 32 cells per axis, the values being rounded to the input bit-depth as
+    // the ops only process integer code values.
+    const long numCells   = long(gridSize) - 1;
+    const long numSamples = std::min(numCells, 32L);
+    const float maxValue  = (float)GetBitDepthMaxValue(in);
+
+    std::vector<float> samples(numSamples);
+    for (long idx = 0; idx < numSamples; ++idx)
+    {
+        const long cell = idx * numCells / numSamples;
+        samples[idx] = std::round((float(cell) + 0.5f) / float(numCells) * maxValue) / maxValue;
+    }
+
+    const long numPixels = numSamples * numSamples * numSamples;
+
+    std::vector<float> ref(4 * numPixels);
+    long pxl = 0;
+    for (long r = 0; r < numSamples; ++r)
+    {
+        for (long g = 0; g < numSamples; ++g)
+        {
+            for (long b = 0; b < numSamples; ++b, ++pxl)
+            {
+                ref[4 * pxl + 0] = samples[r];
+                ref[4 * pxl + 1] = samples[g];
+                ref[4 * pxl + 2] = samples[b];
+                // Also detects the ops modifying the alpha channel (i.e. not baked).
+                ref[4 * pxl + 3] = samples[(r + g + b) % numSamples];
+            }
+        }
+    }
+
+    std::vector<float> baked(ref);
+
+    ApplyOps(ops, &ref[0], numPixels);
+    ApplyOps(bakedOps, &baked[0], numPixels);
+
+    float maxError = 0.0f;
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        const float error = std::fabs(ref[idx] - baked[idx]);
+        if (!(error <= maxError))
+        {
+            if (std::isnan(error))
+            {
+                return error;
+            }
+            maxError = error;
+        }
+    }
+
+    return maxError;
+}
+
+// Replace a list of ops with channel crosstalk by a 3D LUT preceded by a shaper 1D LUT (i.e.
+// the separable ops at the head of the list, if any), when the baked ops are within the
+// maximum error from the original ones.
+void BakeLut3D(OpRcPtrVec & ops, BitDepth in)
+{
+    // Only the integer bit-depths have a bounded input domain.
+    if (ops.empty() || IsFloatBitDepth(in) || in == BIT_DEPTH_UINT32)
+    {
+        return;
+    }
+
+    // The ops without channel crosstalk are already optimized by OptimizeSeparablePrefix().
+    if (ops.isDynamic() || !ops.hasChannelCrosstalk())
+    {
+        return;
+    }
+
+    // The 3D LUT must at least replace two expensive ops, and there is nothing to gain when
+    // the ops are already a 1D LUT followed by a 3D LUT.
+    unsigned expensiveOps = 0U;
+    for (const auto & op : ops)
+    {
+        if (!IsInexpensiveOp(op))
+        {
+            expensiveOps++;
+        }
+    }
+
+    if (expensiveOps < 2)
+    {
+        return;
+    }
+
+    if (ops.size() == 2)
+    {
+        ConstOpRcPtr op0 = ops[0];
+        ConstOpRcPtr op1 = ops[1];
+        if (op0->data()->getType() == OpData::Lut1DType
+            && op1->data()->getType() == OpData::Lut3DType)
+        {
+            return;
+        }
+    }
+
+    // The separable ops at the head of the list become the shaper, unless they are only
+    // inexpensive ones (i.e. they are then baked in the 3D LUT).
+
+    OpRcPtrVec::size_type prefixLen = 0;
+    bool expensivePrefix = false;
+    while (prefixLen < ops.size() && !ops[prefixLen]->hasChannelCrosstalk())
+    {
+        expensivePrefix = expensivePrefix || !IsInexpensiveOp(ops[prefixLen]);
+        prefixLen++;
+    }
+
+    if (!expensivePrefix)
+    {
+        prefixLen = 0;
+    }
+
+    OpRcPtrVec shaperOps;
+
+    // The shaper values are normalized to [0, 1] i.e. the domain of the 3D LUT.
+    float shaperMin[3]   = { 0.0f, 0.0f, 0.0f };
+    float shaperScale[3] = { 1.0f, 1.0f, 1.0f };
+
+    if (prefixLen > 0)
+    {
+        OpRcPtrVec prefixOps;
+        for (OpRcPtrVec::size_type i = 0; i < prefixLen; ++i)
+        {
+            prefixOps.push_back(ops[i]->clone());
+        }
+
+        Lut1DOpDataRcPtr shaper = Lut1DOpData::MakeLookupDomain(in);
+        Lut1DOpData::ComposeVec(shaper, prefixOps);
+
+        Array::Values & values = shaper->getArray().getValues();
+        const unsigned long length = shaper->getArray().getLength();
+
+        for (unsigned long chan = 0; chan < 3; ++chan)
+        {
+            float minValue = values[chan];
+            float maxValue = values[chan];
+            for (unsigned long idx = 0; idx < length; ++idx)
+            {
+                const float value = values[3 * idx + chan];
+                if (!std::isfinite(value))
+                {
+                    return;
+                }
+                minValue = std::min(minValue, value);
+                maxValue = std::max(maxValue, value);
+            }
+
+            shaperMin[chan]   = minValue;
+            shaperScale[chan] = maxValue > minValue ? maxValue - minValue : 1.0f;
+
+            for (unsigned long idx = 0; idx < length; ++idx)
+            {
+                values[3 * idx + chan] = (values[3 * idx + chan] - shaperMin[chan]) / shaperScale[chan];
+            }
+        }
+
+        CreateLut1DOp(shaperOps, shaper, TRANSFORM_DIR_FORWARD);
+    }
+
+    const float maxError = GetLut3DBakeMaxError();
+
+    // Use the smallest grid size within the maximum error.
+    for (unsigned long gridSize : { 17UL, 33UL, 65UL })
+    {
+        Lut3DOpDataRcPtr lut = std::make_shared<Lut3DOpData>(INTERP_TETRAHEDRAL, gridSize);
+
+        // Send the domain of the 3D LUT (i.e. the range of the shaper) through the other ops.
+
+        Array::Values & values = lut->getArray().getValues();
+        const long numPixels = long(gridSize * gridSize * gridSize);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (long chan = 0; chan < 3; ++chan)
+            {
+                values[3 * idx + chan] = shaperMin[chan] + values[3 * idx + chan] * shaperScale[chan];
+            }
+        }
+
+        OpRcPtrVec lutOps;
+        for (OpRcPtrVec::size_type i = prefixLen; i < ops.size(); ++i)
+        {
+            lutOps.push_back(ops[i]->clone());
+        }
+
+        EvalTransform((const float *)(&values[0]), (float *)(&values[0]), numPixels, lutOps);
+
+        OpRcPtrVec bakedOps = shaperOps.clone();
+        CreateLut3DOp(bakedOps, lut, TRANSFORM_DIR_FORWARD);
+        FinalizeOps(bakedOps);
+
+        const float error = ComputeMaxError(ops, bakedOps, in, gridSize);
+
+        if (IsDebugLoggingEnabled())
+        {
+            std::ostringstream oss;
+            oss << "Baking " << ops.size() << " ops to a 3D LUT of grid size " << gridSize
+                << (prefixLen > 0 ? " with" : " without") << " shaper: max error of "
+                << error << " for " << maxError << ".";
+            LogDebug(oss.str());
+        }
+
+        if (error <= maxError)
+        {
+            ops = bakedOps;
+            return;
+        }
+    }
+}
 } // namespace
 
 void OpRcPtrVec::finalize(OptimizationFlags oFlags)
@@ -623,6 +913,7 @@ void OpRcPtrVec::finalize(OptimizationFlags oFlags)
     while (passes <= MAX_OPTIMIZATION_PASSES)
     {
         int noops = optimizeIdentity ? RemoveNoOps(*this) : 0;
+        noops += optimizeIdentity ? RemoveRedundantRanges(*this) : 0;
         // Note this might increase the number of ops.
         int replacedOps = replaceOps ? ReplaceOps(*this) : 0;
         int identityops = ReplaceIdentityOps(*this, oFlags);
@@ -705,6 +996,10 @@ void OpRcPtrVec::optimizeForBitdepth(const BitDepth & inBitDepth,
         {
             RemoveTrailingClampIdentity(*this);
         }
+        if (HasFlag(oFlags, OPTIMIZATION_BAKE_LUT3D))
+        {
+            BakeLut3D(*this, inBitDepth);
+        }
         if (HasFlag(oFlags, OPTIMIZATION_COMP_SEPARABLE_PREFIX))
         {
             OptimizeSeparablePrefix(*this, inBitDepth);
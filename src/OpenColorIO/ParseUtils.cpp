@@ -359,6 +359,8 @@ const char * FixedFunctionStyleToString(FixedFunctionStyle style)
         case FIXED_FUNCTION_XYZ_TO_xyY:          return "XYZ_TO_xyY";
         case FIXED_FUNCTION_XYZ_TO_uvY:          return "XYZ_TO_uvY";
         case FIXED_FUNCTION_XYZ_TO_LUV:          return "XYZ_TO_LUV";
+        case FIXED_FUNCTION_LIN_TO_PQ:           return "LIN_TO_PQ";
+        case FIXED_FUNCTION_LIN_TO_HLG:          return "LIN_TO_HLG";
     }
 
     // Default style is meaningless.
@@ -379,6 +381,8 @@ FixedFunctionStyle FixedFunctionStyleFromString(const char * style)
     else if(str == "xyz_to_xyy")         return FIXED_FUNCTION_XYZ_TO_xyY;
     else if(str == "xyz_to_uvy")         return FIXED_FUNCTION_XYZ_TO_uvY;
     else if(str == "xyz_to_luv")         return FIXED_FUNCTION_XYZ_TO_LUV;
+    else if(str == "lin_to_pq")          return FIXED_FUNCTION_LIN_TO_PQ;
+    else if(str == "lin_to_hlg")         return FIXED_FUNCTION_LIN_TO_HLG;
 
     // Default style is meaningless.
     std::stringstream ss;
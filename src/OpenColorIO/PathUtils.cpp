@@ -77,6 +77,14 @@ typedef std::map<std::string, FileHashResultPtr> FileCacheMap;
 
 FileCacheMap g_fastFileHashCache;
 Mutex g_fastFileHashCache_mutex;
+// The entries & bytes members are the ones of the complete map.
+CacheStats g_fastFileHashCacheStats;
+
+// The hash itself is not counted as it is computed outside the map lock.
+size_t EstimateFileHashEntrySize(const std::string & filename)
+{
+    return filename.size() + sizeof(FileHashResult);
+}
 }
 
 void SetComputeHashFunction(ComputeHashFunction hashFunction)
@@ -97,10 +105,16 @@ std::string GetFastFileHash(const std::string & filename)
         FileCacheMap::iterator iter = g_fastFileHashCache.find(filename);
         if(iter != g_fastFileHashCache.end())
         {
+            ++g_fastFileHashCacheStats.m_hits;
             fileHashResultPtr = iter->second;
         }
         else
         {
+            ++g_fastFileHashCacheStats.m_misses;
+            ++g_fastFileHashCacheStats.m_inserts;
+            ++g_fastFileHashCacheStats.m_entries;
+            g_fastFileHashCacheStats.m_bytes += EstimateFileHashEntrySize(filename);
+
             fileHashResultPtr = std::make_shared<FileHashResult>();
             g_fastFileHashCache[filename] = fileHashResultPtr;
         }
@@ -133,6 +147,24 @@ void ClearPathCaches()
 {
     AutoMutex lock(g_fastFileHashCache_mutex);
     g_fastFileHashCache.clear();
+    g_fastFileHashCacheStats.m_entries = 0;
+    g_fastFileHashCacheStats.m_bytes   = 0;
+}
+
+CacheStats GetFileHashCacheStats()
+{
+    AutoMutex lock(g_fastFileHashCache_mutex);
+    return g_fastFileHashCacheStats;
+}
+
+void ResetPathCacheStats()
+{
+    AutoMutex lock(g_fastFileHashCache_mutex);
+
+    const CacheStats stats = g_fastFileHashCacheStats;
+    g_fastFileHashCacheStats = CacheStats();
+    g_fastFileHashCacheStats.m_entries = stats.m_entries;
+    g_fastFileHashCacheStats.m_bytes   = stats.m_bytes;
 }
 
 namespace
@@ -26,6 +26,9 @@ std::string GetFastFileHash(const std::string & filename);
 
 void ClearPathCaches();
 
+// Reset the counters of the file hash cache, see GetFileHashCacheStats().
+void ResetPathCacheStats();
+
 int ParseColorSpaceFromString(const Config & config, const char * str);
 
 } // namespace OCIO_NAMESPACE
@@ -12,6 +12,8 @@
 #include "GPUProcessor.h"
 #include "HashUtils.h"
 #include "OpBuilders.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "Processor.h"
 #include "TransformBuilder.h"
 #include "transforms/FileTransform.h"
@@ -230,6 +232,26 @@ ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
     return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
 }
 
+CacheStats Processor::getOptimizedProcessorCacheStats() const
+{
+    return getImpl()->getOptimizedProcessorCacheStats();
+}
+
+CacheStats Processor::getGPUProcessorCacheStats() const
+{
+    return getImpl()->getGPUProcessorCacheStats();
+}
+
+CacheStats Processor::getCPUProcessorCacheStats() const
+{
+    return getImpl()->getCPUProcessorCacheStats();
+}
+
+void Processor::resetCacheStats() const noexcept
+{
+    getImpl()->resetCacheStats();
+}
+
 
 // Instantiate the cache with the right types.
 template class ProcessorCache<std::size_t, ProcessorRcPtr>;
@@ -387,6 +409,27 @@ const char * Processor::Impl::getCacheID() const
     return m_cacheID.c_str();
 }
 
+size_t Processor::Impl::getMemorySizeEstimate() const
+{
+    // Only the LUT arrays are counted as they are by far the largest op data.
+    size_t bytes = sizeof(Impl);
+    for (ConstOpRcPtr op : m_ops)
+    {
+        ConstOpDataRcPtr data = op->data();
+        if (data->getType() == OpData::Lut1DType)
+        {
+            ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(data);
+            bytes += lut->getArray().getNumValues() * sizeof(float);
+        }
+        else if (data->getType() == OpData::Lut3DType)
+        {
+            ConstLut3DOpDataRcPtr lut = DynamicPtrCast<const Lut3DOpData>(data);
+            bytes += lut->getArray().getNumValues() * sizeof(float);
+        }
+    }
+    return bytes;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 namespace
@@ -437,6 +480,11 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
 
         std::ostringstream oss;
         oss << inBitDepth << outBitDepth << oFlags;
+        if (HasFlag(oFlags, OPTIMIZATION_BAKE_LUT3D))
+        {
+            // The bake also depends on the maximum error.
+            oss << GetLut3DBakeMaxError();
+        }
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
@@ -540,6 +588,11 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
 
         std::ostringstream oss;
         oss << inBitDepth << outBitDepth << oFlags;
+        if (HasFlag(oFlags, OPTIMIZATION_BAKE_LUT3D))
+        {
+            // The bake also depends on the maximum error.
+            oss << GetLut3DBakeMaxError();
+        }
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
@@ -570,6 +623,28 @@ void Processor::Impl::setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept
     m_cpuProcessorCache.enable(cacheEnabled);
 }
 
+CacheStats Processor::Impl::getOptimizedProcessorCacheStats() const
+{
+    return m_optProcessorCache.getStats();
+}
+
+CacheStats Processor::Impl::getGPUProcessorCacheStats() const
+{
+    return m_gpuProcessorCache.getStats();
+}
+
+CacheStats Processor::Impl::getCPUProcessorCacheStats() const
+{
+    return m_cpuProcessorCache.getStats();
+}
+
+void Processor::Impl::resetCacheStats() const noexcept
+{
+    m_optProcessorCache.resetStats();
+    m_gpuProcessorCache.resetStats();
+    m_cpuProcessorCache.resetStats();
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 
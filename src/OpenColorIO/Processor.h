@@ -56,6 +56,9 @@ public:
 
     const char * getCacheID() const;
 
+    // Estimate the memory size of the processor, for the processor cache capacity in bytes.
+    size_t getMemorySizeEstimate() const;
+
     GroupTransformRcPtr createGroupTransform() const;
 
     void write(const char * formatName, std::ostream & os) const;
@@ -86,6 +89,12 @@ public:
     // Enable or disable the internal caches.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
+    // Get the usage statistics of the internal caches.
+    CacheStats getOptimizedProcessorCacheStats() const;
+    CacheStats getGPUProcessorCacheStats() const;
+    CacheStats getCPUProcessorCacheStats() const;
+    void resetCacheStats() const noexcept;
+
     ////////////////////////////////////////////
     //
     // Builder functions, Not exposed
@@ -10,11 +10,16 @@
 
 
 #include <emmintrin.h>
+#include <limits>
+#include <memory>
 #include <stdio.h>
+#include <utility>
 
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "MathUtils.h"
+
 
 
 namespace OCIO_NAMESPACE
@@ -271,6 +276,250 @@ inline __m128 ssePower(__m128 x, __m128 exp)
     return values;
 }
 
+// Draft log2, exp2 and power functions in SSE version 2
+//
+// Same argument reductions as sseLog2() and sseExp2() but with Chebyshev (minimax) polynomials
+// of degree 4 for log2() (absolute error of 8.8e-5) and of degree 3 for exp2() (relative error
+// of 7.5e-5). The relative error of the power function is thus about 1.4e-4 for exponents
+// close to 1. See OPTIMIZATION_DRAFT_LOG_EXP_POW.
+inline __m128 sseLog2Draft(__m128 x)
+{
+    const __m128 mantissa
+        = _mm_or_ps(_mm_andnot_ps(_mm_castsi128_ps(EMASK), x), EONE);
+
+    __m128 log2 = _mm_set1_ps((float)-8.161581241586652e-2);
+    log2 = _mm_add_ps(_mm_mul_ps(log2, mantissa), _mm_set1_ps((float)+6.451423870703817e-1));
+    log2 = _mm_add_ps(_mm_mul_ps(log2, mantissa), _mm_set1_ps((float)-2.120675182919779));
+    log2 = _mm_add_ps(_mm_mul_ps(log2, mantissa), _mm_set1_ps((float)+4.070090841774721));
+    log2 = _mm_add_ps(_mm_mul_ps(log2, mantissa), _mm_set1_ps((float)-2.512854641644485));
+
+    const __m128i exponent
+        = _mm_sub_epi32(
+            _mm_srli_epi32(_mm_and_si128(_mm_castps_si128(x), EMASK), EXP_SHIFT), EBIAS);
+
+    return _mm_add_ps(log2, _mm_cvtepi32_ps(exponent));
+}
+
+inline __m128 sseExp2Draft(__m128 x)
+{
+    // Same integer part, underflow and overflow handling as sseExp2().
+    const __m128i floor_x
+        = _mm_add_epi32(_mm_cvttps_epi32(x), _mm_castps_si128(_mm_cmpnle_ps(EZERO, x)));
+
+    const __m128 zf
+        = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(floor_x, EBIAS), EXP_SHIFT));
+
+    const __m128 iexp = _mm_cvtepi32_ps(floor_x);
+    const __m128 fraction = _mm_sub_ps(x, iexp);
+
+    __m128 mexp = _mm_set1_ps((float)7.802452268953215e-2);
+    mexp = _mm_add_ps(_mm_mul_ps(mexp, fraction), _mm_set1_ps((float)2.260671553970901e-1));
+    mexp = _mm_add_ps(_mm_mul_ps(mexp, fraction), _mm_set1_ps((float)6.958335404792920e-1));
+    mexp = _mm_add_ps(_mm_mul_ps(mexp, fraction), _mm_set1_ps((float)9.999252185659142e-1));
+
+    __m128 exp2 = _mm_mul_ps(zf, mexp);
+    exp2 = _mm_andnot_ps(_mm_cmplt_ps(iexp, ENEG126), exp2);
+    return sseSelect(_mm_cmpgt_ps(iexp, EPOS127), EPOSINF, exp2);
+}
+
+inline __m128 ssePowerDraft(__m128 x, __m128 exp)
+{
+    const __m128 values = sseExp2Draft(_mm_mul_ps(exp, sseLog2Draft(x)));
+
+    // Handle values where base is smaller or equal than zero.
+    return _mm_and_ps(values, _mm_cmpgt_ps(x, EZERO));
+}
+
+// Accurate log2, exp2 and power functions in SSE version 2
+//
+// The polynomials are evaluated in double precision so the only significant error is the
+// rounding of the results to float i.e. a relative error of about 6e-8 (and at most 1.2e-7).
+// As the product of the power function is also computed in double precision, its precision
+// does not depend on the magnitude of the exponent. See OPTIMIZATION_ACCURATE_LOG_EXP_POW.
+//
+// Unlike the approximations above, the denormal values are supported, and exp2() returns
+// denormal values rather than zero on underflow.
+
+// Evaluate log2(x) of the four positive finite values as two pairs of doubles.
+inline void sseLog2Accurate(const __m128 x, __m128d & log2Lo, __m128d & log2Hi)
+{
+    // Normalize the denormal values.
+    const __m128 denorm = _mm_cmplt_ps(x, _mm_set1_ps(std::numeric_limits<float>::min()));
+    const __m128 xn = sseSelect(denorm, _mm_mul_ps(x, _mm_set1_ps(8388608.0f)), x);
+
+    // x = 2^exponent * mantissa with mantissa in [sqrt(0.5), sqrt(2)[.
+    __m128 mantissa = _mm_or_ps(_mm_andnot_ps(_mm_castsi128_ps(EMASK), xn), EONE);
+    __m128i exponent
+        = _mm_sub_epi32(
+            _mm_srli_epi32(_mm_and_si128(_mm_castps_si128(xn), EMASK), EXP_SHIFT), EBIAS);
+    exponent = _mm_sub_epi32(exponent,
+                             _mm_and_si128(_mm_castps_si128(denorm), _mm_set1_epi32(23)));
+
+    const __m128 upper = _mm_cmpge_ps(mantissa, _mm_set1_ps(1.41421356f));
+    mantissa = sseSelect(upper, _mm_mul_ps(mantissa, _mm_set1_ps(0.5f)), mantissa);
+    exponent = _mm_sub_epi32(exponent, _mm_castps_si128(upper));
+
+    const __m128 fexp = _mm_cvtepi32_ps(exponent);
+
+    // log(m) = 2 * atanh(s) = 2 * (s + s^3/3 + s^5/5 + ...) where s = (m-1) / (m+1) is in
+    // [-0.172, 0.172] so the truncation error is below 1e-9.
+    const auto log2Pair = [](const __m128d m, const __m128d e)
+    {
+        const __m128d one = _mm_set1_pd(1.0);
+        const __m128d s   = _mm_div_pd(_mm_sub_pd(m, one), _mm_add_pd(m, one));
+        const __m128d s2  = _mm_mul_pd(s, s);
+
+        __m128d poly = _mm_set1_pd(1.0 / 9.0);
+        poly = _mm_add_pd(_mm_mul_pd(poly, s2), _mm_set1_pd(1.0 / 7.0));
+        poly = _mm_add_pd(_mm_mul_pd(poly, s2), _mm_set1_pd(1.0 / 5.0));
+        poly = _mm_add_pd(_mm_mul_pd(poly, s2), _mm_set1_pd(1.0 / 3.0));
+        poly = _mm_add_pd(_mm_mul_pd(poly, s2), one);
+
+        // 2 / log(2).
+        const __m128d k = _mm_set1_pd(2.8853900817779268);
+        return _mm_add_pd(e, _mm_mul_pd(_mm_mul_pd(s, poly), k));
+    };
+
+    log2Lo = log2Pair(_mm_cvtps_pd(mantissa), _mm_cvtps_pd(fexp));
+    log2Hi = log2Pair(_mm_cvtps_pd(_mm_movehl_ps(mantissa, mantissa)),
+                      _mm_cvtps_pd(_mm_movehl_ps(fexp, fexp)));
+}
+
+// Evaluate exp2(x) for a pair of doubles.
+inline __m128d sseExp2Accurate(__m128d x)
+{
+    // Clamp to the range of the float results (NaNs are preserved).
+    x = _mm_min_pd(_mm_set1_pd(129.0), _mm_max_pd(_mm_set1_pd(-151.0), x));
+
+    // exp2(x) = exp2(n) * exp2(f) with n = round(x) and f in [-0.5, 0.5].
+    const __m128i n = _mm_cvtpd_epi32(x);
+    const __m128d f = _mm_mul_pd(_mm_sub_pd(x, _mm_cvtepi32_pd(n)),
+                                 _mm_set1_pd(0.69314718055994531));
+
+    // Taylor series of exp(f * log(2)), the truncation error is below 3e-10.
+    __m128d poly = _mm_set1_pd(1.0 / 40320.0);
+    poly = _mm_add_pd(_mm_mul_pd(poly, f), _mm_set1_pd(1.0 / 5040.0));
+    poly = _mm_add_pd(_mm_mul_pd(poly, f), _mm_set1_pd(1.0 / 720.0));
+    poly = _mm_add_pd(_mm_mul_pd(poly, f), _mm_set1_pd(1.0 / 120.0));
+    poly = _mm_add_pd(_mm_mul_pd(poly, f), _mm_set1_pd(1.0 / 24.0));
+    poly = _mm_add_pd(_mm_mul_pd(poly, f), _mm_set1_pd(1.0 / 6.0));
+    poly = _mm_add_pd(_mm_mul_pd(poly, f), _mm_set1_pd(0.5));
+    poly = _mm_add_pd(_mm_mul_pd(poly, f), _mm_set1_pd(1.0));
+    poly = _mm_add_pd(_mm_mul_pd(poly, f), _mm_set1_pd(1.0));
+
+    // Compute exp2(n) by moving n to the exponent bits of the double.
+    const __m128i bits
+        = _mm_slli_epi64(
+            _mm_unpacklo_epi32(_mm_add_epi32(n, _mm_set1_epi32(1023)), _mm_setzero_si128()), 52);
+
+    return _mm_mul_pd(poly, _mm_castsi128_pd(bits));
+}
+
+// Pack two pairs of doubles into four floats.
+inline __m128 ssePackDoubles(const __m128d lo, const __m128d hi)
+{
+    return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+}
+
+// Unlike sseLog2(), log2(0) is -Inf, log2(Inf) is Inf, and the negative values and NaNs
+// return NaN.
+inline __m128 sseLog2Accurate(__m128 x)
+{
+    __m128d lo, hi;
+    sseLog2Accurate(x, lo, hi);
+    __m128 log2 = ssePackDoubles(lo, hi);
+
+    log2 = sseSelect(_mm_cmpeq_ps(x, EZERO), _mm_sub_ps(EZERO, EPOSINF), log2);
+    log2 = sseSelect(_mm_cmpeq_ps(x, EPOSINF), EPOSINF, log2);
+    return _mm_or_ps(log2, _mm_cmpnge_ps(x, EZERO));
+}
+
+inline __m128 sseExp2Accurate(__m128 x)
+{
+    return ssePackDoubles(sseExp2Accurate(_mm_cvtps_pd(x)),
+                          sseExp2Accurate(_mm_cvtps_pd(_mm_movehl_ps(x, x))));
+}
+
+// As ssePower(), results from base values smaller than zero (or NaN) are mapped to zero.
+inline __m128 ssePowerAccurate(__m128 x, __m128 exp)
+{
+    __m128d lo, hi;
+    sseLog2Accurate(x, lo, hi);
+
+    lo = sseExp2Accurate(_mm_mul_pd(lo, _mm_cvtps_pd(exp)));
+    hi = sseExp2Accurate(_mm_mul_pd(hi, _mm_cvtps_pd(_mm_movehl_ps(exp, exp))));
+    __m128 values = ssePackDoubles(lo, hi);
+
+    // pow(Inf, exp) is Inf, 1 or 0 for a positive, null or negative exponent.
+    const __m128 infPow = sseSelect(_mm_cmpgt_ps(exp, EZERO), EPOSINF,
+                                    _mm_and_ps(EONE, _mm_cmpeq_ps(exp, EZERO)));
+    values = sseSelect(_mm_cmpeq_ps(x, EPOSINF), infPow, values);
+
+    // Handle values where base is smaller or equal than zero.
+    return _mm_and_ps(values, _mm_cmpgt_ps(x, EZERO));
+}
+
+// The sets of log2, exp2 and power functions of the precision tiers, to be used as template
+// parameters of the SSE renderers.
+struct SSEDraftMath
+{
+    static inline __m128 Log2(__m128 x) { return sseLog2Draft(x); }
+    static inline __m128 Exp2(__m128 x) { return sseExp2Draft(x); }
+    static inline __m128 Power(__m128 x, __m128 exp) { return ssePowerDraft(x, exp); }
+};
+
+struct SSEFastMath
+{
+    static inline __m128 Log2(__m128 x) { return sseLog2(x); }
+    static inline __m128 Exp2(__m128 x) { return sseExp2(x); }
+    static inline __m128 Power(__m128 x, __m128 exp) { return ssePower(x, exp); }
+};
+
+struct SSEAccurateMath
+{
+    static inline __m128 Log2(__m128 x) { return sseLog2Accurate(x); }
+    static inline __m128 Exp2(__m128 x) { return sseExp2Accurate(x); }
+    static inline __m128 Power(__m128 x, __m128 exp) { return ssePowerAccurate(x, exp); }
+};
+
+// Create the renderer R<Math> where Math is the set of functions of the precision tier. The
+// accurate functions are used for LOG_EXP_POW_STD.
+template<typename Base, template<typename> class R, typename... Args>
+std::shared_ptr<const Base> MakeSSERenderer(LogExpPowPrecision precision, Args &&... args)
+{
+    switch (precision)
+    {
+        case LOG_EXP_POW_DRAFT:
+            return std::make_shared<R<SSEDraftMath>>(std::forward<Args>(args)...);
+        case LOG_EXP_POW_FAST:
+            return std::make_shared<R<SSEFastMath>>(std::forward<Args>(args)...);
+        case LOG_EXP_POW_STD:
+        case LOG_EXP_POW_ACCURATE:
+            break;
+    }
+    return std::make_shared<R<SSEAccurateMath>>(std::forward<Args>(args)...);
+}
+
+// Call the kernel K<Math>::Apply() where Math is the set of functions of the precision tier.
+// The accurate functions are used for LOG_EXP_POW_STD.
+template<template<typename> class K, typename... Args>
+inline void sseApplyPrecision(LogExpPowPrecision precision, Args &&... args)
+{
+    switch (precision)
+    {
+        case LOG_EXP_POW_DRAFT:
+            K<SSEDraftMath>::Apply(std::forward<Args>(args)...);
+            return;
+        case LOG_EXP_POW_FAST:
+            K<SSEFastMath>::Apply(std::forward<Args>(args)...);
+            return;
+        case LOG_EXP_POW_STD:
+        case LOG_EXP_POW_ACCURATE:
+            break;
+    }
+    K<SSEAccurateMath>::Apply(std::forward<Args>(args)...);
+}
+
 static const __m128 ESIGN_MASK = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
 static const __m128 EABS_MASK  = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
 
@@ -25,16 +25,26 @@ Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc)
             optim = PACKED_FLOAT_OPTIMIZATION;
         }
     }
+    else if(imgDesc.isFloat() && imgDesc.m_xStrideBytes==ptrdiff_t(sizeof(float)))
+    {
+        optim = PLANAR_FLOAT_OPTIMIZATION;
+    }
 
     return optim;
 }
 
+long GetNumBlockPixels(long blockSize, long width)
+{
+    return (blockSize > 0 && blockSize < width) ? blockSize : width;
+}
+
 
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitDepth,
                                                               const ConstOpCPURcPtr & inBitDepthOp,
                                                               BitDepth outputBitDepth,
-                                                              const ConstOpCPURcPtr & outBitDepthOp)
+                                                              const ConstOpCPURcPtr & outBitDepthOp,
+                                                              long blockSize)
     :   ScanlineHelper()
     ,   m_inputBitDepth(inputBitDepth)
     ,   m_outputBitDepth(outputBitDepth)
@@ -42,24 +52,63 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
     ,   m_outBitDepthOp(outBitDepthOp)
     ,   m_inOptimizedMode(NO_OPTIMIZATION)
     ,   m_outOptimizedMode(NO_OPTIMIZATION)
+    ,   m_blockSize(blockSize)
+    ,   m_numBlockPixels(0)
+    ,   m_numPixels(0)
+    ,   m_xIndex(0)
     ,   m_yIndex(0)
+    ,   m_yEnd(0)
     ,   m_useDstBuffer(false)
+    ,   m_usePlanar(false)
 {
 }
 
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, const ImageDesc & dstImg)
 {
+    initImages(srcImg, nullptr, dstImg, nullptr);
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
+{
+    initImage(img, nullptr);
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, const ImageROI & srcROI,
+                                                  const ImageDesc & dstImg, const ImageROI & dstROI)
+{
+    initImages(srcImg, &srcROI, dstImg, &dstROI);
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img, const ImageROI & roi)
+{
+    initImage(img, &roi);
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::initImages(const ImageDesc & srcImg,
+                                                        const ImageROI * srcROI,
+                                                        const ImageDesc & dstImg,
+                                                        const ImageROI * dstROI)
+{
+    m_xIndex = 0;
     m_yIndex = 0;
 
-    m_srcImg.init(srcImg, m_inputBitDepth, m_inBitDepthOp);
-    m_dstImg.init(dstImg, m_outputBitDepth, m_outBitDepthOp);
+    m_srcImg.init(srcImg, m_inputBitDepth, m_inBitDepthOp, srcROI);
+    m_dstImg.init(dstImg, m_outputBitDepth, m_outBitDepthOp, dstROI);
 
     if(m_srcImg.m_width!=m_dstImg.m_width || m_srcImg.m_height!=m_dstImg.m_height)
     {
         throw Exception("Dimension inconsistency between source and destination image buffers.");
     }
 
+    m_yEnd = m_dstImg.m_height;
+
+    m_numBlockPixels = GetNumBlockPixels(m_blockSize, m_dstImg.m_width);
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = GetOptimizationMode(m_dstImg);
 
@@ -67,27 +116,43 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
+    // Can the planes be processed without packing the pixels?
+    m_usePlanar
+        = (m_inOptimizedMode & PLANAR_FLOAT_OPTIMIZATION) == PLANAR_FLOAT_OPTIMIZATION
+            && (m_outOptimizedMode & PLANAR_FLOAT_OPTIMIZATION) == PLANAR_FLOAT_OPTIMIZATION
+            && (m_srcImg.m_aData==nullptr) == (m_dstImg.m_aData==nullptr);
+
+    if(m_usePlanar)
+    {
+        return;
+    }
+
     if( (m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
+        const long bufferSize = 4 * m_numBlockPixels;
         m_inBitDepthBuffer.resize(bufferSize);
     }
 
     if(!m_useDstBuffer)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
+        const long bufferSize = 4 * m_numBlockPixels;
         m_rgbaFloatBuffer.resize(bufferSize);
         m_outBitDepthBuffer.resize(bufferSize);
     }
 }
 
 template<typename InType, typename OutType>
-void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
+void GenericScanlineHelper<InType, OutType>::initImage(const ImageDesc & img, const ImageROI * roi)
 {
+    m_xIndex = 0;
     m_yIndex = 0;
 
-    m_srcImg.init(img, m_inputBitDepth, m_inBitDepthOp);
-    m_dstImg.init(img, m_outputBitDepth, m_outBitDepthOp);
+    m_srcImg.init(img, m_inputBitDepth, m_inBitDepthOp, roi);
+    m_dstImg.init(img, m_outputBitDepth, m_outBitDepthOp, roi);
+
+    m_yEnd = m_dstImg.m_height;
+
+    m_numBlockPixels = GetNumBlockPixels(m_blockSize, m_dstImg.m_width);
 
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = m_inOptimizedMode;
@@ -96,12 +161,14 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
-    if(!m_useDstBuffer)
+    // Can the planes be processed without packing the pixels?
+    m_usePlanar = (m_outOptimizedMode & PLANAR_FLOAT_OPTIMIZATION) == PLANAR_FLOAT_OPTIMIZATION;
+
+    if(!m_useDstBuffer && !m_usePlanar)
     {
-        // TODO: Re-use memory from thread-safe memory pool, rather
-        // than doing a new allocation each time.
+        // Note that the buffers only grow when the helper is reused (see reset()).
 
-        const long bufferSize = 4 * m_dstImg.m_width;
+        const long bufferSize = 4 * m_numBlockPixels;
 
         m_rgbaFloatBuffer.resize(bufferSize);
         m_inBitDepthBuffer.resize(bufferSize);
@@ -109,6 +176,39 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     }
 }
 
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::reset(const ConstOpCPURcPtr & inBitDepthOp,
+                                                   const ConstOpCPURcPtr & outBitDepthOp,
+                                                   long blockSize)
+{
+    m_inBitDepthOp  = inBitDepthOp;
+    m_outBitDepthOp = outBitDepthOp;
+    m_blockSize     = blockSize;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::release()
+{
+    m_inBitDepthOp  = nullptr;
+    m_outBitDepthOp = nullptr;
+
+    m_srcImg.m_bitDepthOp = nullptr;
+    m_dstImg.m_bitDepthOp = nullptr;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::setLineRange(long yBegin, long yEnd)
+{
+    if(yBegin<0 || yBegin>yEnd || yEnd>m_dstImg.m_height)
+    {
+        throw Exception("Invalid line range for the image buffer.");
+    }
+
+    m_xIndex = 0;
+    m_yIndex = yBegin;
+    m_yEnd   = yEnd;
+}
+
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 {
@@ -118,22 +218,28 @@ GenericScanlineHelper<InType, OutType>::~GenericScanlineHelper()
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, long & numPixels)
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that the image buffer is processed line-by-line, each line being processed
+    // in blocks of at most m_numBlockPixels pixels.
 
-    if(m_yIndex >= m_dstImg.m_height)
+    if(m_yIndex >= m_yEnd)
     {
         numPixels = 0;
         return;
     }
 
-    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex)
+    // The last block of a line could be smaller.
+    m_numPixels = std::min(m_numBlockPixels, m_dstImg.m_width - m_xIndex);
+
+    *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex
+                                                         + m_dstImg.m_xStrideBytes * m_xIndex)
                              : &m_rgbaFloatBuffer[0];
 
     if((m_inOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        const void * inBuffer = (void*)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex);
+        const void * inBuffer = (void*)(m_srcImg.m_rData + m_srcImg.m_yStrideBytes * m_yIndex
+                                                         + m_srcImg.m_xStrideBytes * m_xIndex);
 
-        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_dstImg.m_width);
+        m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_numPixels);
     }
     else
     {
@@ -142,26 +248,28 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
         Generic<InType>::PackRGBAFromImageDesc(m_srcImg,
                                                &m_inBitDepthBuffer[0],
                                                *buffer,
-                                               m_dstImg.m_width,
-                                               m_yIndex * m_dstImg.m_width);
+                                               m_numPixels,
+                                               m_yIndex * m_dstImg.m_width + m_xIndex);
     }
 
-    numPixels = m_dstImg.m_width;
+    numPixels = m_numPixels;
 }
 
 // Write back the result of our work, from the scanline to our destination image.
 template<typename InType, typename OutType>
 void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
 {
-    // Note that only a line-by-line processing is done on the image buffer.
+    // Note that the image buffer is processed line-by-line, each line being processed
+    // in blocks of at most m_numBlockPixels pixels.
 
     if((m_outOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
-        void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex);
+        void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex
+                                              + m_dstImg.m_xStrideBytes * m_xIndex);
 
         const void * in  = m_useDstBuffer ? out : (void*)&m_rgbaFloatBuffer[0];
 
-        m_dstImg.m_bitDepthOp->apply(in, out, m_dstImg.m_width);
+        m_dstImg.m_bitDepthOp->apply(in, out, m_numPixels);
     }
     else
     {
@@ -169,11 +277,68 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
         Generic<OutType>::UnpackRGBAToImageDesc(m_dstImg,
                                                 &m_rgbaFloatBuffer[0],
                                                 &m_outBitDepthBuffer[0],
-                                                m_dstImg.m_width,
-                                                m_yIndex * m_dstImg.m_width);
+                                                m_numPixels,
+                                                m_yIndex * m_dstImg.m_width + m_xIndex);
+    }
+
+    m_xIndex += m_numPixels;
+    if(m_xIndex >= m_dstImg.m_width)
+    {
+        m_xIndex = 0;
+        ++m_yIndex;
     }
+}
 
-    ++m_yIndex;
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::getPlanes(const GenericImageDesc & img,
+                                                       float * (&planes)[4]) const
+{
+    const ptrdiff_t offset = img.m_yStrideBytes * m_yIndex + img.m_xStrideBytes * m_xIndex;
+
+    planes[0] = (float *)(img.m_rData + offset);
+    planes[1] = (float *)(img.m_gData + offset);
+    planes[2] = (float *)(img.m_bData + offset);
+    planes[3] = img.m_aData ? (float *)(img.m_aData + offset) : nullptr;
+}
+
+// Process the input bit-depth op from the source planes to the destination planes.
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::prepPlanarScanline(float * (&planes)[4],
+                                                                long & numPixels)
+{
+    if(m_yIndex >= m_yEnd)
+    {
+        numPixels = 0;
+        return;
+    }
+
+    // The last block of a line could be smaller.
+    m_numPixels = std::min(m_numBlockPixels, m_dstImg.m_width - m_xIndex);
+
+    float * srcPlanes[4];
+    getPlanes(m_srcImg, srcPlanes);
+    getPlanes(m_dstImg, planes);
+
+    m_srcImg.m_bitDepthOp->applyPlanar(srcPlanes, planes, m_numPixels);
+
+    numPixels = m_numPixels;
+}
+
+// Process the output bit-depth op in the destination planes.
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::finishPlanarScanline()
+{
+    float * planes[4];
+    getPlanes(m_dstImg, planes);
+
+    m_dstImg.m_bitDepthOp->applyPlanar(planes, planes, m_numPixels);
+
+    m_xIndex += m_numPixels;
+    if(m_xIndex >= m_dstImg.m_width)
+    {
+        m_xIndex = 0;
+        ++m_yIndex;
+    }
 }
 
 
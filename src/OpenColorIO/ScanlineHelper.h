@@ -18,12 +18,17 @@ enum Optimizations
     NO_OPTIMIZATION     = 0x00,
     PACKED_OPTIMIZATION = 0x01,  // The image is a packed RGBA buffer.
     FLOAT_OPTIMIZATION  = 0x02,  // The image is a F32 i.e. 32-bit float.
+    PLANAR_OPTIMIZATION = 0x04,  // The image is a planar buffer i.e. one plane per channel.
 
-    PACKED_FLOAT_OPTIMIZATION = (PACKED_OPTIMIZATION|FLOAT_OPTIMIZATION)
+    PACKED_FLOAT_OPTIMIZATION = (PACKED_OPTIMIZATION|FLOAT_OPTIMIZATION),
+    PLANAR_FLOAT_OPTIMIZATION = (PLANAR_OPTIMIZATION|FLOAT_OPTIMIZATION)
 };
 
 Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc);
 
+// Number of pixels of a line processed at once, where a blockSize of 0 means the complete line.
+long GetNumBlockPixels(long blockSize, long width);
+
 
 class ScanlineHelper
 {
@@ -37,9 +42,36 @@ public:
     virtual void init(const ImageDesc & srcImg, const ImageDesc & dstImg) = 0;
     virtual void init(const ImageDesc & img) = 0;
 
+    // Only process the regions of interest of the images, see GenericImageDesc::init().
+    virtual void init(const ImageDesc & srcImg, const ImageROI & srcROI,
+                      const ImageDesc & dstImg, const ImageROI & dstROI) = 0;
+    virtual void init(const ImageDesc & img, const ImageROI & roi) = 0;
+
+    // Reuse the helper (i.e. same bit-depths) with other bit-depth ops and block size, where
+    // init() must then be called. The intermediate buffers are kept so the processing does not
+    // allocate memory once they are large enough.
+    virtual void reset(const ConstOpCPURcPtr & inBitDepthOp,
+                       const ConstOpCPURcPtr & outBitDepthOp,
+                       long blockSize) = 0;
+
+    // Release the references to the ops once the processing is done.
+    virtual void release() = 0;
+
+    // Restrict the processing to the lines [yBegin, yEnd) of the image. It must be called
+    // after init() and allows several helpers to process distinct parts of the same image.
+    virtual void setLineRange(long yBegin, long yEnd) = 0;
+
     virtual void prepRGBAScanline(float** buffer, long & numPixels) = 0;
 
     virtual void finishRGBAScanline() = 0;
+
+    // When both images are planar F32 buffers, the pixels are directly processed in the planes
+    // of the destination image (see OpCPU::applyPlanar()) instead of the RGBA scanlines.
+    virtual bool isPlanar() const = 0;
+
+    virtual void prepPlanarScanline(float * (&planes)[4], long & numPixels) = 0;
+
+    virtual void finishPlanarScanline() = 0;
 };
 
 template<typename InType, typename OutType>
@@ -50,12 +82,27 @@ public:
     GenericScanlineHelper(const GenericScanlineHelper&) = delete;
     GenericScanlineHelper& operator=(const GenericScanlineHelper&) = delete;
 
+    // The blockSize is the maximum number of pixels processed at once (i.e. each line is
+    // processed in blocks) where 0 means to process complete lines.
     GenericScanlineHelper(BitDepth inputBitDepth, const ConstOpCPURcPtr & inBitDepthOp,
-                          BitDepth outputBitDepth, const ConstOpCPURcPtr & outBitDepthOp);
+                          BitDepth outputBitDepth, const ConstOpCPURcPtr & outBitDepthOp,
+                          long blockSize);
 
     void init(const ImageDesc & srcImg, const ImageDesc & dstImg) override;
     void init(const ImageDesc & img) override;
 
+    void init(const ImageDesc & srcImg, const ImageROI & srcROI,
+              const ImageDesc & dstImg, const ImageROI & dstROI) override;
+    void init(const ImageDesc & img, const ImageROI & roi) override;
+
+    void reset(const ConstOpCPURcPtr & inBitDepthOp,
+               const ConstOpCPURcPtr & outBitDepthOp,
+               long blockSize) override;
+
+    void release() override;
+
+    void setLineRange(long yBegin, long yEnd) override;
+
     ~GenericScanlineHelper() override;
 
     // Copy from the src image to our scanline, in our preferred
@@ -68,7 +115,27 @@ public:
 
     void finishRGBAScanline() override;
 
+    bool isPlanar() const override { return m_usePlanar; }
+
+    // Process the input bit-depth op from the source planes to the destination planes.
+    // Return the number of pixels to process.
+
+    void prepPlanarScanline(float * (&planes)[4], long & numPixels) override;
+
+    // Process the output bit-depth op in the destination planes.
+
+    void finishPlanarScanline() override;
+
 private:
+    // A null region of interest means the complete image.
+    void initImages(const ImageDesc & srcImg, const ImageROI * srcROI,
+                    const ImageDesc & dstImg, const ImageROI * dstROI);
+    void initImage(const ImageDesc & img, const ImageROI * roi);
+
+    // Get the planes of the current block of pixels.
+    void getPlanes(const GenericImageDesc & img, float * (&planes)[4]) const;
+
+
     BitDepth m_inputBitDepth;
     BitDepth m_outputBitDepth;
     ConstOpCPURcPtr m_inBitDepthOp;
@@ -88,13 +155,28 @@ private:
     std::vector<InType> m_inBitDepthBuffer;
     std::vector<OutType> m_outBitDepthBuffer;
 
+    // The requested maximum number of pixels to process at once (0 means complete lines).
+    long m_blockSize;
+    // The effective maximum number of pixels to process at once for the image.
+    long m_numBlockPixels;
+    // The number of pixels of the current block.
+    long m_numPixels;
+
+    // The index of the first pixel of the current block in the current line.
+    long m_xIndex;
     // The index of the current line to process.
-    int m_yIndex;
+    long m_yIndex;
+    // The index of the line following the last line to process.
+    long m_yEnd;
 
     // If the destination buffer is packed RGBA F32 it could then be used
     // as the internal processing buffer (i.e. instead of m_rgbaFloatBuffer
     // and m_outBitDepthBuffer).
     bool m_useDstBuffer;
+
+    // If both the source and destination buffers are planar F32 (with or without alpha)
+    // the pixels are processed in the destination planes (i.e. no RGBA scanline).
+    bool m_usePlanar;
 };
 
 
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ThreadPool.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+ThreadPool & ThreadPool::GetInstance()
+{
+    // The library-wide pool is intentionally never destroyed: joining threads while
+    // the process (or the dynamic library) is unloading could deadlock on some platforms.
+    static ThreadPool * pool = new ThreadPool;
+    return *pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+        m_tasks.clear();
+    }
+    m_condition.notify_all();
+
+    for (auto & worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::reserve(unsigned numWorkers)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (m_workers.size() < numWorkers)
+    {
+        m_workers.emplace_back(&ThreadPool::run, this);
+    }
+}
+
+unsigned ThreadPool::getNumWorkers() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (unsigned)m_workers.size();
+}
+
+void ThreadPool::submit(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_condition.notify_one();
+}
+
+void ThreadPool::run()
+{
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+            if (m_stop)
+            {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+TaskQueue::TaskQueue(size_t capacity)
+    :   m_capacity(std::max(size_t(1), capacity))
+    ,   m_thread(&TaskQueue::run, this)
+{
+}
+
+TaskQueue::~TaskQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_notEmpty.notify_one();
+
+    m_thread.join();
+}
+
+void TaskQueue::push(Task task)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notFull.wait(lock, [this]() { return m_tasks.size() < m_capacity; });
+        m_tasks.push_back(std::move(task));
+    }
+    m_notEmpty.notify_one();
+}
+
+void TaskQueue::run()
+{
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_notEmpty.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+            // Unlike the thread pool, the pending tasks are processed before stopping.
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        m_notFull.notify_one();
+        task();
+    }
+}
+
+unsigned GetNumThreads(unsigned numThreads)
+{
+    if (numThreads == 0)
+    {
+        // Note that hardware_concurrency() could return 0 if the value is not computable.
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return numThreads;
+}
+
+namespace
+{
+
+// State shared between the calling thread and the worker threads. The worker threads
+// could start after the end of the ParallelFor() call so the state must outlive it.
+struct ParallelForGroup
+{
+    ParallelForGroup(long numTasks, const std::function<void(long)> & func)
+        :   m_numTasks(numTasks)
+        ,   m_func(func)
+    {
+    }
+
+    const long m_numTasks;
+    // Only used while some tasks remain i.e. while the caller waits.
+    const std::function<void(long)> & m_func;
+
+    std::atomic<long> m_nextTask{ 0 };
+    std::atomic<bool> m_failed{ false };
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    long m_numDone = 0;
+    std::exception_ptr m_error;
+};
+
+void RunTasks(ParallelForGroup & group)
+{
+    while (true)
+    {
+        const long idx = group.m_nextTask++;
+        if (idx >= group.m_numTasks)
+        {
+            return;
+        }
+
+        if (!group.m_failed)
+        {
+            try
+            {
+                group.m_func(idx);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(group.m_mutex);
+                if (!group.m_error)
+                {
+                    group.m_error = std::current_exception();
+                }
+                group.m_failed = true;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(group.m_mutex);
+        if (++group.m_numDone == group.m_numTasks)
+        {
+            group.m_condition.notify_all();
+        }
+    }
+}
+
+} // anon
+
+void ParallelFor(unsigned numThreads, long numTasks, const std::function<void(long)> & func)
+{
+    if (numTasks <= 0)
+    {
+        return;
+    }
+
+    const long numHelpers = std::min(long(GetNumThreads(numThreads)), numTasks) - 1;
+
+    if (numHelpers <= 0)
+    {
+        for (long idx = 0; idx < numTasks; ++idx)
+        {
+            func(idx);
+        }
+        return;
+    }
+
+    auto group = std::make_shared<ParallelForGroup>(numTasks, func);
+
+    ThreadPool & pool = ThreadPool::GetInstance();
+    pool.reserve((unsigned)numHelpers);
+    for (long idx = 0; idx < numHelpers; ++idx)
+    {
+        pool.submit([group]() { RunTasks(*group); });
+    }
+
+    // The calling thread also processes tasks so there is always progress, even if all
+    // the worker threads are busy (e.g. nested calls).
+    RunTasks(*group);
+
+    std::unique_lock<std::mutex> lock(group->m_mutex);
+    group->m_condition.wait(lock, [&group]() { return group->m_numDone == group->m_numTasks; });
+
+    if (group->m_error)
+    {
+        std::rethrow_exception(group->m_error);
+    }
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_THREADPOOL_H
+#define INCLUDED_OCIO_THREADPOOL_H
+
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+/** For internal use only */
+
+namespace OCIO_NAMESPACE
+{
+
+// A minimal pool of worker threads. The worker threads are lazily created
+// and wait for tasks to process.
+class ThreadPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    // Get the pool shared by the whole library.
+    static ThreadPool & GetInstance();
+
+    ThreadPool() = default;
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    // Stop and join all the worker threads. Pending tasks are discarded.
+    ~ThreadPool();
+
+    // Make sure there are at least numWorkers worker threads.
+    void reserve(unsigned numWorkers);
+
+    unsigned getNumWorkers() const;
+
+    // Queue a task for one of the worker threads.
+    void submit(Task task);
+
+private:
+    void run();
+
+    mutable std::mutex       m_mutex;
+    std::condition_variable  m_condition;
+    std::deque<Task>         m_tasks;
+    std::vector<std::thread> m_workers;
+    bool                     m_stop = false;
+};
+
+// A bounded queue of tasks processed in submission order by a dedicated thread. The thread
+// is created with the queue, and the destructor processes the pending tasks before joining it.
+class TaskQueue
+{
+public:
+    typedef std::function<void()> Task;
+
+    // The capacity is the number of tasks waiting for the dedicated thread i.e. the task being
+    // processed is not counted.
+    explicit TaskQueue(size_t capacity);
+    TaskQueue(const TaskQueue &) = delete;
+    TaskQueue & operator=(const TaskQueue &) = delete;
+
+    ~TaskQueue();
+
+    // Queue a task, the call blocking while the queue is full. The task must not throw.
+    void push(Task task);
+
+private:
+    void run();
+
+    const size_t             m_capacity;
+    std::mutex               m_mutex;
+    std::condition_variable  m_notEmpty;
+    std::condition_variable  m_notFull;
+    std::deque<Task>         m_tasks;
+    bool                     m_stop = false;
+    // Last member so the thread starts once all the other members are constructed.
+    std::thread              m_thread;
+};
+
+// Return the number of threads to use, where 0 means all the hardware threads.
+unsigned GetNumThreads(unsigned numThreads);
+
+// Call func(idx) for each idx in [0, numTasks) using up to numThreads threads, the calling
+// thread included. The call returns once all the tasks are processed. The first exception
+// thrown by a task is rethrown to the caller, and the tasks not yet started are skipped.
+void ParallelFor(unsigned numThreads, long numTasks, const std::function<void(long)> & func);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_THREADPOOL_H
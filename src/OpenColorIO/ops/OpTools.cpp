@@ -1,10 +1,14 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
 #include "ops/OpTools.h"
+#include "ThreadPool.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -13,35 +17,52 @@ void EvalTransform(const float * in,
                     long numPixels,
                     OpRcPtrVec & ops)
 {
-    std::vector<float> tmp(numPixels * 4);
-
-    // Render the LUT entries (domain) through the ops.
-    const float * values = in;
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        tmp[4 * idx + 0] = values[0];
-        tmp[4 * idx + 1] = values[1];
-        tmp[4 * idx + 2] = values[2];
-        tmp[4 * idx + 3] = 1.0f;
-
-        values += 3;
-    }
-
     ops.finalize(OPTIMIZATION_NONE);
 
+    ConstOpCPURcPtrVec cpuOps;
     for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
     {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
+        cpuOps.push_back(ops[i]->getCPUOp(LOG_EXP_POW_STD));
     }
 
-    float * result = out;
-    for (long idx = 0; idx<numPixels; ++idx)
+    // Render the LUT entries (domain) through the ops, using the CPU renderers on blocks of
+    // pixels (like the CPUProcessor) processed in parallel.
+    constexpr long BlockSize = 1024;
+    const long numBlocks = (numPixels + BlockSize - 1) / BlockSize;
+
+    ParallelFor(0, numBlocks, [&](long block)
     {
-        result[0] = tmp[4 * idx + 0];
-        result[1] = tmp[4 * idx + 1];
-        result[2] = tmp[4 * idx + 2];
+        const long start = block * BlockSize;
+        const long count = std::min(BlockSize, numPixels - start);
 
-        result += 3;
-    }
+        // Note that the in and out buffers could be the same buffer.
+        std::vector<float> tmp(count * 4);
+
+        const float * values = in + 3 * start;
+        for (long idx = 0; idx<count; ++idx)
+        {
+            tmp[4 * idx + 0] = values[0];
+            tmp[4 * idx + 1] = values[1];
+            tmp[4 * idx + 2] = values[2];
+            tmp[4 * idx + 3] = 1.0f;
+
+            values += 3;
+        }
+
+        for (const auto & cpuOp : cpuOps)
+        {
+            cpuOp->apply(&tmp[0], &tmp[0], count);
+        }
+
+        float * result = out + 3 * start;
+        for (long idx = 0; idx<count; ++idx)
+        {
+            result[0] = tmp[4 * idx + 0];
+            result[1] = tmp[4 * idx + 1];
+            result[2] = tmp[4 * idx + 2];
+
+            result += 3;
+        }
+    });
 }
 } // namespace OCIO_NAMESPACE
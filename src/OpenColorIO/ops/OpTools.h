@@ -14,6 +14,8 @@
 namespace OCIO_NAMESPACE
 {
 
+// Render the packed RGB pixels through the ops using multiple threads. The in and out buffers
+// could be the same buffer.
 void EvalTransform(const float * in, float * out,
                    long numPixels,
                    OpRcPtrVec & ops);
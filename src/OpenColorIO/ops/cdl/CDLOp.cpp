@@ -54,7 +54,7 @@ public:
 
     std::string getCacheID() const override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -153,10 +153,10 @@ std::string CDLOp::getCacheID() const
     return cacheIDStream.str();
 }
 
-ConstOpCPURcPtr CDLOp::getCPUOp(bool fastLogExpPow) const
+ConstOpCPURcPtr CDLOp::getCPUOp(LogExpPowPrecision precision) const
 {
     ConstCDLOpDataRcPtr data = cdlData();
-    return GetCDLCPURenderer(data, fastLogExpPow);
+    return GetCDLCPURenderer(data, precision >= LOG_EXP_POW_FAST);
 }
 
 void CDLOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
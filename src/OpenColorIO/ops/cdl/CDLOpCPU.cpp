@@ -9,6 +9,8 @@
 
 #include "BitDepthUtils.h"
 #include "CDLOpCPU.h"
+#include "CDLOpCPU_AVX2.h"
+#include "CPUInfo.h"
 #include "SSE.h"
 
 
@@ -297,6 +299,20 @@ public:
 };
 #endif
 
+#ifdef USE_AVX2
+template<bool CLAMP>
+class CDLRendererFwdAVX2 : public CDLRendererFwd<CLAMP>
+{
+public:
+    CDLRendererFwdAVX2(ConstCDLOpDataRcPtr & cdl)
+        : CDLRendererFwd<CLAMP>(cdl)
+    {
+    }
+
+    virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+};
+#endif
+
 template<bool CLAMP>
 class CDLRendererRev : public CDLOpCPU
 {
@@ -323,6 +339,20 @@ public:
 };
 #endif
 
+#ifdef USE_AVX2
+template<bool CLAMP>
+class CDLRendererRevAVX2 : public CDLRendererRev<CLAMP>
+{
+public:
+    CDLRendererRevAVX2(ConstCDLOpDataRcPtr & cdl)
+        : CDLRendererRev<CLAMP>(cdl)
+    {
+    }
+
+    virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+};
+#endif
+
 CDLOpCPU::CDLOpCPU(ConstCDLOpDataRcPtr & cdl)
     :   OpCPU()
 {
@@ -375,6 +405,18 @@ void CDLRendererFwdSSE<CLAMP>::apply(const void * inImg, void * outImg, long num
 }
 #endif
 
+#ifdef USE_AVX2
+template<bool CLAMP>
+void CDLRendererFwdAVX2<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const RenderParams & params = this->m_renderParams;
+
+    ApplyCDL_AVX2((const float *)inImg, (float *)outImg, numPixels,
+                  params.getSlope(), params.getOffset(), params.getPower(),
+                  params.getSaturation(), false, CLAMP);
+}
+#endif
+
 template<bool CLAMP>
 void CDLRendererFwd<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
 {
@@ -439,6 +481,18 @@ void CDLRendererRevSSE<CLAMP>::apply(const void * inImg, void * outImg, long num
 }
 #endif
 
+#ifdef USE_AVX2
+template<bool CLAMP>
+void CDLRendererRevAVX2<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const RenderParams & params = this->m_renderParams;
+
+    ApplyCDL_AVX2((const float *)inImg, (float *)outImg, numPixels,
+                  params.getSlope(), params.getOffset(), params.getPower(),
+                  params.getSaturation(), true, CLAMP);
+}
+#endif
+
 template<bool CLAMP>
 void CDLRendererRev<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
 {
@@ -474,28 +528,43 @@ ConstOpCPURcPtr GetCDLCPURenderer(ConstCDLOpDataRcPtr & cdl, bool fastPower)
 {
 #ifndef USE_SSE
     std::ignore = fastPower;
+#endif
+#ifdef USE_AVX2
+    const bool useAVX2 = fastPower && CPUInfo::Instance().hasAVX2();
 #endif
     switch(cdl->getStyle())
     {
         case CDLOpData::CDL_V1_2_FWD:
+#ifdef USE_AVX2
+            if (useAVX2) return std::make_shared<CDLRendererFwdAVX2<true>>(cdl);
+#endif
 #ifdef USE_SSE
             if (fastPower) return std::make_shared<CDLRendererFwdSSE<true>>(cdl);
             else
 #endif
                 return std::make_shared<CDLRendererFwd<true>>(cdl);
         case CDLOpData::CDL_NO_CLAMP_FWD:
+#ifdef USE_AVX2
+            if (useAVX2) return std::make_shared<CDLRendererFwdAVX2<false>>(cdl);
+#endif
 #ifdef USE_SSE
             if (fastPower) return std::make_shared<CDLRendererFwdSSE<false>>(cdl);
             else
 #endif
                 return std::make_shared<CDLRendererFwd<false>>(cdl);
         case CDLOpData::CDL_V1_2_REV:
+#ifdef USE_AVX2
+            if (useAVX2) return std::make_shared<CDLRendererRevAVX2<true>>(cdl);
+#endif
 #ifdef USE_SSE
             if (fastPower) return std::make_shared<CDLRendererRevSSE<true>>(cdl);
             else
 #endif
                 return std::make_shared<CDLRendererRev<true>>(cdl);
         case CDLOpData::CDL_NO_CLAMP_REV:
+#ifdef USE_AVX2
+            if (useAVX2) return std::make_shared<CDLRendererRevAVX2<false>>(cdl);
+#endif
 #ifdef USE_SSE
             if (fastPower) return std::make_shared<CDLRendererRevSSE<false>>(cdl);
             else
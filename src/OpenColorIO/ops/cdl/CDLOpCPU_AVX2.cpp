@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/cdl/CDLOpCPU_AVX2.h"
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Note: Same math as the SSE renderers from CDLOpCPU.cpp, but processing two pixels at a time.
+
+struct AVX2Params
+{
+    __m256 slope;
+    __m256 offset;
+    __m256 power;
+    __m256 saturation;
+    __m256 lumaWeights;
+};
+
+// Conditionally clamp the pixel's values to the range [0, 1] (NaNs become 0).
+template<bool CLAMP>
+inline __m256 ApplyClamp(const __m256 pix)
+{
+    return CLAMP ? _mm256_min_ps(_mm256_max_ps(pix, _mm256_setzero_ps()), _mm256_set1_ps(1.0f))
+                 : pix;
+}
+
+// Apply the power component. In the no-clamp mode, the negative values are passed through.
+template<bool CLAMP>
+inline __m256 ApplyPower(const __m256 pix, const __m256 power)
+{
+    if (CLAMP)
+    {
+        return avx2Power(ApplyClamp<true>(pix), power);
+    }
+
+    const __m256 negMask = _mm256_cmp_ps(pix, _mm256_setzero_ps(), _CMP_LT_OQ);
+    return avx2Select(negMask, pix, avx2Power(pix, power));
+}
+
+inline __m256 ApplySaturation(const __m256 pix, const AVX2Params & params)
+{
+    // Compute luma: dot product of pixel values and the luma weights in each pixel.
+    __m256 luma = _mm256_mul_ps(pix, params.lumaWeights);
+
+    // luma = [ x+y , y+x , z+w , w+z ]
+    luma = _mm256_add_ps(luma, _mm256_permute_ps(luma, _MM_SHUFFLE(2,3,0,1)));
+
+    // luma = [ x+y+z+w , y+x+w+z , z+w+x+y , w+z+y+x ]
+    luma = _mm256_add_ps(luma, _mm256_permute_ps(luma, _MM_SHUFFLE(1,0,3,2)));
+
+    return _mm256_add_ps(luma, _mm256_mul_ps(params.saturation, _mm256_sub_ps(pix, luma)));
+}
+
+template<bool CLAMP>
+void ApplyFwd(const float * in, float * out, long numPixels, const AVX2Params & params)
+{
+    avx2ApplyRGBA(in, out, numPixels, [&](__m256 src)
+    {
+        __m256 pix = _mm256_add_ps(_mm256_mul_ps(src, params.slope), params.offset);
+
+        pix = ApplyPower<CLAMP>(pix, params.power);
+
+        pix = ApplySaturation(pix, params);
+        pix = ApplyClamp<CLAMP>(pix);
+
+        return avx2KeepAlpha(pix, src);
+    });
+}
+
+template<bool CLAMP>
+void ApplyRev(const float * in, float * out, long numPixels, const AVX2Params & params)
+{
+    avx2ApplyRGBA(in, out, numPixels, [&](__m256 src)
+    {
+        __m256 pix = ApplyClamp<CLAMP>(src);
+        pix = ApplySaturation(pix, params);
+
+        pix = ApplyPower<CLAMP>(pix, params.power);
+
+        pix = _mm256_mul_ps(_mm256_add_ps(pix, params.offset), params.slope);
+        pix = ApplyClamp<CLAMP>(pix);
+
+        return avx2KeepAlpha(pix, src);
+    });
+}
+
+} // anon
+
+void ApplyCDL_AVX2(const float * in, float * out, long numPixels,
+                   const float * slope, const float * offset, const float * power,
+                   float saturation, bool isReverse, bool isClamp)
+{
+    AVX2Params params;
+    params.slope       = avx2LoadRGBA(slope);
+    params.offset      = avx2LoadRGBA(offset);
+    params.power       = avx2LoadRGBA(power);
+    params.saturation  = _mm256_set1_ps(saturation);
+    params.lumaWeights = _mm256_setr_ps(0.2126f, 0.7152f, 0.0722f, 0.0f,
+                                        0.2126f, 0.7152f, 0.0722f, 0.0f);
+
+    if (isReverse)
+    {
+        if (isClamp) ApplyRev<true>(in, out, numPixels, params);
+        else         ApplyRev<false>(in, out, numPixels, params);
+    }
+    else
+    {
+        if (isClamp) ApplyFwd<true>(in, out, numPixels, params);
+        else         ApplyFwd<false>(in, out, numPixels, params);
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+#define INCLUDED_OCIO_CDLOP_CPU_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the CDL to packed RGBA float pixels where slope, offset & power hold the four RGBA
+// render parameters (see RenderParams). The alpha channel is left unchanged. It uses the
+// same power function approximation as the SSE renderers. Only call it if
+// CPUInfo::hasAVX2() is true.
+void ApplyCDL_AVX2(const float * in, float * out, long numPixels,
+                   const float * slope, const float * offset, const float * power,
+                   float saturation, bool isReverse, bool isClamp);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
@@ -168,12 +168,12 @@ public:
 
     std::string getCacheID() const override;
 
-protected:
-    static std::string GetChannelParametersString(ChannelParams params);
-
     // Note: Return a boolean status based on the enum stored in the "style" variable.
     bool isClamping() const;
 
+protected:
+    static std::string GetChannelParametersString(ChannelParams params);
+
     void invert();
 
 private:
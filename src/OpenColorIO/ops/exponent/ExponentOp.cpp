@@ -148,7 +148,7 @@ public:
 
     std::string getCacheID() const override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -246,7 +246,7 @@ std::string ExponentOp::getCacheID() const
     return cacheIDStream.str();
 }
 
-ConstOpCPURcPtr ExponentOp::getCPUOp(bool /*fastLogExpPow*/) const
+ConstOpCPURcPtr ExponentOp::getCPUOp(LogExpPowPrecision /*precision*/) const
 {
     return std::make_shared<ExponentOpCPU>(expData());
 }
@@ -47,7 +47,7 @@ public:
     void replaceDynamicProperty(DynamicPropertyType type, DynamicPropertyDoubleImplRcPtr & prop) override;
     void removeDynamicProperties() override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -129,10 +129,10 @@ std::string ExposureContrastOp::getCacheID() const
     return cacheIDStream.str();
 }
 
-ConstOpCPURcPtr ExposureContrastOp::getCPUOp(bool /*fastLogExpPow*/) const
+ConstOpCPURcPtr ExposureContrastOp::getCPUOp(LogExpPowPrecision precision) const
 {
     ConstExposureContrastOpDataRcPtr ecOpData = ecData();
-    return GetExposureContrastCPURenderer(ecOpData);
+    return GetExposureContrastCPURenderer(ecOpData, precision);
 }
 
 void ExposureContrastOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
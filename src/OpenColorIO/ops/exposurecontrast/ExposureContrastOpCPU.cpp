@@ -7,8 +7,10 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "DynamicProperty.h"
 #include "ops/exposurecontrast/ExposureContrastOpCPU.h"
+#include "ops/exposurecontrast/ExposureContrastOpCPU_AVX2.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -22,7 +24,7 @@ class ECRendererBase : public OpCPU
 public:
     ECRendererBase() = delete;
     ECRendererBase(const ECRendererBase &) = delete;   
-    explicit ECRendererBase(ConstExposureContrastOpDataRcPtr & ec);
+    ECRendererBase(ConstExposureContrastOpDataRcPtr & ec, LogExpPowPrecision precision);
     virtual ~ECRendererBase();
 
     bool hasDynamicProperty(DynamicPropertyType type) const override;
@@ -38,10 +40,18 @@ protected:
 
     float m_pivot = 0.0f;
     float m_logExposureStep = 0.088f;
+
+    const LogExpPowPrecision m_precision;
+
+#ifdef USE_AVX2
+    const bool m_useAVX2 = CPUInfo::Instance().hasAVX2();
+#endif
 };
 
-ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec)
+ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec,
+                               LogExpPowPrecision precision)
     : OpCPU()
+    , m_precision(precision)
 {
     // Initialized with the instances from the processor instance but will later be replaced using
     // unifyDynamicProperty().
@@ -147,10 +157,39 @@ DynamicPropertyRcPtr ECRendererBase::getDynamicProperty(DynamicPropertyType type
 }
 
 
+#ifdef USE_SSE
+// out = pow( in * scale, exponent ) * post, the alpha channel is left unchanged.
+template<typename Math>
+struct ECPowerSSE
+{
+    static void Apply(const float * in, float * out, long numPixels,
+                      float scale, float exponent, float post)
+    {
+        const __m128 mm_scale    = _mm_set1_ps(scale);
+        const __m128 mm_exponent = _mm_set1_ps(exponent);
+        const __m128 mm_post     = _mm_set1_ps(post);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float outAlpha = in[3];
+            const __m128 data = _mm_loadu_ps(in);
+
+            _mm_storeu_ps(out,
+                          _mm_mul_ps(Math::Power(_mm_mul_ps(data, mm_scale), mm_exponent),
+                                     mm_post));
+            out[3] = outAlpha;
+
+            in += 4;
+            out += 4;
+        }
+    }
+};
+#endif
+
 class ECLinearRenderer : public ECRendererBase
 {
 public:
-    explicit ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec, LogExpPowPrecision precision);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
@@ -158,8 +197,9 @@ protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
 
-ECLinearRenderer::ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECLinearRenderer::ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec,
+                                   LogExpPowPrecision precision)
+    : ECRendererBase(ec, precision)
 {
     updateData(ec);
 }
@@ -199,34 +239,19 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
     else
     {
-#ifdef USE_SSE
-        __m128 contrast = _mm_set1_ps(contrastVal);
-        __m128 exposure_over_pivot = _mm_set1_ps(exposureVal / m_pivot);
-        __m128 piv = _mm_set1_ps(m_pivot);
-        for (long idx = 0; idx<numPixels; ++idx)
+#ifdef USE_AVX2
+        if (m_useAVX2)
         {
-            const float outAlpha = in[3];
-            __m128 data = _mm_set_ps(in[3],
-                                     in[2],
-                                     in[1],
-                                     in[0]);
-
-            //
             // out = powf( i * exposure / pivot, contrast ) * pivot
-            //
-            _mm_storeu_ps(out,
-                _mm_mul_ps(
-                    ssePower(
-                        _mm_mul_ps(
-                            data,
-                            exposure_over_pivot),
-                        contrast),
-                    piv));
-            out[3] = outAlpha;
-
-            in += 4;
-            out += 4;
+            ApplyECPower_AVX2(in, out, numPixels, m_precision,
+                              exposureVal / m_pivot, contrastVal, m_pivot);
+            return;
         }
+#endif
+#ifdef USE_SSE
+        // out = powf( i * exposure / pivot, contrast ) * pivot
+        sseApplyPrecision<ECPowerSSE>(m_precision, in, out, numPixels,
+                                      exposureVal / m_pivot, contrastVal, m_pivot);
 #else
         const float exposureOverPivotVal = exposureVal / m_pivot;
         for (long idx = 0; idx<numPixels; ++idx)
@@ -254,7 +279,7 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
 class ECLinearRevRenderer : public ECRendererBase
 {
 public:
-    explicit ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec, LogExpPowPrecision precision);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
@@ -262,8 +287,9 @@ protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
 
-ECLinearRevRenderer::ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECLinearRevRenderer::ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec,
+                                         LogExpPowPrecision precision)
+    : ECRendererBase(ec, precision)
 {
     updateData(ec);
 }
@@ -299,40 +325,20 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
     }
     else
     {
-#ifdef USE_SSE
-        __m128 inv_contrast = _mm_set1_ps(invContrastVal);
-
-        const float pivotOverExposureVal = m_pivot * invExposureVal;
-        const float invPivotVal = 1.f / m_pivot;
-
-        __m128 pivot_over_exposure = _mm_set1_ps(pivotOverExposureVal);
-        __m128 inv_pivot = _mm_set1_ps(invPivotVal);
-
-        for (long idx = 0; idx<numPixels; ++idx)
+#ifdef USE_AVX2
+        if (m_useAVX2)
         {
-            const float outAlpha = in[3];
-            __m128 data = _mm_set_ps(in[3],
-                                     in[2],
-                                     in[1],
-                                     in[0]);
-
-            //
             // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
-            //
-            _mm_storeu_ps(out,
-                _mm_mul_ps(
-                    ssePower(
-                        _mm_mul_ps(
-                            data,
-                            inv_pivot),
-                        inv_contrast),
-                    pivot_over_exposure));
-
-            out[3] = outAlpha;
-
-            in += 4;
-            out += 4;
+            ApplyECPower_AVX2(in, out, numPixels, m_precision,
+                              1.f / m_pivot, invContrastVal,
+                              m_pivot * invExposureVal);
+            return;
         }
+#endif
+#ifdef USE_SSE
+        // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
+        sseApplyPrecision<ECPowerSSE>(m_precision, in, out, numPixels,
+                                      1.f / m_pivot, invContrastVal, m_pivot * invExposureVal);
 #else
         const float pivotOverExposureVal = m_pivot * invExposureVal;
         const float invPivotVal = 1.f / m_pivot;
@@ -360,7 +366,7 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
 class ECVideoRenderer : public ECRendererBase
 {
 public:
-    explicit ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec, LogExpPowPrecision precision);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
@@ -368,8 +374,9 @@ protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
 
-ECVideoRenderer::ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECVideoRenderer::ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec,
+                                 LogExpPowPrecision precision)
+    : ECRendererBase(ec, precision)
 {
     updateData(ec);
 }
@@ -409,34 +416,19 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
     else
     {
-#ifdef USE_SSE
-        __m128 contrast = _mm_set1_ps(contrastVal);
-        __m128 exposure_over_pivot = _mm_set1_ps(exposureVal / m_pivot);
-        __m128 piv = _mm_set1_ps(m_pivot);
-        for (long idx = 0; idx<numPixels; ++idx)
+#ifdef USE_AVX2
+        if (m_useAVX2)
         {
-            const float outAlpha = in[3];
-            __m128 data = _mm_set_ps(in[3],
-                                     in[2],
-                                     in[1],
-                                     in[0]);
-
-            //
             // out = powf( i * exposure / pivot, contrast ) * pivot
-            //
-            _mm_storeu_ps(out,
-                _mm_mul_ps(
-                    ssePower(
-                        _mm_mul_ps(
-                            data,
-                            exposure_over_pivot),
-                        contrast),
-                    piv));
-            out[3] = outAlpha;
-
-            in += 4;
-            out += 4;
+            ApplyECPower_AVX2(in, out, numPixels, m_precision,
+                              exposureVal / m_pivot, contrastVal, m_pivot);
+            return;
         }
+#endif
+#ifdef USE_SSE
+        // out = powf( i * exposure / pivot, contrast ) * pivot
+        sseApplyPrecision<ECPowerSSE>(m_precision, in, out, numPixels,
+                                      exposureVal / m_pivot, contrastVal, m_pivot);
 #else
         const float exposureOverPivotVal = exposureVal / m_pivot;
         for (long idx = 0; idx<numPixels; ++idx)
@@ -462,7 +454,7 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 class ECVideoRevRenderer : public ECRendererBase
 {
 public:
-    explicit ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec, LogExpPowPrecision precision);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
@@ -470,8 +462,9 @@ protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
 
-ECVideoRevRenderer::ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECVideoRevRenderer::ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec,
+                                       LogExpPowPrecision precision)
+    : ECRendererBase(ec, precision)
 {
     updateData(ec);
 }
@@ -514,35 +507,20 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
     }
     else
     {
-#ifdef USE_SSE
-        __m128 inv_contrast = _mm_set1_ps(invContrastVal);
-        __m128 pivot_over_exposure = _mm_set1_ps(pivotOverExposureVal);
-        __m128 inv_pivot = _mm_set1_ps(invPivotVal);
-
-        for (long idx = 0; idx<numPixels; ++idx)
+#ifdef USE_AVX2
+        if (m_useAVX2)
         {
-            const float outAlpha = in[3];
-            __m128 data = _mm_set_ps(in[3],
-                                     in[2],
-                                     in[1],
-                                     in[0]);
-
-            //
             // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
-            //
-            _mm_storeu_ps(out,
-                _mm_mul_ps(
-                    ssePower(
-                        _mm_mul_ps(
-                            data,
-                            inv_pivot),
-                        inv_contrast),
-                    pivot_over_exposure));
-            out[3] = outAlpha;
-
-            in += 4;
-            out += 4;
+            ApplyECPower_AVX2(in, out, numPixels, m_precision,
+                              invPivotVal, invContrastVal,
+                              pivotOverExposureVal);
+            return;
         }
+#endif
+#ifdef USE_SSE
+        // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
+        sseApplyPrecision<ECPowerSSE>(m_precision, in, out, numPixels,
+                                      invPivotVal, invContrastVal, pivotOverExposureVal);
 #else
         for (long idx = 0; idx<numPixels; ++idx)
         {
@@ -567,7 +545,7 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
 class ECLogarithmicRenderer : public ECRendererBase
 {
 public:
-    explicit ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec, LogExpPowPrecision precision);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
@@ -575,8 +553,9 @@ protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
 
-ECLogarithmicRenderer::ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECLogarithmicRenderer::ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec,
+                                             LogExpPowPrecision precision)
+    : ECRendererBase(ec, precision)
 {
     updateData(ec);
 }
@@ -603,6 +582,15 @@ void ECLogarithmicRenderer::apply(const void * inImg, void * outImg, long numPix
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
+#ifdef USE_AVX2
+    if (m_useAVX2)
+    {
+        // out = ( in * contrast ) + offset
+        ApplyECAffine_AVX2(in, out, numPixels, contrastVal, offsetVal);
+        return;
+    }
+#endif
+
 #ifdef USE_SSE
     // Equation is:
     // out = ( (in + expos) - pivot ) * contrast + pivot
@@ -651,7 +639,7 @@ void ECLogarithmicRenderer::apply(const void * inImg, void * outImg, long numPix
 class ECLogarithmicRevRenderer : public ECRendererBase
 {
 public:
-    explicit ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec, LogExpPowPrecision precision);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
@@ -659,8 +647,9 @@ protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
 };
 
-ECLogarithmicRevRenderer::ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECLogarithmicRevRenderer::ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec,
+                                                   LogExpPowPrecision precision)
+    : ECRendererBase(ec, precision)
 {
     updateData(ec);
 }
@@ -686,6 +675,15 @@ void ECLogarithmicRevRenderer::apply(const void * inImg, void * outImg, long num
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
+#ifdef USE_AVX2
+    if (m_useAVX2)
+    {
+        // out = ( in * inv_contrast ) + neg_offset
+        ApplyECAffine_AVX2(in, out, numPixels, inv_contrastVal, negOffsetVal);
+        return;
+    }
+#endif
+
     for (long idx = 0; idx<numPixels; ++idx)
     {
         //
@@ -703,22 +701,23 @@ void ECLogarithmicRevRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
-OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec)
+OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec,
+                                          LogExpPowPrecision precision)
 {
     switch (ec->getStyle())
     {
     case ExposureContrastOpData::STYLE_LINEAR:
-        return std::make_shared<ECLinearRenderer>(ec);
+        return std::make_shared<ECLinearRenderer>(ec, precision);
     case ExposureContrastOpData::STYLE_LINEAR_REV:
-        return std::make_shared<ECLinearRevRenderer>(ec);
+        return std::make_shared<ECLinearRevRenderer>(ec, precision);
     case ExposureContrastOpData::STYLE_VIDEO:
-        return std::make_shared<ECVideoRenderer>(ec);
+        return std::make_shared<ECVideoRenderer>(ec, precision);
     case ExposureContrastOpData::STYLE_VIDEO_REV:
-        return std::make_shared<ECVideoRevRenderer>(ec);
+        return std::make_shared<ECVideoRevRenderer>(ec, precision);
     case ExposureContrastOpData::STYLE_LOGARITHMIC:
-        return std::make_shared<ECLogarithmicRenderer>(ec);
+        return std::make_shared<ECLogarithmicRenderer>(ec, precision);
     case ExposureContrastOpData::STYLE_LOGARITHMIC_REV:
-        return std::make_shared<ECLogarithmicRevRenderer>(ec);
+        return std::make_shared<ECLogarithmicRevRenderer>(ec, precision);
     }
 
     throw Exception("Unknown exposure contrast style");
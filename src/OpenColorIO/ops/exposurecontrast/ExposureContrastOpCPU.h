@@ -6,13 +6,17 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "MathUtils.h"
 #include "ops/exposurecontrast/ExposureContrastOpData.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
-OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec);
+// The renderers always use the SIMD power function approximations when available, the accurate
+// ones for LOG_EXP_POW_STD.
+OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec,
+                                          LogExpPowPrecision precision);
 
 } // namespace OCIO_NAMESPACE
 
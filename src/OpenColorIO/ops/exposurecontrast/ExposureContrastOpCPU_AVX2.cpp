@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/exposurecontrast/ExposureContrastOpCPU_AVX2.h"
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+template<typename Math>
+struct ECPower
+{
+    static void Apply(const float * in, float * out, long numPixels,
+                      float scale, float exponent, float post)
+    {
+        const __m256 mm_scale    = _mm256_set1_ps(scale);
+        const __m256 mm_exponent = _mm256_set1_ps(exponent);
+        const __m256 mm_post     = _mm256_set1_ps(post);
+
+        avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+        {
+            const __m256 data
+                = _mm256_mul_ps(Math::Power(_mm256_mul_ps(pixel, mm_scale), mm_exponent),
+                                mm_post);
+
+            return avx2KeepAlpha(data, pixel);
+        });
+    }
+};
+
+} // anon
+
+void ApplyECPower_AVX2(const float * in, float * out, long numPixels,
+                       LogExpPowPrecision precision,
+                       float scale, float exponent, float post)
+{
+    avx2ApplyPrecision<ECPower>(precision, in, out, numPixels, scale, exponent, post);
+}
+
+void ApplyECAffine_AVX2(const float * in, float * out, long numPixels,
+                        float scale, float offset)
+{
+    const __m256 mm_scale  = _mm256_set1_ps(scale);
+    const __m256 mm_offset = _mm256_set1_ps(offset);
+
+    avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+    {
+        return avx2KeepAlpha(_mm256_add_ps(mm_offset, _mm256_mul_ps(pixel, mm_scale)), pixel);
+    });
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
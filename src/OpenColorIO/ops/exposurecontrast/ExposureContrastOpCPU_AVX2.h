@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX2_H
+#define INCLUDED_OCIO_EXPOSURECONTRASTOP_CPU_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "MathUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The AVX2 kernels of the ExposureContrast renderers, processing packed RGBA float pixels
+// with the alpha channel left unchanged. Only call them if CPUInfo::hasAVX2() is true.
+
+// out = pow( in * scale, exponent ) * post, using the same power function approximation
+// as the SSE renderers of the precision tier.
+void ApplyECPower_AVX2(const float * in, float * out, long numPixels,
+                       LogExpPowPrecision precision,
+                       float scale, float exponent, float post);
+
+// out = in * scale + offset
+void ApplyECAffine_AVX2(const float * in, float * out, long numPixels,
+                        float scale, float offset);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
@@ -43,7 +43,7 @@ public:
 
     std::string getCacheID() const override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -119,10 +119,10 @@ std::string FixedFunctionOp::getCacheID() const
     return cacheIDStream.str();
 }
 
-ConstOpCPURcPtr FixedFunctionOp::getCPUOp(bool /*fastLogExpPow*/) const
+ConstOpCPURcPtr FixedFunctionOp::getCPUOp(LogExpPowPrecision precision) const
 {
     ConstFixedFunctionOpDataRcPtr data = fnData();
-    return GetFixedFunctionCPURenderer(data);
+    return GetFixedFunctionCPURenderer(data, precision >= LOG_EXP_POW_FAST);
 }
 
 void FixedFunctionOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
@@ -7,8 +7,12 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/fixedfunction/FixedFunctionOpCPU.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU_AVX2.h"
+
+#include "SSE.h"
 
 
 namespace OCIO_NAMESPACE
@@ -205,6 +209,83 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
+class Renderer_LIN_TO_PQ : public OpCPU
+{
+public:
+    Renderer_LIN_TO_PQ() = delete;
+    Renderer_LIN_TO_PQ(const Renderer_LIN_TO_PQ &) = delete;
+
+    explicit Renderer_LIN_TO_PQ(ConstFixedFunctionOpDataRcPtr & data);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+
+class Renderer_PQ_TO_LIN : public OpCPU
+{
+public:
+    Renderer_PQ_TO_LIN() = delete;
+    Renderer_PQ_TO_LIN(const Renderer_PQ_TO_LIN &) = delete;
+
+    explicit Renderer_PQ_TO_LIN(ConstFixedFunctionOpDataRcPtr & data);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+
+class Renderer_LIN_TO_HLG : public OpCPU
+{
+public:
+    Renderer_LIN_TO_HLG() = delete;
+    Renderer_LIN_TO_HLG(const Renderer_LIN_TO_HLG &) = delete;
+
+    explicit Renderer_LIN_TO_HLG(ConstFixedFunctionOpDataRcPtr & data);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+
+class Renderer_HLG_TO_LIN : public OpCPU
+{
+public:
+    Renderer_HLG_TO_LIN() = delete;
+    Renderer_HLG_TO_LIN(const Renderer_HLG_TO_LIN &) = delete;
+
+    explicit Renderer_HLG_TO_LIN(ConstFixedFunctionOpDataRcPtr & data);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+
+#ifdef USE_SSE
+// Same math as the renderer Base but processing four pixels at a time using SSE.
+// Only some renderers have a specialization of the apply() method.
+template<typename Base>
+class Renderer_SSE : public Base
+{
+public:
+    template<typename... Args>
+    explicit Renderer_SSE(Args && ... args)
+        :   Base(std::forward<Args>(args)...)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+#endif
+
+#ifdef USE_AVX2
+// Same as Renderer_SSE but processing eight pixels at a time using AVX2.
+template<typename Base>
+class Renderer_AVX2 : public Base
+{
+public:
+    template<typename... Args>
+    explicit Renderer_AVX2(Args && ... args)
+        :   Base(std::forward<Args>(args)...)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+#endif
+
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -1039,6 +1120,931 @@ void Renderer_LUV_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+Renderer_LIN_TO_PQ::Renderer_LIN_TO_PQ(ConstFixedFunctionOpDataRcPtr & /*data*/)
+    :   OpCPU()
+{
+}
+
+void Renderer_LIN_TO_PQ::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            // Linear 1.0 is 100 nits so 10000 nits (i.e. PQ 1.0) is 100.0. The curve is
+            // mirrored for the negative values. Note that the large exponent amplifies the
+            // rounding errors, hence the double precision.
+            const double L = std::fabs(in[c]) * 0.01;
+            const double y = std::pow(L, (double)ST2084::m1);
+            const double ratpoly = (ST2084::c1 + ST2084::c2 * y) / (1. + ST2084::c3 * y);
+            const double N = std::pow(ratpoly, (double)ST2084::m2);
+
+            out[c] = std::copysign((float)N, in[c]);
+        }
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+Renderer_PQ_TO_LIN::Renderer_PQ_TO_LIN(ConstFixedFunctionOpDataRcPtr & /*data*/)
+    :   OpCPU()
+{
+}
+
+void Renderer_PQ_TO_LIN::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            // The PQ values are clamped to 1.0 (i.e. 10000 nits) as the curve is not defined
+            // much further. The denominator cancels out close to 1.0, hence the double precision.
+            const double N = std::min(std::fabs(in[c]), 1.f);
+            const double x = std::pow(N, 1. / ST2084::m2);
+            const double num = std::max(x - ST2084::c1, 0.);
+            const double den = ST2084::c2 - ST2084::c3 * x;
+            const double L = std::pow(num / den, 1. / ST2084::m1);
+
+            out[c] = std::copysign((float)(100. * L), in[c]);
+        }
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+Renderer_LIN_TO_HLG::Renderer_LIN_TO_HLG(ConstFixedFunctionOpDataRcPtr & /*data*/)
+    :   OpCPU()
+{
+}
+
+void Renderer_LIN_TO_HLG::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            // The curve is mirrored for the negative values.
+            const float E = std::fabs(in[c]);
+            const float Ep = (E <= 1.f / 12.f) ? std::sqrt(3.f * E)
+                                               : HLG::a * std::log(12.f * E - HLG::b) + HLG::c;
+
+            out[c] = std::copysign(Ep, in[c]);
+        }
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+Renderer_HLG_TO_LIN::Renderer_HLG_TO_LIN(ConstFixedFunctionOpDataRcPtr & /*data*/)
+    :   OpCPU()
+{
+}
+
+void Renderer_HLG_TO_LIN::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            const float Ep = std::fabs(in[c]);
+            const float E = (Ep <= 0.5f) ? Ep * Ep / 3.f
+                                         : (std::exp((Ep - HLG::c) / HLG::a) + HLG::b) / 12.f;
+
+            out[c] = std::copysign(E, in[c]);
+        }
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+#ifdef USE_SSE
+
+namespace
+{
+
+// Call func on packed RGBA float pixels, four pixels at a time, where func takes and updates
+// the red, green & blue channels of the four pixels. The alpha channel is left unchanged and
+// the in and out buffers could be the same buffer.
+template<typename Func>
+void SSEApplyRGB(const float * in, float * out, long numPixels, const Func & func)
+{
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 red = _mm_loadu_ps(in);
+        __m128 grn = _mm_loadu_ps(in + 4);
+        __m128 blu = _mm_loadu_ps(in + 8);
+        __m128 alp = _mm_loadu_ps(in + 12);
+        _MM_TRANSPOSE4_PS(red, grn, blu, alp);
+
+        func(red, grn, blu);
+
+        _MM_TRANSPOSE4_PS(red, grn, blu, alp);
+        _mm_storeu_ps(out,      red);
+        _mm_storeu_ps(out + 4,  grn);
+        _mm_storeu_ps(out + 8,  blu);
+        _mm_storeu_ps(out + 12, alp);
+
+        in  += 16;
+        out += 16;
+    }
+
+    if (idx < numPixels)
+    {
+        const long remaining = 4 * (numPixels - idx);
+
+        float buffer[16];
+        for (long i = 0; i < 16; ++i)
+        {
+            buffer[i] = i < remaining ? in[i] : 0.0f;
+        }
+
+        SSEApplyRGB(buffer, buffer, 4, func);
+
+        for (long i = 0; i < remaining; ++i)
+        {
+            out[i] = buffer[i];
+        }
+    }
+}
+
+// Arc tangent of y/x in the range [-pi, pi]. Unlike sseAtan2(), it is accurate to a few ulps
+// (i.e. the Cephes atanf() approximation) so the results match the ones of atan2f().
+inline __m128 AccurateAtan2(const __m128 y, const __m128 x)
+{
+    const __m128 absY = _mm_and_ps(y, EABS_MASK);
+    const __m128 absX = _mm_and_ps(x, EABS_MASK);
+
+    // Reduce the argument to [0, 1] using atan(y/x) = pi/2 - atan(x/y).
+    const __m128 swap  = _mm_cmpgt_ps(absY, absX);
+    const __m128 num   = sseSelect(swap, absX, absY);
+    const __m128 denom = sseSelect(swap, absY, absX);
+
+    // Note that atan2(0, 0) is 0.
+    __m128 t = _mm_and_ps(_mm_div_ps(num, denom), _mm_cmpneq_ps(denom, EZERO));
+
+    // Reduce the argument to [0, tan(pi/8)] using atan(t) = pi/4 + atan((t-1) / (t+1)).
+    const __m128 reduce = _mm_cmpgt_ps(t, _mm_set1_ps(0.4142135623730950f));
+    t = sseSelect(reduce, _mm_div_ps(_mm_sub_ps(t, EONE), _mm_add_ps(t, EONE)), t);
+
+    const __m128 z = _mm_mul_ps(t, t);
+
+    __m128 res = _mm_set1_ps(8.05374449538e-2f);
+    res = _mm_sub_ps(_mm_mul_ps(res, z), _mm_set1_ps(1.38776856032e-1f));
+    res = _mm_add_ps(_mm_mul_ps(res, z), _mm_set1_ps(1.99777106478e-1f));
+    res = _mm_sub_ps(_mm_mul_ps(res, z), _mm_set1_ps(3.33329491539e-1f));
+    res = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(res, z), t), t);
+
+    res = _mm_add_ps(res, _mm_and_ps(reduce, _mm_set1_ps(0.78539816339744830962f)));
+    res = sseSelect(swap, _mm_sub_ps(E_PI_2, res), res);
+
+    // Adjust the quadrants 2 & 3 and restore the sign.
+    res = sseSelect(isNegativeSpecial(x), _mm_sub_ps(E_PI, res), res);
+    return _mm_or_ps(res, _mm_and_ps(y, ESIGN_MASK));
+}
+
+// Same as CalcSatWeight().
+inline __m128 CalcSatWeight(const __m128 red, const __m128 grn, const __m128 blu,
+                            const __m128 noiseLimit)
+{
+    const __m128 minVal = _mm_min_ps(_mm_min_ps(blu, grn), red);
+    const __m128 maxVal = _mm_max_ps(_mm_max_ps(blu, grn), red);
+
+    const __m128 limit = _mm_set1_ps(1e-10f);
+
+    return _mm_div_ps(_mm_sub_ps(_mm_max_ps(maxVal, limit), _mm_max_ps(minVal, limit)),
+                      _mm_max_ps(maxVal, noiseLimit));
+}
+
+// Same as CalcHueWeight() where the quadratic B-spline coefficients of each pixel are
+// selected using masks.
+inline __m128 CalcHueWeight(const __m128 red, const __m128 grn, const __m128 blu,
+                            const __m128 inv_width)
+{
+    const __m128 a = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.f), red), _mm_add_ps(grn, blu));
+    const __m128 b = _mm_mul_ps(_mm_set1_ps(1.7320508075688772f), _mm_sub_ps(grn, blu));
+
+    const __m128 hue = AccurateAtan2(b, a);
+
+    const __m128 knot_coord = _mm_add_ps(_mm_mul_ps(hue, inv_width), _mm_set1_ps(2.f));
+    const __m128i j = _mm_cvttps_epi32(knot_coord);
+    const __m128 t = _mm_sub_ps(knot_coord, _mm_cvtepi32_ps(j));
+
+    const __m128 j0 = _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(0)));
+    const __m128 j1 = _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(1)));
+    const __m128 j2 = _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(2)));
+    const __m128 j3 = _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(3)));
+
+    auto coef = [&](float c0, float c1, float c2, float c3)
+    {
+        return sseSelect(j0, _mm_set1_ps(c0),
+                         sseSelect(j1, _mm_set1_ps(c1),
+                                   sseSelect(j2, _mm_set1_ps(c2), _mm_set1_ps(c3))));
+    };
+
+    const __m128 coefs0 = coef( 0.25f, -0.75f,  0.75f, -0.25f);
+    const __m128 coefs1 = coef( 0.00f,  0.75f, -1.50f,  0.75f);
+    const __m128 coefs2 = coef( 0.00f,  0.75f,  0.00f, -0.75f);
+    const __m128 coefs3 = coef( 0.00f,  0.25f,  1.00f,  0.25f);
+
+    __m128 f_H = _mm_add_ps(_mm_mul_ps(t, coefs0), coefs1);
+    f_H = _mm_add_ps(_mm_mul_ps(t, f_H), coefs2);
+    f_H = _mm_add_ps(_mm_mul_ps(t, f_H), coefs3);
+
+    // The hue is outside of the window.
+    return _mm_and_ps(f_H, _mm_or_ps(_mm_or_ps(j0, j1), _mm_or_ps(j2, j3)));
+}
+
+// Restore the hue of the pixels changed by the red modifier (i.e. where flag is set).
+inline void RestoreHue(const __m128 flag, const __m128 red, const __m128 newRed,
+                       __m128 & grn, __m128 & blu)
+{
+    const __m128 limit = _mm_set1_ps(1e-10f);
+
+    // red >= grn >= blu
+    const __m128 hue_facG = _mm_div_ps(_mm_sub_ps(grn, blu), _mm_max_ps(_mm_sub_ps(red, blu), limit));
+    const __m128 newGrn = _mm_add_ps(_mm_mul_ps(hue_facG, _mm_sub_ps(newRed, blu)), blu);
+
+    // red >= blu >= grn
+    const __m128 hue_facB = _mm_div_ps(_mm_sub_ps(blu, grn), _mm_max_ps(_mm_sub_ps(red, grn), limit));
+    const __m128 newBlu = _mm_add_ps(_mm_mul_ps(hue_facB, _mm_sub_ps(newRed, grn)), grn);
+
+    const __m128 grnGEblu = _mm_cmpge_ps(grn, blu);
+
+    grn = sseSelect(_mm_and_ps(flag, grnGEblu), newGrn, grn);
+    blu = sseSelect(_mm_andnot_ps(grnGEblu, flag), newBlu, blu);
+}
+
+inline __m128 RedModFwd(const __m128 red, const __m128 f_H, const __m128 f_S,
+                        const __m128 pivot, const __m128 oneMinusScale)
+{
+    return _mm_add_ps(red, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, f_S), _mm_sub_ps(pivot, red)),
+                                      oneMinusScale));
+}
+
+inline __m128 RedModInv(const __m128 red, const __m128 grn, const __m128 blu, const __m128 f_H,
+                        const __m128 pivot, const __m128 oneMinusScale)
+{
+    const __m128 minChan = _mm_min_ps(grn, blu);
+
+    const __m128 a = _mm_sub_ps(_mm_mul_ps(f_H, oneMinusScale), EONE);
+    const __m128 b = _mm_sub_ps(red, _mm_mul_ps(_mm_mul_ps(f_H, _mm_add_ps(pivot, minChan)),
+                                                oneMinusScale));
+    const __m128 c = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, pivot), minChan), oneMinusScale);
+
+    const __m128 discrim = _mm_sub_ps(_mm_mul_ps(b, b),
+                                      _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.f), a), c));
+
+    return _mm_div_ps(_mm_sub_ps(_mm_sub_ps(EZERO, b), _mm_sqrt_ps(discrim)),
+                      _mm_mul_ps(_mm_set1_ps(2.f), a));
+}
+
+// Same as rgbToYC().
+inline __m128 RgbToYC(const __m128 red, const __m128 grn, const __m128 blu)
+{
+    const __m128 chroma
+        = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(blu, _mm_sub_ps(blu, grn)),
+                                            _mm_mul_ps(grn, _mm_sub_ps(grn, red))),
+                                 _mm_mul_ps(red, _mm_sub_ps(red, blu))));
+
+    const __m128 sum = _mm_add_ps(_mm_add_ps(blu, grn), red);
+    return _mm_div_ps(_mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(1.75f), chroma)), _mm_set1_ps(3.f));
+}
+
+// Same as SigmoidShaper().
+inline __m128 SigmoidShaper(const __m128 sat)
+{
+    const __m128 x = _mm_mul_ps(_mm_sub_ps(sat, _mm_set1_ps(0.4f)), _mm_set1_ps(5.f));
+    const __m128 sign = _mm_or_ps(_mm_and_ps(x, ESIGN_MASK), EONE);
+    const __m128 t = _mm_max_ps(_mm_sub_ps(EONE, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), sign), x)),
+                                EZERO);
+    return _mm_mul_ps(_mm_add_ps(EONE, _mm_mul_ps(sign, _mm_sub_ps(EONE, _mm_mul_ps(t, t)))),
+                      _mm_set1_ps(0.5f));
+}
+
+// Multiply the pixels by pow(Y, gamma) where Y is the clamped luminance.
+inline void ApplySurround(__m128 & red, __m128 & grn, __m128 & blu,
+                          const float (&weights)[3], const __m128 minLum, const __m128 gamma)
+{
+    const __m128 Y
+        = _mm_max_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(weights[0]), red),
+                                           _mm_mul_ps(_mm_set1_ps(weights[1]), grn)),
+                                _mm_mul_ps(_mm_set1_ps(weights[2]), blu)),
+                     minLum);
+
+    const __m128 Ypow_over_Y = ssePower(Y, gamma);
+
+    red = _mm_mul_ps(red, Ypow_over_Y);
+    grn = _mm_mul_ps(grn, Ypow_over_Y);
+    blu = _mm_mul_ps(blu, Ypow_over_Y);
+}
+
+// Same as Clamp().
+inline __m128 SSEClamp(const __m128 a, const __m128 min, const __m128 max)
+{
+    return _mm_min_ps(max, _mm_max_ps(a, min));
+}
+
+// Floor function using SSE2 i.e. the values are truncated then one is subtracted from the
+// negative non-integer values. The values too large to have a fractional part are unchanged.
+inline __m128 SSEFloor(const __m128 x)
+{
+    const __m128 trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+    const __m128 floor = _mm_sub_ps(trunc, _mm_and_ps(_mm_cmpgt_ps(trunc, x), EONE));
+    return sseSelect(_mm_cmplt_ps(_mm_and_ps(x, EABS_MASK), _mm_set1_ps(8388608.0f)), floor, x);
+}
+
+// Power function where the exponent is split into an integer part n, computed by repeated
+// squaring, and a fractional part frac using ssePower(). That keeps the relative error of the
+// approximation small for large exponents (e.g. the PQ curve). Values of x smaller or equal
+// to zero are mapped to zero.
+inline __m128 SSEPowerSplit(const __m128 x, unsigned n, const __m128 frac)
+{
+    __m128 res = ssePower(x, frac);
+    __m128 sq = x;
+    while (n)
+    {
+        if (n & 1)
+        {
+            res = _mm_mul_ps(res, sq);
+        }
+        n >>= 1;
+        sq = _mm_mul_ps(sq, sq);
+    }
+    return res;
+}
+
+// Copy the sign of the src values to the positive values of x.
+inline __m128 SSECopySign(const __m128 x, const __m128 src)
+{
+    return _mm_or_ps(x, _mm_and_ps(src, ESIGN_MASK));
+}
+
+} // anon.
+
+template<>
+void Renderer_SSE<Renderer_ACES_RedMod03_Fwd>::apply(const void * inImg, void * outImg,
+                                                     long numPixels) const
+{
+    const __m128 oneMinusScale = _mm_set1_ps(m_1minusScale);
+    const __m128 pivot         = _mm_set1_ps(m_pivot);
+    const __m128 inv_width     = _mm_set1_ps(m_inv_width);
+    const __m128 noiseLimit    = _mm_set1_ps(m_noiseLimit);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        const __m128 f_H = CalcHueWeight(red, grn, blu, inv_width);
+        const __m128 f_S = CalcSatWeight(red, grn, blu, noiseLimit);
+
+        // Hue is in range of the window, apply mod.
+        const __m128 flag = _mm_cmpgt_ps(f_H, EZERO);
+
+        const __m128 newRed = RedModFwd(red, f_H, f_S, pivot, oneMinusScale);
+        RestoreHue(flag, red, newRed, grn, blu);
+        red = sseSelect(flag, newRed, red);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_ACES_RedMod03_Inv>::apply(const void * inImg, void * outImg,
+                                                     long numPixels) const
+{
+    const __m128 oneMinusScale = _mm_set1_ps(m_1minusScale);
+    const __m128 pivot         = _mm_set1_ps(m_pivot);
+    const __m128 inv_width     = _mm_set1_ps(m_inv_width);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        const __m128 f_H = CalcHueWeight(red, grn, blu, inv_width);
+        const __m128 flag = _mm_cmpgt_ps(f_H, EZERO);
+
+        const __m128 newRed = RedModInv(red, grn, blu, f_H, pivot, oneMinusScale);
+        RestoreHue(flag, red, newRed, grn, blu);
+        red = sseSelect(flag, newRed, red);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_ACES_RedMod10_Fwd>::apply(const void * inImg, void * outImg,
+                                                     long numPixels) const
+{
+    const __m128 oneMinusScale = _mm_set1_ps(m_1minusScale);
+    const __m128 pivot         = _mm_set1_ps(m_pivot);
+    const __m128 inv_width     = _mm_set1_ps(m_inv_width);
+    const __m128 noiseLimit    = _mm_set1_ps(m_noiseLimit);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        const __m128 f_H = CalcHueWeight(red, grn, blu, inv_width);
+        const __m128 f_S = CalcSatWeight(red, grn, blu, noiseLimit);
+
+        red = sseSelect(_mm_cmpgt_ps(f_H, EZERO),
+                        RedModFwd(red, f_H, f_S, pivot, oneMinusScale), red);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_ACES_RedMod10_Inv>::apply(const void * inImg, void * outImg,
+                                                     long numPixels) const
+{
+    const __m128 oneMinusScale = _mm_set1_ps(m_1minusScale);
+    const __m128 pivot         = _mm_set1_ps(m_pivot);
+    const __m128 inv_width     = _mm_set1_ps(m_inv_width);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        const __m128 f_H = CalcHueWeight(red, grn, blu, inv_width);
+
+        red = sseSelect(_mm_cmpgt_ps(f_H, EZERO),
+                        RedModInv(red, grn, blu, f_H, pivot, oneMinusScale), red);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_ACES_Glow03_Fwd>::apply(const void * inImg, void * outImg,
+                                                   long numPixels) const
+{
+    const __m128 glowGain   = _mm_set1_ps(m_glowGain);
+    const __m128 GlowMid    = _mm_set1_ps(m_glowMid);
+    const __m128 noiseLimit = _mm_set1_ps(m_noiseLimit);
+
+    const __m128 highLimit = _mm_set1_ps(m_glowMid * 2.f);
+    const __m128 lowLimit  = _mm_set1_ps(m_glowMid * 2.f / 3.f);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        const __m128 YC = RgbToYC(red, grn, blu);
+        const __m128 sat = CalcSatWeight(red, grn, blu, noiseLimit);
+        const __m128 GlowGain = _mm_mul_ps(glowGain, SigmoidShaper(sat));
+
+        __m128 glowGainOut
+            = _mm_mul_ps(GlowGain, _mm_sub_ps(_mm_div_ps(GlowMid, YC), _mm_set1_ps(0.5f)));
+        glowGainOut = sseSelect(_mm_cmple_ps(YC, lowLimit), GlowGain, glowGainOut);
+        glowGainOut = _mm_andnot_ps(_mm_cmpge_ps(YC, highLimit), glowGainOut);
+
+        const __m128 addedGlow = _mm_add_ps(EONE, glowGainOut);
+
+        red = _mm_mul_ps(red, addedGlow);
+        grn = _mm_mul_ps(grn, addedGlow);
+        blu = _mm_mul_ps(blu, addedGlow);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_ACES_Glow03_Inv>::apply(const void * inImg, void * outImg,
+                                                   long numPixels) const
+{
+    const __m128 glowGain   = _mm_set1_ps(m_glowGain);
+    const __m128 GlowMid    = _mm_set1_ps(m_glowMid);
+    const __m128 noiseLimit = _mm_set1_ps(m_noiseLimit);
+
+    const __m128 highLimit = _mm_set1_ps(m_glowMid * 2.f);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        const __m128 YC = RgbToYC(red, grn, blu);
+        const __m128 sat = CalcSatWeight(red, grn, blu, noiseLimit);
+        const __m128 GlowGain = _mm_mul_ps(glowGain, SigmoidShaper(sat));
+
+        const __m128 onePlusGain = _mm_add_ps(EONE, GlowGain);
+        const __m128 lowLimit
+            = _mm_div_ps(_mm_mul_ps(_mm_mul_ps(onePlusGain, GlowMid), _mm_set1_ps(2.f)),
+                         _mm_set1_ps(3.f));
+
+        __m128 glowGainOut
+            = _mm_div_ps(_mm_mul_ps(GlowGain, _mm_sub_ps(_mm_div_ps(GlowMid, YC),
+                                                         _mm_set1_ps(0.5f))),
+                         _mm_sub_ps(_mm_mul_ps(GlowGain, _mm_set1_ps(0.5f)), EONE));
+        glowGainOut = sseSelect(_mm_cmple_ps(YC, lowLimit),
+                                _mm_div_ps(_mm_sub_ps(EZERO, GlowGain), onePlusGain),
+                                glowGainOut);
+        glowGainOut = _mm_andnot_ps(_mm_cmpge_ps(YC, highLimit), glowGainOut);
+
+        const __m128 reducedGlow = _mm_add_ps(EONE, glowGainOut);
+
+        red = _mm_mul_ps(red, reducedGlow);
+        grn = _mm_mul_ps(grn, reducedGlow);
+        blu = _mm_mul_ps(blu, reducedGlow);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_ACES_DarkToDim10_Fwd>::apply(const void * inImg, void * outImg,
+                                                        long numPixels) const
+{
+    static constexpr float weights[3]
+        = { 0.27222871678091454f, 0.67408176581114831f, 0.053689517407937051f };
+
+    const __m128 minLum = _mm_set1_ps(1e-10f);
+    const __m128 gamma  = _mm_set1_ps(m_gamma);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        ApplySurround(red, grn, blu, weights, minLum, gamma);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_REC2100_Surround>::apply(const void * inImg, void * outImg,
+                                                    long numPixels) const
+{
+    static constexpr float weights[3] = { 0.2627f, 0.6780f, 0.0593f };
+
+    const __m128 minLum = _mm_set1_ps(1e-4f);
+    const __m128 gamma  = _mm_set1_ps(m_gamma);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        ApplySurround(red, grn, blu, weights, minLum, gamma);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_RGB_TO_HSV>::apply(const void * inImg, void * outImg,
+                                              long numPixels) const
+{
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        const __m128 rgb_min = _mm_min_ps(blu, _mm_min_ps(grn, red));
+        const __m128 rgb_max = _mm_max_ps(blu, _mm_max_ps(grn, red));
+
+        const __m128 chroma = _mm_cmpneq_ps(rgb_min, rgb_max);
+        const __m128 delta = _mm_sub_ps(rgb_max, rgb_min);
+
+        // Sat
+        __m128 sat = _mm_and_ps(_mm_and_ps(chroma, _mm_cmpneq_ps(rgb_max, EZERO)),
+                                _mm_div_ps(delta, rgb_max));
+
+        // Hue
+        __m128 hue = _mm_add_ps(_mm_set1_ps(4.0f), _mm_div_ps(_mm_sub_ps(red, grn), delta));
+        hue = sseSelect(_mm_cmpeq_ps(grn, rgb_max),
+                        _mm_add_ps(_mm_set1_ps(2.0f), _mm_div_ps(_mm_sub_ps(blu, red), delta)),
+                        hue);
+        hue = sseSelect(_mm_cmpeq_ps(red, rgb_max), _mm_div_ps(_mm_sub_ps(grn, blu), delta), hue);
+        hue = _mm_add_ps(hue, _mm_and_ps(_mm_cmplt_ps(hue, EZERO), _mm_set1_ps(6.f)));
+        hue = _mm_and_ps(chroma, _mm_mul_ps(hue, _mm_set1_ps(0.16666666666666666f)));
+
+        // Handle extended range inputs.
+        const __m128 val
+            = _mm_add_ps(rgb_max, _mm_and_ps(_mm_cmplt_ps(rgb_min, EZERO), rgb_min));
+
+        const __m128 neg_min = _mm_sub_ps(EZERO, rgb_min);
+        sat = sseSelect(_mm_cmpgt_ps(neg_min, rgb_max), _mm_div_ps(delta, neg_min), sat);
+
+        red = hue;
+        grn = sat;
+        blu = val;
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_HSV_TO_RGB>::apply(const void * inImg, void * outImg,
+                                              long numPixels) const
+{
+    const __m128 two = _mm_set1_ps(2.f);
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        const __m128 hue = _mm_mul_ps(_mm_sub_ps(red, SSEFloor(red)), _mm_set1_ps(6.f));
+        const __m128 sat = SSEClamp(grn, EZERO, _mm_set1_ps(1.999f));
+        const __m128 val = blu;
+
+        const __m128 r = SSEClamp(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(hue, _mm_set1_ps(3.f)),
+                                                        EABS_MASK),
+                                             EONE),
+                                  EZERO, EONE);
+        const __m128 g = SSEClamp(_mm_sub_ps(two, _mm_and_ps(_mm_sub_ps(hue, two), EABS_MASK)),
+                                  EZERO, EONE);
+        const __m128 b = SSEClamp(_mm_sub_ps(two, _mm_and_ps(_mm_sub_ps(hue, _mm_set1_ps(4.f)),
+                                                             EABS_MASK)),
+                                  EZERO, EONE);
+
+        const __m128 oneMinusSat = _mm_sub_ps(EONE, sat);
+        const __m128 twoMinusSat = _mm_sub_ps(two, sat);
+
+        __m128 rgb_max = val;
+        __m128 rgb_min = _mm_mul_ps(val, oneMinusSat);
+
+        // Handle extended range inputs.
+        const __m128 satFlag = _mm_cmpgt_ps(sat, EONE);
+        rgb_min = sseSelect(satFlag, _mm_div_ps(_mm_mul_ps(val, oneMinusSat), twoMinusSat),
+                            rgb_min);
+        rgb_max = sseSelect(satFlag, _mm_sub_ps(val, rgb_min), rgb_max);
+
+        const __m128 valFlag = _mm_cmplt_ps(val, EZERO);
+        rgb_min = sseSelect(valFlag, _mm_div_ps(val, twoMinusSat), rgb_min);
+        rgb_max = sseSelect(valFlag, _mm_sub_ps(val, rgb_min), rgb_max);
+
+        const __m128 delta = _mm_sub_ps(rgb_max, rgb_min);
+
+        red = _mm_add_ps(_mm_mul_ps(r, delta), rgb_min);
+        grn = _mm_add_ps(_mm_mul_ps(g, delta), rgb_min);
+        blu = _mm_add_ps(_mm_mul_ps(b, delta), rgb_min);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_LIN_TO_PQ>::apply(const void * inImg, void * outImg,
+                                             long numPixels) const
+{
+    const __m128 scale = _mm_set1_ps(0.01f);
+    const __m128 m1    = _mm_set1_ps(ST2084::m1);
+    const __m128 m2    = _mm_set1_ps(ST2084::m2 - 78.f);
+    const __m128 c1    = _mm_set1_ps(ST2084::c1);
+    const __m128 c2    = _mm_set1_ps(ST2084::c2);
+    const __m128 c3    = _mm_set1_ps(ST2084::c3);
+
+    const auto linToPQ = [&](const __m128 v)
+    {
+        const __m128 L = _mm_mul_ps(_mm_and_ps(v, EABS_MASK), scale);
+        const __m128 y = ssePower(L, m1);
+        const __m128 ratpoly = _mm_div_ps(_mm_add_ps(c1, _mm_mul_ps(c2, y)),
+                                          _mm_add_ps(EONE, _mm_mul_ps(c3, y)));
+        return SSECopySign(SSEPowerSplit(ratpoly, 78, m2), v);
+    };
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        red = linToPQ(red);
+        grn = linToPQ(grn);
+        blu = linToPQ(blu);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_PQ_TO_LIN>::apply(const void * inImg, void * outImg,
+                                             long numPixels) const
+{
+    const __m128 scale  = _mm_set1_ps(100.f);
+    const __m128 inv_m1 = _mm_set1_ps(1.f / ST2084::m1 - 6.f);
+    const __m128 m2     = _mm_set1_ps(ST2084::m2 - 78.f);
+    const __m128 inv_m2 = _mm_set1_ps(1.f / ST2084::m2);
+    const __m128 c1     = _mm_set1_ps(ST2084::c1);
+    const __m128 c2     = _mm_set1_ps(ST2084::c2);
+    const __m128 c3     = _mm_set1_ps(ST2084::c3);
+
+    const auto pqToLin = [&](const __m128 v)
+    {
+        const __m128 N = _mm_min_ps(_mm_and_ps(v, EABS_MASK), EONE);
+        __m128 x = ssePower(N, inv_m2);
+
+        // The denominator amplifies the error of x close to 1.0 so refine it with a Newton
+        // iteration on pow(x, m2) = N, where it matters i.e. where x > c1.
+        const __m128 p = SSEPowerSplit(x, 78, m2);
+        const __m128 refined
+            = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, inv_m2), _mm_sub_ps(_mm_div_ps(N, p), EONE)));
+        x = sseSelect(_mm_cmpgt_ps(x, c1), refined, x);
+
+        const __m128 num = _mm_max_ps(_mm_sub_ps(x, c1), EZERO);
+        const __m128 den = _mm_sub_ps(c2, _mm_mul_ps(c3, x));
+        const __m128 L = SSEPowerSplit(_mm_div_ps(num, den), 6, inv_m1);
+        return SSECopySign(_mm_mul_ps(scale, L), v);
+    };
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        red = pqToLin(red);
+        grn = pqToLin(grn);
+        blu = pqToLin(blu);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_LIN_TO_HLG>::apply(const void * inImg, void * outImg,
+                                              long numPixels) const
+{
+    const __m128 three  = _mm_set1_ps(3.f);
+    const __m128 twelve = _mm_set1_ps(12.f);
+    const __m128 brk    = _mm_set1_ps(1.f / 12.f);
+    const __m128 a_ln2  = _mm_set1_ps(HLG::a * 0.6931471805599453f);
+    const __m128 b      = _mm_set1_ps(HLG::b);
+    const __m128 c      = _mm_set1_ps(HLG::c);
+
+    const auto linToHLG = [&](const __m128 v)
+    {
+        const __m128 E = _mm_and_ps(v, EABS_MASK);
+        const __m128 lo = _mm_sqrt_ps(_mm_mul_ps(three, E));
+        const __m128 hi = _mm_add_ps(_mm_mul_ps(a_ln2, sseLog2(_mm_sub_ps(_mm_mul_ps(twelve, E),
+                                                                          b))),
+                                     c);
+        return SSECopySign(sseSelect(_mm_cmple_ps(E, brk), lo, hi), v);
+    };
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        red = linToHLG(red);
+        grn = linToHLG(grn);
+        blu = linToHLG(blu);
+    });
+}
+
+template<>
+void Renderer_SSE<Renderer_HLG_TO_LIN>::apply(const void * inImg, void * outImg,
+                                              long numPixels) const
+{
+    const __m128 three    = _mm_set1_ps(3.f);
+    const __m128 twelve   = _mm_set1_ps(12.f);
+    const __m128 half     = _mm_set1_ps(0.5f);
+    const __m128 log2e_a  = _mm_set1_ps(1.4426950408889634f / HLG::a);
+    const __m128 b        = _mm_set1_ps(HLG::b);
+    const __m128 c        = _mm_set1_ps(HLG::c);
+
+    const auto hlgToLin = [&](const __m128 v)
+    {
+        const __m128 Ep = _mm_and_ps(v, EABS_MASK);
+        const __m128 lo = _mm_div_ps(_mm_mul_ps(Ep, Ep), three);
+        const __m128 hi = _mm_div_ps(_mm_add_ps(sseExp2(_mm_mul_ps(_mm_sub_ps(Ep, c), log2e_a)),
+                                                b),
+                                     twelve);
+        return SSECopySign(sseSelect(_mm_cmple_ps(Ep, half), lo, hi), v);
+    };
+
+    SSEApplyRGB((const float *)inImg, (float *)outImg, numPixels,
+                [&](__m128 & red, __m128 & grn, __m128 & blu)
+    {
+        red = hlgToLin(red);
+        grn = hlgToLin(grn);
+        blu = hlgToLin(blu);
+    });
+}
+
+#endif // USE_SSE
+
+#ifdef USE_AVX2
+
+template<>
+void Renderer_AVX2<Renderer_ACES_RedMod03_Fwd>::apply(const void * inImg, void * outImg,
+                                                      long numPixels) const
+{
+    ApplyACESRedModFwd_AVX2(true, m_1minusScale, m_pivot, m_inv_width, m_noiseLimit,
+                            (const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_ACES_RedMod03_Inv>::apply(const void * inImg, void * outImg,
+                                                      long numPixels) const
+{
+    ApplyACESRedModInv_AVX2(true, m_1minusScale, m_pivot, m_inv_width,
+                            (const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_ACES_RedMod10_Fwd>::apply(const void * inImg, void * outImg,
+                                                      long numPixels) const
+{
+    ApplyACESRedModFwd_AVX2(false, m_1minusScale, m_pivot, m_inv_width, m_noiseLimit,
+                            (const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_ACES_RedMod10_Inv>::apply(const void * inImg, void * outImg,
+                                                      long numPixels) const
+{
+    ApplyACESRedModInv_AVX2(false, m_1minusScale, m_pivot, m_inv_width,
+                            (const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_ACES_Glow03_Fwd>::apply(const void * inImg, void * outImg,
+                                                    long numPixels) const
+{
+    ApplyACESGlowFwd_AVX2(m_glowGain, m_glowMid, m_noiseLimit,
+                          (const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_ACES_Glow03_Inv>::apply(const void * inImg, void * outImg,
+                                                    long numPixels) const
+{
+    ApplyACESGlowInv_AVX2(m_glowGain, m_glowMid, m_noiseLimit,
+                          (const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_ACES_DarkToDim10_Fwd>::apply(const void * inImg, void * outImg,
+                                                         long numPixels) const
+{
+    static constexpr float weights[3]
+        = { 0.27222871678091454f, 0.67408176581114831f, 0.053689517407937051f };
+
+    ApplySurround_AVX2(weights, 1e-10f, m_gamma, (const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_REC2100_Surround>::apply(const void * inImg, void * outImg,
+                                                     long numPixels) const
+{
+    static constexpr float weights[3] = { 0.2627f, 0.6780f, 0.0593f };
+
+    ApplySurround_AVX2(weights, 1e-4f, m_gamma, (const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_RGB_TO_HSV>::apply(const void * inImg, void * outImg,
+                                               long numPixels) const
+{
+    ApplyRGBToHSV_AVX2((const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_HSV_TO_RGB>::apply(const void * inImg, void * outImg,
+                                               long numPixels) const
+{
+    ApplyHSVToRGB_AVX2((const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_LIN_TO_PQ>::apply(const void * inImg, void * outImg,
+                                              long numPixels) const
+{
+    ApplyLinToPQ_AVX2((const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_PQ_TO_LIN>::apply(const void * inImg, void * outImg,
+                                              long numPixels) const
+{
+    ApplyPQToLin_AVX2((const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_LIN_TO_HLG>::apply(const void * inImg, void * outImg,
+                                               long numPixels) const
+{
+    ApplyLinToHLG_AVX2((const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<>
+void Renderer_AVX2<Renderer_HLG_TO_LIN>::apply(const void * inImg, void * outImg,
+                                               long numPixels) const
+{
+    ApplyHLGToLin_AVX2((const float *)inImg, (float *)outImg, numPixels);
+}
+
+#endif // USE_AVX2
+
+namespace
+{
+
+// Create the renderer processing the pixels using AVX2 or SSE when available. Note that the
+// SIMD power function is an approximation so only use it if fastPower is true.
+template<typename Renderer, typename... Args>
+ConstOpCPURcPtr MakeRenderer(bool usePower, bool fastPower, Args && ... args)
+{
+#ifdef USE_SSE
+    if (!usePower || fastPower)
+    {
+#ifdef USE_AVX2
+        if (CPUInfo::Instance().hasAVX2())
+        {
+            return std::make_shared<Renderer_AVX2<Renderer>>(std::forward<Args>(args)...);
+        }
+#endif
+        return std::make_shared<Renderer_SSE<Renderer>>(std::forward<Args>(args)...);
+    }
+#else
+    std::ignore = usePower;
+    std::ignore = fastPower;
+#endif
+
+    return std::make_shared<Renderer>(std::forward<Args>(args)...);
+}
+
+} // anon.
+
 
 
 
@@ -1046,64 +2052,64 @@ void Renderer_LUV_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
 
 
 
-ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func)
+ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func, bool fastPower)
 {
     switch(func->getStyle())
     {
         case FixedFunctionOpData::ACES_RED_MOD_03_FWD:
         {
-            return std::make_shared<Renderer_ACES_RedMod03_Fwd>(func);
+            return MakeRenderer<Renderer_ACES_RedMod03_Fwd>(false, fastPower, func);
         }
         case FixedFunctionOpData::ACES_RED_MOD_03_INV:
         {
-            return std::make_shared<Renderer_ACES_RedMod03_Inv>(func);
+            return MakeRenderer<Renderer_ACES_RedMod03_Inv>(false, fastPower, func);
         }
         case FixedFunctionOpData::ACES_RED_MOD_10_FWD:
         {
-            return std::make_shared<Renderer_ACES_RedMod10_Fwd>(func);
+            return MakeRenderer<Renderer_ACES_RedMod10_Fwd>(false, fastPower, func);
         }
         case FixedFunctionOpData::ACES_RED_MOD_10_INV:
         {
-            return std::make_shared<Renderer_ACES_RedMod10_Inv>(func);
+            return MakeRenderer<Renderer_ACES_RedMod10_Inv>(false, fastPower, func);
         }
         case FixedFunctionOpData::ACES_GLOW_03_FWD:
         {
-            return std::make_shared<Renderer_ACES_Glow03_Fwd>(func, 0.075f, 0.1f);
+            return MakeRenderer<Renderer_ACES_Glow03_Fwd>(false, fastPower, func, 0.075f, 0.1f);
         }        
         case FixedFunctionOpData::ACES_GLOW_03_INV:
         {
-            return std::make_shared<Renderer_ACES_Glow03_Inv>(func, 0.075f, 0.1f);
+            return MakeRenderer<Renderer_ACES_Glow03_Inv>(false, fastPower, func, 0.075f, 0.1f);
         }        
         case FixedFunctionOpData::ACES_GLOW_10_FWD:
         {
-            return std::make_shared<Renderer_ACES_Glow03_Fwd>(func, 0.05f, 0.08f);
+            return MakeRenderer<Renderer_ACES_Glow03_Fwd>(false, fastPower, func, 0.05f, 0.08f);
         }
         case FixedFunctionOpData::ACES_GLOW_10_INV:
         {
-            return std::make_shared<Renderer_ACES_Glow03_Inv>(func, 0.05f, 0.08f);
+            return MakeRenderer<Renderer_ACES_Glow03_Inv>(false, fastPower, func, 0.05f, 0.08f);
         }
         case FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD:
         {
-            return std::make_shared<Renderer_ACES_DarkToDim10_Fwd>(func, 0.9811f);
+            return MakeRenderer<Renderer_ACES_DarkToDim10_Fwd>(true, fastPower, func, 0.9811f);
         }
         case FixedFunctionOpData::ACES_DARK_TO_DIM_10_INV:
         {
-            return std::make_shared<Renderer_ACES_DarkToDim10_Fwd>(func, 1.0192640913260627f);
+            return MakeRenderer<Renderer_ACES_DarkToDim10_Fwd>(true, fastPower, func, 1.0192640913260627f);
         }
         case FixedFunctionOpData::REC2100_SURROUND_FWD:
         case FixedFunctionOpData::REC2100_SURROUND_INV:
         {
             // Sharing same renderer (param will be inverted to handle direction).
-            return std::make_shared<Renderer_REC2100_Surround>(func);
+            return MakeRenderer<Renderer_REC2100_Surround>(true, fastPower, func);
         }
 
         case FixedFunctionOpData::RGB_TO_HSV:
         {
-            return std::make_shared<Renderer_RGB_TO_HSV>(func);
+            return MakeRenderer<Renderer_RGB_TO_HSV>(false, fastPower, func);
         }
         case FixedFunctionOpData::HSV_TO_RGB:
         {
-            return std::make_shared<Renderer_HSV_TO_RGB>(func);
+            return MakeRenderer<Renderer_HSV_TO_RGB>(false, fastPower, func);
         }
 
         case FixedFunctionOpData::XYZ_TO_xyY:
@@ -1132,6 +2138,24 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
         {
             return std::make_shared<Renderer_LUV_TO_XYZ>(func);
         }
+
+        case FixedFunctionOpData::LIN_TO_PQ:
+        {
+            return MakeRenderer<Renderer_LIN_TO_PQ>(true, fastPower, func);
+        }
+        case FixedFunctionOpData::PQ_TO_LIN:
+        {
+            return MakeRenderer<Renderer_PQ_TO_LIN>(true, fastPower, func);
+        }
+
+        case FixedFunctionOpData::LIN_TO_HLG:
+        {
+            return MakeRenderer<Renderer_LIN_TO_HLG>(true, fastPower, func);
+        }
+        case FixedFunctionOpData::HLG_TO_LIN:
+        {
+            return MakeRenderer<Renderer_HLG_TO_LIN>(true, fastPower, func);
+        }
     }
 
     throw Exception("Unsupported FixedFunction style");
@@ -14,7 +14,27 @@
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func);
+// Constants of the SMPTE ST 2084 (PQ) curve.
+namespace ST2084
+{
+constexpr float m1 = 0.1593017578125f;  // 2610 / 16384
+constexpr float m2 = 78.84375f;         // 2523 / 32
+constexpr float c1 = 0.8359375f;        // 3424 / 4096
+constexpr float c2 = 18.8515625f;       // 2413 / 128
+constexpr float c3 = 18.6875f;          // 2392 / 128
+}
+
+// Constants of the Rec.2100 HLG curve.
+namespace HLG
+{
+constexpr float a = 0.17883277f;
+constexpr float b = 0.28466892f;        // 1 - 4 * a
+constexpr float c = 0.55991073f;        // 0.5 - a * ln(4 * a)
+}
+
+// The renderers use SSE or AVX2 when available. As the SIMD power function is an approximation,
+// the styles relying on it are only vectorized if fastPower is true.
+ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func, bool fastPower);
 
 } // namespace OCIO_NAMESPACE
 
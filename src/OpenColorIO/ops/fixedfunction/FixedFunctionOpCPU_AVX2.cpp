@@ -0,0 +1,605 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/fixedfunction/FixedFunctionOpCPU.h"
+#include "ops/fixedfunction/FixedFunctionOpCPU_AVX2.h"
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Note: Same math as the SSE renderers from FixedFunctionOpCPU.cpp, but processing eight
+// pixels at a time.
+
+namespace
+{
+
+// Transpose the four registers holding two RGBA pixels each i.e. the registers then hold the
+// red, green, blue & alpha channels of the pixels { 0, 2, 4, 6, 1, 3, 5, 7 }. As the
+// transposition is its own inverse, it also restores the pixels.
+inline void Transpose(__m256 (&v)[4])
+{
+    const __m256 t0 = _mm256_unpacklo_ps(v[0], v[1]);
+    const __m256 t1 = _mm256_unpackhi_ps(v[0], v[1]);
+    const __m256 t2 = _mm256_unpacklo_ps(v[2], v[3]);
+    const __m256 t3 = _mm256_unpackhi_ps(v[2], v[3]);
+
+    v[0] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    v[1] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    v[2] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    v[3] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// Call func on packed RGBA float pixels, eight pixels at a time, where func takes and updates
+// the red, green & blue channels of the eight pixels. The alpha channel is left unchanged and
+// the in and out buffers could be the same buffer.
+template<typename Func>
+void AVX2ApplyRGB(const float * in, float * out, long numPixels, const Func & func)
+{
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        __m256 v[4] = { _mm256_loadu_ps(in),      _mm256_loadu_ps(in + 8),
+                        _mm256_loadu_ps(in + 16), _mm256_loadu_ps(in + 24) };
+        Transpose(v);
+
+        func(v[0], v[1], v[2]);
+
+        Transpose(v);
+        _mm256_storeu_ps(out,      v[0]);
+        _mm256_storeu_ps(out + 8,  v[1]);
+        _mm256_storeu_ps(out + 16, v[2]);
+        _mm256_storeu_ps(out + 24, v[3]);
+
+        in  += 32;
+        out += 32;
+    }
+
+    if (idx < numPixels)
+    {
+        const long remaining = 4 * (numPixels - idx);
+
+        float buffer[32];
+        for (long i = 0; i < 32; ++i)
+        {
+            buffer[i] = i < remaining ? in[i] : 0.0f;
+        }
+
+        AVX2ApplyRGB(buffer, buffer, 8, func);
+
+        for (long i = 0; i < remaining; ++i)
+        {
+            out[i] = buffer[i];
+        }
+    }
+}
+
+inline __m256 Set(float v)
+{
+    return _mm256_set1_ps(v);
+}
+
+// Accurate arc tangent of y/x in the range [-pi, pi], see AccurateAtan2() in
+// FixedFunctionOpCPU.cpp.
+inline __m256 AccurateAtan2(const __m256 y, const __m256 x)
+{
+    const __m256 absY = avx2Abs(y);
+    const __m256 absX = avx2Abs(x);
+
+    // Reduce the argument to [0, 1] using atan(y/x) = pi/2 - atan(x/y).
+    const __m256 swap  = _mm256_cmp_ps(absY, absX, _CMP_GT_OQ);
+    const __m256 num   = avx2Select(swap, absX, absY);
+    const __m256 denom = avx2Select(swap, absY, absX);
+
+    // Note that atan2(0, 0) is 0.
+    __m256 t = _mm256_and_ps(_mm256_div_ps(num, denom),
+                             _mm256_cmp_ps(denom, _mm256_setzero_ps(), _CMP_NEQ_UQ));
+
+    // Reduce the argument to [0, tan(pi/8)] using atan(t) = pi/4 + atan((t-1) / (t+1)).
+    const __m256 reduce = _mm256_cmp_ps(t, Set(0.4142135623730950f), _CMP_GT_OQ);
+    t = avx2Select(reduce, _mm256_div_ps(_mm256_sub_ps(t, Set(1.f)), _mm256_add_ps(t, Set(1.f))), t);
+
+    const __m256 z = _mm256_mul_ps(t, t);
+
+    __m256 res = Set(8.05374449538e-2f);
+    res = _mm256_sub_ps(_mm256_mul_ps(res, z), Set(1.38776856032e-1f));
+    res = _mm256_add_ps(_mm256_mul_ps(res, z), Set(1.99777106478e-1f));
+    res = _mm256_sub_ps(_mm256_mul_ps(res, z), Set(3.33329491539e-1f));
+    res = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(res, z), t), t);
+
+    res = _mm256_add_ps(res, _mm256_and_ps(reduce, Set(0.78539816339744830962f)));
+    res = avx2Select(swap, _mm256_sub_ps(Set(1.57079632679489661923f), res), res);
+
+    // Adjust the quadrants 2 & 3 and restore the sign.
+    res = avx2Select(avx2Sign(x), _mm256_sub_ps(Set(3.14159265358979323846f), res), res);
+    return _mm256_or_ps(res, avx2Sign(y));
+}
+
+inline __m256 CalcSatWeight(const __m256 red, const __m256 grn, const __m256 blu,
+                            const __m256 noiseLimit)
+{
+    const __m256 minVal = _mm256_min_ps(_mm256_min_ps(blu, grn), red);
+    const __m256 maxVal = _mm256_max_ps(_mm256_max_ps(blu, grn), red);
+
+    const __m256 limit = Set(1e-10f);
+
+    return _mm256_div_ps(_mm256_sub_ps(_mm256_max_ps(maxVal, limit), _mm256_max_ps(minVal, limit)),
+                         _mm256_max_ps(maxVal, noiseLimit));
+}
+
+inline __m256 CalcHueWeight(const __m256 red, const __m256 grn, const __m256 blu,
+                            const __m256 inv_width)
+{
+    const __m256 a = _mm256_sub_ps(_mm256_mul_ps(Set(2.f), red), _mm256_add_ps(grn, blu));
+    const __m256 b = _mm256_mul_ps(Set(1.7320508075688772f), _mm256_sub_ps(grn, blu));
+
+    const __m256 hue = AccurateAtan2(b, a);
+
+    const __m256 knot_coord = _mm256_add_ps(_mm256_mul_ps(hue, inv_width), Set(2.f));
+    const __m256i j = _mm256_cvttps_epi32(knot_coord);
+    const __m256 t = _mm256_sub_ps(knot_coord, _mm256_cvtepi32_ps(j));
+
+    const __m256 j0 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(j, _mm256_set1_epi32(0)));
+    const __m256 j1 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(j, _mm256_set1_epi32(1)));
+    const __m256 j2 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(j, _mm256_set1_epi32(2)));
+    const __m256 j3 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(j, _mm256_set1_epi32(3)));
+
+    auto coef = [&](float c0, float c1, float c2, float c3)
+    {
+        return avx2Select(j0, Set(c0), avx2Select(j1, Set(c1), avx2Select(j2, Set(c2), Set(c3))));
+    };
+
+    const __m256 coefs0 = coef( 0.25f, -0.75f,  0.75f, -0.25f);
+    const __m256 coefs1 = coef( 0.00f,  0.75f, -1.50f,  0.75f);
+    const __m256 coefs2 = coef( 0.00f,  0.75f,  0.00f, -0.75f);
+    const __m256 coefs3 = coef( 0.00f,  0.25f,  1.00f,  0.25f);
+
+    __m256 f_H = _mm256_add_ps(_mm256_mul_ps(t, coefs0), coefs1);
+    f_H = _mm256_add_ps(_mm256_mul_ps(t, f_H), coefs2);
+    f_H = _mm256_add_ps(_mm256_mul_ps(t, f_H), coefs3);
+
+    // The hue is outside of the window.
+    return _mm256_and_ps(f_H, _mm256_or_ps(_mm256_or_ps(j0, j1), _mm256_or_ps(j2, j3)));
+}
+
+inline void RestoreHue(const __m256 flag, const __m256 red, const __m256 newRed,
+                       __m256 & grn, __m256 & blu)
+{
+    const __m256 limit = Set(1e-10f);
+
+    // red >= grn >= blu
+    const __m256 hue_facG = _mm256_div_ps(_mm256_sub_ps(grn, blu),
+                                          _mm256_max_ps(_mm256_sub_ps(red, blu), limit));
+    const __m256 newGrn = _mm256_add_ps(_mm256_mul_ps(hue_facG, _mm256_sub_ps(newRed, blu)), blu);
+
+    // red >= blu >= grn
+    const __m256 hue_facB = _mm256_div_ps(_mm256_sub_ps(blu, grn),
+                                          _mm256_max_ps(_mm256_sub_ps(red, grn), limit));
+    const __m256 newBlu = _mm256_add_ps(_mm256_mul_ps(hue_facB, _mm256_sub_ps(newRed, grn)), grn);
+
+    const __m256 grnGEblu = _mm256_cmp_ps(grn, blu, _CMP_GE_OQ);
+
+    grn = avx2Select(_mm256_and_ps(flag, grnGEblu), newGrn, grn);
+    blu = avx2Select(_mm256_andnot_ps(grnGEblu, flag), newBlu, blu);
+}
+
+inline __m256 RgbToYC(const __m256 red, const __m256 grn, const __m256 blu)
+{
+    const __m256 chroma
+        = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(blu, _mm256_sub_ps(blu, grn)),
+                                                     _mm256_mul_ps(grn, _mm256_sub_ps(grn, red))),
+                                       _mm256_mul_ps(red, _mm256_sub_ps(red, blu))));
+
+    const __m256 sum = _mm256_add_ps(_mm256_add_ps(blu, grn), red);
+    return _mm256_div_ps(_mm256_add_ps(sum, _mm256_mul_ps(Set(1.75f), chroma)), Set(3.f));
+}
+
+inline __m256 SigmoidShaper(const __m256 sat)
+{
+    const __m256 one = Set(1.f);
+
+    const __m256 x = _mm256_mul_ps(_mm256_sub_ps(sat, Set(0.4f)), Set(5.f));
+    const __m256 sign = _mm256_or_ps(avx2Sign(x), one);
+    const __m256 t = _mm256_max_ps(_mm256_sub_ps(one, _mm256_mul_ps(_mm256_mul_ps(Set(0.5f), sign), x)),
+                                   _mm256_setzero_ps());
+    return _mm256_mul_ps(_mm256_add_ps(one, _mm256_mul_ps(sign, _mm256_sub_ps(one, _mm256_mul_ps(t, t)))),
+                         Set(0.5f));
+}
+
+inline __m256 Clamp(const __m256 a, const __m256 min, const __m256 max)
+{
+    return _mm256_min_ps(max, _mm256_max_ps(a, min));
+}
+
+// Same as SSEPowerSplit().
+inline __m256 PowerSplit(const __m256 x, unsigned n, const __m256 frac)
+{
+    __m256 res = avx2Power(x, frac);
+    __m256 sq = x;
+    while (n)
+    {
+        if (n & 1)
+        {
+            res = _mm256_mul_ps(res, sq);
+        }
+        n >>= 1;
+        sq = _mm256_mul_ps(sq, sq);
+    }
+    return res;
+}
+
+// Copy the sign of the src values to the positive values of x.
+inline __m256 CopySign(const __m256 x, const __m256 src)
+{
+    return _mm256_or_ps(x, avx2Sign(src));
+}
+
+} // anon.
+
+void ApplyACESRedModFwd_AVX2(bool restoreHue, float oneMinusScale, float pivot, float invWidth,
+                             float noiseLimit, const float * in, float * out, long numPixels)
+{
+    const __m256 oneMinusScaleV = Set(oneMinusScale);
+    const __m256 pivotV         = Set(pivot);
+    const __m256 inv_width      = Set(invWidth);
+    const __m256 noiseLimitV    = Set(noiseLimit);
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        const __m256 f_H = CalcHueWeight(red, grn, blu, inv_width);
+        const __m256 f_S = CalcSatWeight(red, grn, blu, noiseLimitV);
+
+        // Hue is in range of the window, apply mod.
+        const __m256 flag = _mm256_cmp_ps(f_H, _mm256_setzero_ps(), _CMP_GT_OQ);
+
+        const __m256 newRed
+            = _mm256_add_ps(red, _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(f_H, f_S),
+                                                             _mm256_sub_ps(pivotV, red)),
+                                               oneMinusScaleV));
+        if (restoreHue)
+        {
+            RestoreHue(flag, red, newRed, grn, blu);
+        }
+        red = avx2Select(flag, newRed, red);
+    });
+}
+
+void ApplyACESRedModInv_AVX2(bool restoreHue, float oneMinusScale, float pivot, float invWidth,
+                             const float * in, float * out, long numPixels)
+{
+    const __m256 oneMinusScaleV = Set(oneMinusScale);
+    const __m256 pivotV         = Set(pivot);
+    const __m256 inv_width      = Set(invWidth);
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        const __m256 f_H = CalcHueWeight(red, grn, blu, inv_width);
+        const __m256 flag = _mm256_cmp_ps(f_H, _mm256_setzero_ps(), _CMP_GT_OQ);
+
+        const __m256 minChan = _mm256_min_ps(grn, blu);
+
+        const __m256 a = _mm256_sub_ps(_mm256_mul_ps(f_H, oneMinusScaleV), Set(1.f));
+        const __m256 b
+            = _mm256_sub_ps(red, _mm256_mul_ps(_mm256_mul_ps(f_H, _mm256_add_ps(pivotV, minChan)),
+                                               oneMinusScaleV));
+        const __m256 c
+            = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(f_H, pivotV), minChan), oneMinusScaleV);
+
+        const __m256 discrim = _mm256_sub_ps(_mm256_mul_ps(b, b),
+                                             _mm256_mul_ps(_mm256_mul_ps(Set(4.f), a), c));
+
+        const __m256 newRed
+            = _mm256_div_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_setzero_ps(), b),
+                                          _mm256_sqrt_ps(discrim)),
+                            _mm256_mul_ps(Set(2.f), a));
+        if (restoreHue)
+        {
+            RestoreHue(flag, red, newRed, grn, blu);
+        }
+        red = avx2Select(flag, newRed, red);
+    });
+}
+
+void ApplyACESGlowFwd_AVX2(float glowGain, float glowMid, float noiseLimit,
+                           const float * in, float * out, long numPixels)
+{
+    const __m256 glowGainV   = Set(glowGain);
+    const __m256 GlowMid     = Set(glowMid);
+    const __m256 noiseLimitV = Set(noiseLimit);
+
+    const __m256 highLimit = Set(glowMid * 2.f);
+    const __m256 lowLimit  = Set(glowMid * 2.f / 3.f);
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        const __m256 YC = RgbToYC(red, grn, blu);
+        const __m256 sat = CalcSatWeight(red, grn, blu, noiseLimitV);
+        const __m256 GlowGain = _mm256_mul_ps(glowGainV, SigmoidShaper(sat));
+
+        __m256 glowGainOut
+            = _mm256_mul_ps(GlowGain, _mm256_sub_ps(_mm256_div_ps(GlowMid, YC), Set(0.5f)));
+        glowGainOut = avx2Select(_mm256_cmp_ps(YC, lowLimit, _CMP_LE_OQ), GlowGain, glowGainOut);
+        glowGainOut = _mm256_andnot_ps(_mm256_cmp_ps(YC, highLimit, _CMP_GE_OQ), glowGainOut);
+
+        const __m256 addedGlow = _mm256_add_ps(Set(1.f), glowGainOut);
+
+        red = _mm256_mul_ps(red, addedGlow);
+        grn = _mm256_mul_ps(grn, addedGlow);
+        blu = _mm256_mul_ps(blu, addedGlow);
+    });
+}
+
+void ApplyACESGlowInv_AVX2(float glowGain, float glowMid, float noiseLimit,
+                           const float * in, float * out, long numPixels)
+{
+    const __m256 glowGainV   = Set(glowGain);
+    const __m256 GlowMid     = Set(glowMid);
+    const __m256 noiseLimitV = Set(noiseLimit);
+
+    const __m256 highLimit = Set(glowMid * 2.f);
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        const __m256 YC = RgbToYC(red, grn, blu);
+        const __m256 sat = CalcSatWeight(red, grn, blu, noiseLimitV);
+        const __m256 GlowGain = _mm256_mul_ps(glowGainV, SigmoidShaper(sat));
+
+        const __m256 onePlusGain = _mm256_add_ps(Set(1.f), GlowGain);
+        const __m256 lowLimit
+            = _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(onePlusGain, GlowMid), Set(2.f)), Set(3.f));
+
+        __m256 glowGainOut
+            = _mm256_div_ps(_mm256_mul_ps(GlowGain, _mm256_sub_ps(_mm256_div_ps(GlowMid, YC),
+                                                                  Set(0.5f))),
+                            _mm256_sub_ps(_mm256_mul_ps(GlowGain, Set(0.5f)), Set(1.f)));
+        glowGainOut = avx2Select(_mm256_cmp_ps(YC, lowLimit, _CMP_LE_OQ),
+                                 _mm256_div_ps(_mm256_sub_ps(_mm256_setzero_ps(), GlowGain),
+                                               onePlusGain),
+                                 glowGainOut);
+        glowGainOut = _mm256_andnot_ps(_mm256_cmp_ps(YC, highLimit, _CMP_GE_OQ), glowGainOut);
+
+        const __m256 reducedGlow = _mm256_add_ps(Set(1.f), glowGainOut);
+
+        red = _mm256_mul_ps(red, reducedGlow);
+        grn = _mm256_mul_ps(grn, reducedGlow);
+        blu = _mm256_mul_ps(blu, reducedGlow);
+    });
+}
+
+void ApplySurround_AVX2(const float (&weights)[3], float minLum, float gamma,
+                        const float * in, float * out, long numPixels)
+{
+    const __m256 weightR = Set(weights[0]);
+    const __m256 weightG = Set(weights[1]);
+    const __m256 weightB = Set(weights[2]);
+    const __m256 minLumV = Set(minLum);
+    const __m256 gammaV  = Set(gamma);
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        const __m256 Y
+            = _mm256_max_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(weightR, red),
+                                                        _mm256_mul_ps(weightG, grn)),
+                                          _mm256_mul_ps(weightB, blu)),
+                            minLumV);
+
+        const __m256 Ypow_over_Y = avx2Power(Y, gammaV);
+
+        red = _mm256_mul_ps(red, Ypow_over_Y);
+        grn = _mm256_mul_ps(grn, Ypow_over_Y);
+        blu = _mm256_mul_ps(blu, Ypow_over_Y);
+    });
+}
+
+void ApplyRGBToHSV_AVX2(const float * in, float * out, long numPixels)
+{
+    const __m256 zero = _mm256_setzero_ps();
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        const __m256 rgb_min = _mm256_min_ps(blu, _mm256_min_ps(grn, red));
+        const __m256 rgb_max = _mm256_max_ps(blu, _mm256_max_ps(grn, red));
+
+        const __m256 chroma = _mm256_cmp_ps(rgb_min, rgb_max, _CMP_NEQ_UQ);
+        const __m256 delta = _mm256_sub_ps(rgb_max, rgb_min);
+
+        // Sat
+        __m256 sat = _mm256_and_ps(_mm256_and_ps(chroma, _mm256_cmp_ps(rgb_max, zero, _CMP_NEQ_UQ)),
+                                   _mm256_div_ps(delta, rgb_max));
+
+        // Hue
+        __m256 hue = _mm256_add_ps(Set(4.0f), _mm256_div_ps(_mm256_sub_ps(red, grn), delta));
+        hue = avx2Select(_mm256_cmp_ps(grn, rgb_max, _CMP_EQ_OQ),
+                         _mm256_add_ps(Set(2.0f), _mm256_div_ps(_mm256_sub_ps(blu, red), delta)),
+                         hue);
+        hue = avx2Select(_mm256_cmp_ps(red, rgb_max, _CMP_EQ_OQ),
+                         _mm256_div_ps(_mm256_sub_ps(grn, blu), delta),
+                         hue);
+        hue = _mm256_add_ps(hue, _mm256_and_ps(_mm256_cmp_ps(hue, zero, _CMP_LT_OQ), Set(6.f)));
+        hue = _mm256_and_ps(chroma, _mm256_mul_ps(hue, Set(0.16666666666666666f)));
+
+        // Handle extended range inputs.
+        const __m256 val
+            = _mm256_add_ps(rgb_max,
+                            _mm256_and_ps(_mm256_cmp_ps(rgb_min, zero, _CMP_LT_OQ), rgb_min));
+
+        const __m256 neg_min = _mm256_sub_ps(zero, rgb_min);
+        sat = avx2Select(_mm256_cmp_ps(neg_min, rgb_max, _CMP_GT_OQ),
+                         _mm256_div_ps(delta, neg_min),
+                         sat);
+
+        red = hue;
+        grn = sat;
+        blu = val;
+    });
+}
+
+void ApplyHSVToRGB_AVX2(const float * in, float * out, long numPixels)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one  = Set(1.f);
+    const __m256 two  = Set(2.f);
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        const __m256 hue = _mm256_mul_ps(_mm256_sub_ps(red, _mm256_floor_ps(red)), Set(6.f));
+        const __m256 sat = Clamp(grn, zero, Set(1.999f));
+        const __m256 val = blu;
+
+        const __m256 r = Clamp(_mm256_sub_ps(avx2Abs(_mm256_sub_ps(hue, Set(3.f))), one), zero, one);
+        const __m256 g = Clamp(_mm256_sub_ps(two, avx2Abs(_mm256_sub_ps(hue, two))), zero, one);
+        const __m256 b = Clamp(_mm256_sub_ps(two, avx2Abs(_mm256_sub_ps(hue, Set(4.f)))), zero, one);
+
+        const __m256 oneMinusSat = _mm256_sub_ps(one, sat);
+        const __m256 twoMinusSat = _mm256_sub_ps(two, sat);
+
+        __m256 rgb_max = val;
+        __m256 rgb_min = _mm256_mul_ps(val, oneMinusSat);
+
+        // Handle extended range inputs.
+        const __m256 satFlag = _mm256_cmp_ps(sat, one, _CMP_GT_OQ);
+        rgb_min = avx2Select(satFlag, _mm256_div_ps(_mm256_mul_ps(val, oneMinusSat), twoMinusSat),
+                             rgb_min);
+        rgb_max = avx2Select(satFlag, _mm256_sub_ps(val, rgb_min), rgb_max);
+
+        const __m256 valFlag = _mm256_cmp_ps(val, zero, _CMP_LT_OQ);
+        rgb_min = avx2Select(valFlag, _mm256_div_ps(val, twoMinusSat), rgb_min);
+        rgb_max = avx2Select(valFlag, _mm256_sub_ps(val, rgb_min), rgb_max);
+
+        const __m256 delta = _mm256_sub_ps(rgb_max, rgb_min);
+
+        red = _mm256_add_ps(_mm256_mul_ps(r, delta), rgb_min);
+        grn = _mm256_add_ps(_mm256_mul_ps(g, delta), rgb_min);
+        blu = _mm256_add_ps(_mm256_mul_ps(b, delta), rgb_min);
+    });
+}
+
+void ApplyLinToPQ_AVX2(const float * in, float * out, long numPixels)
+{
+    const __m256 scale = Set(0.01f);
+    const __m256 one   = Set(1.f);
+    const __m256 m1    = Set(ST2084::m1);
+    const __m256 m2    = Set(ST2084::m2 - 78.f);
+    const __m256 c1    = Set(ST2084::c1);
+    const __m256 c2    = Set(ST2084::c2);
+    const __m256 c3    = Set(ST2084::c3);
+
+    const auto linToPQ = [&](const __m256 v)
+    {
+        const __m256 L = _mm256_mul_ps(avx2Abs(v), scale);
+        const __m256 y = avx2Power(L, m1);
+        const __m256 ratpoly = _mm256_div_ps(_mm256_add_ps(c1, _mm256_mul_ps(c2, y)),
+                                             _mm256_add_ps(one, _mm256_mul_ps(c3, y)));
+        return CopySign(PowerSplit(ratpoly, 78, m2), v);
+    };
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        red = linToPQ(red);
+        grn = linToPQ(grn);
+        blu = linToPQ(blu);
+    });
+}
+
+void ApplyPQToLin_AVX2(const float * in, float * out, long numPixels)
+{
+    const __m256 zero   = _mm256_setzero_ps();
+    const __m256 one    = Set(1.f);
+    const __m256 scale  = Set(100.f);
+    const __m256 inv_m1 = Set(1.f / ST2084::m1 - 6.f);
+    const __m256 m2     = Set(ST2084::m2 - 78.f);
+    const __m256 inv_m2 = Set(1.f / ST2084::m2);
+    const __m256 c1     = Set(ST2084::c1);
+    const __m256 c2     = Set(ST2084::c2);
+    const __m256 c3     = Set(ST2084::c3);
+
+    const auto pqToLin = [&](const __m256 v)
+    {
+        const __m256 N = _mm256_min_ps(avx2Abs(v), one);
+        __m256 x = avx2Power(N, inv_m2);
+
+        // Newton iteration on pow(x, m2) = N where x > c1.
+        const __m256 p = PowerSplit(x, 78, m2);
+        const __m256 refined
+            = _mm256_add_ps(x, _mm256_mul_ps(_mm256_mul_ps(x, inv_m2),
+                                             _mm256_sub_ps(_mm256_div_ps(N, p), one)));
+        x = avx2Select(_mm256_cmp_ps(x, c1, _CMP_GT_OQ), refined, x);
+        const __m256 num = _mm256_max_ps(_mm256_sub_ps(x, c1), zero);
+        const __m256 den = _mm256_sub_ps(c2, _mm256_mul_ps(c3, x));
+        const __m256 L = PowerSplit(_mm256_div_ps(num, den), 6, inv_m1);
+        return CopySign(_mm256_mul_ps(scale, L), v);
+    };
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        red = pqToLin(red);
+        grn = pqToLin(grn);
+        blu = pqToLin(blu);
+    });
+}
+
+void ApplyLinToHLG_AVX2(const float * in, float * out, long numPixels)
+{
+    const __m256 three  = Set(3.f);
+    const __m256 twelve = Set(12.f);
+    const __m256 brk    = Set(1.f / 12.f);
+    const __m256 a_ln2  = Set(HLG::a * 0.6931471805599453f);
+    const __m256 b      = Set(HLG::b);
+    const __m256 c      = Set(HLG::c);
+
+    const auto linToHLG = [&](const __m256 v)
+    {
+        const __m256 E = avx2Abs(v);
+        const __m256 lo = _mm256_sqrt_ps(_mm256_mul_ps(three, E));
+        const __m256 hi
+            = _mm256_add_ps(_mm256_mul_ps(a_ln2,
+                                          avx2Log2(_mm256_sub_ps(_mm256_mul_ps(twelve, E), b))),
+                            c);
+        return CopySign(avx2Select(_mm256_cmp_ps(E, brk, _CMP_LE_OQ), lo, hi), v);
+    };
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        red = linToHLG(red);
+        grn = linToHLG(grn);
+        blu = linToHLG(blu);
+    });
+}
+
+void ApplyHLGToLin_AVX2(const float * in, float * out, long numPixels)
+{
+    const __m256 three   = Set(3.f);
+    const __m256 twelve  = Set(12.f);
+    const __m256 half    = Set(0.5f);
+    const __m256 log2e_a = Set(1.4426950408889634f / HLG::a);
+    const __m256 b       = Set(HLG::b);
+    const __m256 c       = Set(HLG::c);
+
+    const auto hlgToLin = [&](const __m256 v)
+    {
+        const __m256 Ep = avx2Abs(v);
+        const __m256 lo = _mm256_div_ps(_mm256_mul_ps(Ep, Ep), three);
+        const __m256 hi
+            = _mm256_div_ps(_mm256_add_ps(avx2Exp2(_mm256_mul_ps(_mm256_sub_ps(Ep, c), log2e_a)),
+                                          b),
+                            twelve);
+        return CopySign(avx2Select(_mm256_cmp_ps(Ep, half, _CMP_LE_OQ), lo, hi), v);
+    };
+
+    AVX2ApplyRGB(in, out, numPixels, [&](__m256 & red, __m256 & grn, __m256 & blu)
+    {
+        red = hlgToLin(red);
+        grn = hlgToLin(grn);
+        blu = hlgToLin(blu);
+    });
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_FIXEDFUNCTION_CPU_AVX2_H
+#define INCLUDED_OCIO_FIXEDFUNCTION_CPU_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Only call these functions if CPUInfo::hasAVX2() is true. They apply the FixedFunction styles
+// to packed RGBA float pixels, eight pixels at a time, using the same math as the SSE renderers
+// from FixedFunctionOpCPU.cpp. The alpha channel is left unchanged.
+
+// ACES red modifier where restoreHue is true for the 0.3 version (i.e. the green or blue
+// channel is also adjusted to preserve the hue).
+void ApplyACESRedModFwd_AVX2(bool restoreHue, float oneMinusScale, float pivot, float invWidth,
+                             float noiseLimit, const float * in, float * out, long numPixels);
+void ApplyACESRedModInv_AVX2(bool restoreHue, float oneMinusScale, float pivot, float invWidth,
+                             const float * in, float * out, long numPixels);
+
+// ACES glow.
+void ApplyACESGlowFwd_AVX2(float glowGain, float glowMid, float noiseLimit,
+                           const float * in, float * out, long numPixels);
+void ApplyACESGlowInv_AVX2(float glowGain, float glowMid, float noiseLimit,
+                           const float * in, float * out, long numPixels);
+
+// Surround correction i.e. the pixels are multiplied by pow(max(minLum, Y), gamma) where Y is
+// the luminance computed with the weights. It uses the power function approximation.
+void ApplySurround_AVX2(const float (&weights)[3], float minLum, float gamma,
+                        const float * in, float * out, long numPixels);
+
+// Conversions between RGB and HSV.
+void ApplyRGBToHSV_AVX2(const float * in, float * out, long numPixels);
+void ApplyHSVToRGB_AVX2(const float * in, float * out, long numPixels);
+
+// SMPTE ST 2084 (PQ) & Rec.2100 HLG transfer functions. They use the power, log & exp
+// function approximations.
+void ApplyLinToPQ_AVX2(const float * in, float * out, long numPixels);
+void ApplyPQToLin_AVX2(const float * in, float * out, long numPixels);
+void ApplyLinToHLG_AVX2(const float * in, float * out, long numPixels);
+void ApplyHLGToLin_AVX2(const float * in, float * out, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
@@ -37,6 +37,10 @@ constexpr char XYZ_TO_uvY_STR[]            = "XYZ_TO_uvY";
 constexpr char uvY_TO_XYZ_STR[]            = "uvY_TO_XYZ";
 constexpr char XYZ_TO_LUV_STR[]            = "XYZ_TO_LUV";
 constexpr char LUV_TO_XYZ_STR[]            = "LUV_TO_XYZ";
+constexpr char LIN_TO_PQ_STR[]             = "LIN_TO_PQ";
+constexpr char PQ_TO_LIN_STR[]             = "PQ_TO_LIN";
+constexpr char LIN_TO_HLG_STR[]            = "LIN_TO_HLG";
+constexpr char HLG_TO_LIN_STR[]            = "HLG_TO_LIN";
 
 
 // NOTE: Converts the enumeration value to its string representation (i.e. CLF reader).
@@ -88,6 +92,14 @@ const char * FixedFunctionOpData::ConvertStyleToString(Style style, bool detaile
             return XYZ_TO_LUV_STR;
         case LUV_TO_XYZ:
             return LUV_TO_XYZ_STR;
+        case LIN_TO_PQ:
+            return LIN_TO_PQ_STR;
+        case PQ_TO_LIN:
+            return PQ_TO_LIN_STR;
+        case LIN_TO_HLG:
+            return LIN_TO_HLG_STR;
+        case HLG_TO_LIN:
+            return HLG_TO_LIN_STR;
     }
 
     std::stringstream ss("Unknown FixedFunction style: ");
@@ -182,6 +194,22 @@ FixedFunctionOpData::Style FixedFunctionOpData::GetStyle(const char * name)
         {
             return LUV_TO_XYZ;
         }
+        else if (0 == Platform::Strcasecmp(name, LIN_TO_PQ_STR))
+        {
+            return LIN_TO_PQ;
+        }
+        else if (0 == Platform::Strcasecmp(name, PQ_TO_LIN_STR))
+        {
+            return PQ_TO_LIN;
+        }
+        else if (0 == Platform::Strcasecmp(name, LIN_TO_HLG_STR))
+        {
+            return LIN_TO_HLG;
+        }
+        else if (0 == Platform::Strcasecmp(name, HLG_TO_LIN_STR))
+        {
+            return HLG_TO_LIN;
+        }
     }
 
     std::string st("Unknown FixedFunction style: ");
@@ -244,6 +272,16 @@ FixedFunctionOpData::Style FixedFunctionOpData::ConvertStyle(FixedFunctionStyle
         {
             return FixedFunctionOpData::XYZ_TO_LUV;
         }
+        case FIXED_FUNCTION_LIN_TO_PQ:
+        {
+            return isForward ? FixedFunctionOpData::LIN_TO_PQ :
+                               FixedFunctionOpData::PQ_TO_LIN;
+        }
+        case FIXED_FUNCTION_LIN_TO_HLG:
+        {
+            return isForward ? FixedFunctionOpData::LIN_TO_HLG :
+                               FixedFunctionOpData::HLG_TO_LIN;
+        }
     }
 
     std::stringstream ss("Unknown FixedFunction transform style: ");
@@ -296,6 +334,14 @@ FixedFunctionStyle FixedFunctionOpData::ConvertStyle(FixedFunctionOpData::Style
     case FixedFunctionOpData::XYZ_TO_LUV:
     case FixedFunctionOpData::LUV_TO_XYZ:
         return FIXED_FUNCTION_XYZ_TO_LUV;
+
+    case FixedFunctionOpData::LIN_TO_PQ:
+    case FixedFunctionOpData::PQ_TO_LIN:
+        return FIXED_FUNCTION_LIN_TO_PQ;
+
+    case FixedFunctionOpData::LIN_TO_HLG:
+    case FixedFunctionOpData::HLG_TO_LIN:
+        return FIXED_FUNCTION_LIN_TO_HLG;
     }
 
     std::stringstream ss("Unknown FixedFunction style: ");
@@ -379,6 +425,13 @@ void FixedFunctionOpData::validate() const
     }
 }
 
+bool FixedFunctionOpData::hasChannelCrosstalk() const
+{
+    // The transfer functions process each channel independently.
+    return !(m_style == LIN_TO_PQ || m_style == PQ_TO_LIN
+             || m_style == LIN_TO_HLG || m_style == HLG_TO_LIN);
+}
+
 bool FixedFunctionOpData::isInverse(ConstFixedFunctionOpDataRcPtr & r) const
 {
     const auto thisStyle = getStyle();
@@ -503,6 +556,28 @@ void FixedFunctionOpData::invert()
             setStyle(XYZ_TO_LUV);
             break;
         }
+
+        case LIN_TO_PQ:
+        {
+            setStyle(PQ_TO_LIN);
+            break;
+        }
+        case PQ_TO_LIN:
+        {
+            setStyle(LIN_TO_PQ);
+            break;
+        }
+
+        case LIN_TO_HLG:
+        {
+            setStyle(HLG_TO_LIN);
+            break;
+        }
+        case HLG_TO_LIN:
+        {
+            setStyle(LIN_TO_HLG);
+            break;
+        }
     }
 
     // Note that any existing metadata could become stale at this point but
@@ -532,6 +607,8 @@ TransformDirection FixedFunctionOpData::getDirection() const
     case FixedFunctionOpData::XYZ_TO_xyY:
     case FixedFunctionOpData::XYZ_TO_uvY:
     case FixedFunctionOpData::XYZ_TO_LUV:
+    case FixedFunctionOpData::LIN_TO_PQ:
+    case FixedFunctionOpData::LIN_TO_HLG:
         return TRANSFORM_DIR_FORWARD;
 
     case FixedFunctionOpData::ACES_RED_MOD_03_INV:
@@ -544,6 +621,8 @@ TransformDirection FixedFunctionOpData::getDirection() const
     case FixedFunctionOpData::xyY_TO_XYZ:
     case FixedFunctionOpData::uvY_TO_XYZ:
     case FixedFunctionOpData::LUV_TO_XYZ:
+    case FixedFunctionOpData::PQ_TO_LIN:
+    case FixedFunctionOpData::HLG_TO_LIN:
         return TRANSFORM_DIR_INVERSE;
     }
     return TRANSFORM_DIR_FORWARD;
@@ -45,7 +45,11 @@ public:
         XYZ_TO_uvY,               // CIE XYZ to 1976 u'v' chromaticity coordinates
         uvY_TO_XYZ,               // Inverse of above
         XYZ_TO_LUV,               // CIE XYZ to 1976 CIELUV colour space (D65 white)
-        LUV_TO_XYZ                // Inverse of above
+        LUV_TO_XYZ,               // Inverse of above
+        LIN_TO_PQ,                // SMPTE ST 2084 inverse EOTF (linear 1.0 is 100 nits)
+        PQ_TO_LIN,                // SMPTE ST 2084 EOTF
+        LIN_TO_HLG,               // Rec.2100 HLG OETF (linear 1.0 is the nominal peak)
+        HLG_TO_LIN                // Inverse of above
     };
 
     static const char * ConvertStyleToString(Style style, bool detailed);
@@ -70,7 +74,7 @@ public:
 
     bool isNoOp() const override { return false; }
     bool isIdentity() const override { return false; }
-    bool hasChannelCrosstalk() const override { return true; }
+    bool hasChannelCrosstalk() const override;
 
     bool isInverse(ConstFixedFunctionOpDataRcPtr & r) const;
     FixedFunctionOpDataRcPtr inverse() const;
@@ -346,6 +346,50 @@ void Add_LUV_TO_XYZ(GpuShaderText & ss)
     ss.newLine() << "outColor.g = Y;";
 }
 
+void Add_LIN_TO_PQ(GpuShaderText & ss)
+{
+    // Linear 1.0 is 100 nits and the curve is mirrored for the negative values.
+    ss.newLine() << ss.float3Decl("sign3") << " = 2. * step(" << ss.float3Const(0.0) << ", outColor.rgb) - 1.;";
+    ss.newLine() << ss.float3Decl("L") << " = abs(outColor.rgb) * 0.01;";
+    ss.newLine() << ss.float3Decl("y") << " = pow(L, " << ss.float3Const(0.1593017578125) << ");";
+    ss.newLine() << ss.float3Decl("ratpoly") << " = (0.8359375 + 18.8515625 * y) / (1. + 18.6875 * y);";
+    ss.newLine() << "outColor.rgb = sign3 * pow(ratpoly, " << ss.float3Const(78.84375) << ");";
+}
+
+void Add_PQ_TO_LIN(GpuShaderText & ss)
+{
+    ss.newLine() << ss.float3Decl("sign3") << " = 2. * step(" << ss.float3Const(0.0) << ", outColor.rgb) - 1.;";
+    ss.newLine() << ss.float3Decl("x") << " = pow(min(abs(outColor.rgb), 1.), "
+                 << ss.float3Const(1. / 78.84375) << ");";
+    ss.newLine() << ss.float3Decl("num") << " = max(x - 0.8359375, 0.);";
+    ss.newLine() << ss.float3Decl("den") << " = 18.8515625 - 18.6875 * x;";
+    ss.newLine() << "outColor.rgb = sign3 * 100. * pow(num / den, "
+                 << ss.float3Const(1. / 0.1593017578125) << ");";
+}
+
+void Add_LIN_TO_HLG(GpuShaderText & ss)
+{
+    // The curve is mirrored for the negative values. The log argument is clamped to avoid NaNs
+    // in the unused branch.
+    ss.newLine() << ss.float3Decl("sign3") << " = 2. * step(" << ss.float3Const(0.0) << ", outColor.rgb) - 1.;";
+    ss.newLine() << ss.float3Decl("E") << " = abs(outColor.rgb);";
+    ss.newLine() << ss.float3Decl("lo") << " = sqrt(3. * E);";
+    ss.newLine() << ss.float3Decl("hi") << " = 0.17883277 * log(max(12. * E - 0.28466892, 0.71533108))"
+                 << " + 0.55991073;";
+    ss.newLine() << "outColor.rgb = sign3 * "
+                 << ss.lerp("lo", "hi", ss.float3GreaterThan("E", ss.float3Const(1. / 12.))) << ";";
+}
+
+void Add_HLG_TO_LIN(GpuShaderText & ss)
+{
+    ss.newLine() << ss.float3Decl("sign3") << " = 2. * step(" << ss.float3Const(0.0) << ", outColor.rgb) - 1.;";
+    ss.newLine() << ss.float3Decl("Ep") << " = abs(outColor.rgb);";
+    ss.newLine() << ss.float3Decl("lo") << " = Ep * Ep / 3.;";
+    ss.newLine() << ss.float3Decl("hi") << " = (exp((Ep - 0.55991073) / 0.17883277) + 0.28466892) / 12.;";
+    ss.newLine() << "outColor.rgb = sign3 * "
+                 << ss.lerp("lo", "hi", ss.float3GreaterThan("Ep", ss.float3Const(0.5))) << ";";
+}
+
 void GetFixedFunctionGPUShaderProgram(GpuShaderCreatorRcPtr & shaderCreator,
                                       ConstFixedFunctionOpDataRcPtr & func)
 {
@@ -463,6 +507,26 @@ void GetFixedFunctionGPUShaderProgram(GpuShaderCreatorRcPtr & shaderCreator,
         case FixedFunctionOpData::LUV_TO_XYZ:
         {
             Add_LUV_TO_XYZ(ss);
+            break;
+        }
+        case FixedFunctionOpData::LIN_TO_PQ:
+        {
+            Add_LIN_TO_PQ(ss);
+            break;
+        }
+        case FixedFunctionOpData::PQ_TO_LIN:
+        {
+            Add_PQ_TO_LIN(ss);
+            break;
+        }
+        case FixedFunctionOpData::LIN_TO_HLG:
+        {
+            Add_LIN_TO_HLG(ss);
+            break;
+        }
+        case FixedFunctionOpData::HLG_TO_LIN:
+        {
+            Add_HLG_TO_LIN(ss);
         }
     }
 
@@ -48,7 +48,7 @@ public:
 
     std::string getCacheID() const override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -135,10 +135,10 @@ std::string GammaOp::getCacheID() const
     return cacheIDStream.str();
 }
 
-ConstOpCPURcPtr GammaOp::getCPUOp(bool fastLogExpPow) const
+ConstOpCPURcPtr GammaOp::getCPUOp(LogExpPowPrecision precision) const
 {
     ConstGammaOpDataRcPtr data = gammaData();
-    return GetGammaRenderer(data, fastLogExpPow);
+    return GetGammaRenderer(data, precision);
 }
 
 void GammaOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
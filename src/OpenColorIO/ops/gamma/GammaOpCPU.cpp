@@ -7,7 +7,10 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ops/gamma/GammaOpCPU.h"
+#include "ops/gamma/GammaOpCPU_AVX2.h"
+#include "ops/gamma/GammaOpCPU_AVX512.h"
 #include "ops/gamma/GammaOpUtils.h"
 
 #include "SSE.h"
@@ -41,6 +44,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class GammaBasicOpCPUSSE : public GammaBasicOpCPU
 {
 public:
@@ -64,6 +68,7 @@ public:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class GammaBasicMirrorOpCPUSSE : public GammaBasicMirrorOpCPU
 {
 public:
@@ -87,6 +92,7 @@ public:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class GammaBasicPassThruOpCPUSSE : public GammaBasicPassThruOpCPU
 {
 public:
@@ -123,6 +129,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class GammaMoncurveOpCPUFwdSSE : public GammaMoncurveOpCPUFwd
 {
 public:
@@ -148,6 +155,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class GammaMoncurveOpCPURevSSE : public GammaMoncurveOpCPURev
 {
 public:
@@ -172,6 +180,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class GammaMoncurveMirrorOpCPUFwdSSE : public GammaMoncurveMirrorOpCPUFwd
 {
 public:
@@ -196,6 +205,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class GammaMoncurveMirrorOpCPURevSSE : public GammaMoncurveMirrorOpCPURev
 {
 public:
@@ -208,10 +218,69 @@ public:
 };
 #endif
 
-ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
+#if defined(USE_AVX2) || defined(USE_AVX512)
+// Base class for the renderers of all the Gamma styles, using the AVX2 or AVX-512 kernels.
+class GammaOpCPUWide : public OpCPU
 {
+protected:
+    explicit GammaOpCPUWide(ConstGammaOpDataRcPtr & gamma);
+
+protected:
+    GammaOpData::Style m_style;
+    // Red, green, blue & alpha parameters.
+    RendererParams m_params[4];
+};
+#endif
+
+#ifdef USE_AVX2
+class GammaOpCPUAVX2 : public GammaOpCPUWide
+{
+public:
+    GammaOpCPUAVX2(ConstGammaOpDataRcPtr & gamma, LogExpPowPrecision precision)
+        : GammaOpCPUWide(gamma)
+        , m_precision(precision)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    LogExpPowPrecision m_precision;
+};
+#endif
+
+#ifdef USE_AVX512
+// Only implements the fast power function approximation.
+class GammaOpCPUAVX512 : public GammaOpCPUWide
+{
+public:
+    explicit GammaOpCPUAVX512(ConstGammaOpDataRcPtr & gamma)
+        : GammaOpCPUWide(gamma)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+#endif
+
+ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, LogExpPowPrecision precision)
+{
+    const bool useSIMD = precision != LOG_EXP_POW_STD;
 #ifndef USE_SSE
-    std::ignore = fastPower;
+    std::ignore = useSIMD;
+#endif
+
+#ifdef USE_AVX512
+    if (precision == LOG_EXP_POW_FAST && CPUInfo::Instance().hasAVX512())
+    {
+        return std::make_shared<GammaOpCPUAVX512>(gamma);
+    }
+#endif
+#ifdef USE_AVX2
+    if (useSIMD && CPUInfo::Instance().hasAVX2())
+    {
+        return std::make_shared<GammaOpCPUAVX2>(gamma, precision);
+    }
 #endif
 
     switch(gamma->getStyle())
@@ -219,7 +288,7 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::MONCURVE_FWD:
         {
 #ifdef USE_SSE
-            if (fastPower) return std::make_shared<GammaMoncurveOpCPUFwdSSE>(gamma);
+            if (useSIMD) return MakeSSERenderer<OpCPU, GammaMoncurveOpCPUFwdSSE>(precision, gamma);
             else
 #endif
                 return std::make_shared<GammaMoncurveOpCPUFwd>(gamma);
@@ -229,7 +298,7 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::MONCURVE_REV:
         {
 #ifdef USE_SSE
-            if (fastPower) return std::make_shared<GammaMoncurveOpCPURevSSE>(gamma);
+            if (useSIMD) return MakeSSERenderer<OpCPU, GammaMoncurveOpCPURevSSE>(precision, gamma);
             else
 #endif
                 return std::make_shared<GammaMoncurveOpCPURev>(gamma);
@@ -239,7 +308,8 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::MONCURVE_MIRROR_FWD:
         {
 #ifdef USE_SSE
-            if (fastPower) return std::make_shared<GammaMoncurveMirrorOpCPUFwdSSE>(gamma);
+            if (useSIMD)
+                return MakeSSERenderer<OpCPU, GammaMoncurveMirrorOpCPUFwdSSE>(precision, gamma);
             else
 #endif
                 return std::make_shared<GammaMoncurveMirrorOpCPUFwd>(gamma);
@@ -249,7 +319,8 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::MONCURVE_MIRROR_REV:
         {
 #ifdef USE_SSE
-            if (fastPower) return std::make_shared<GammaMoncurveMirrorOpCPURevSSE>(gamma);
+            if (useSIMD)
+                return MakeSSERenderer<OpCPU, GammaMoncurveMirrorOpCPURevSSE>(precision, gamma);
             else
 #endif
                 return std::make_shared<GammaMoncurveMirrorOpCPURev>(gamma);
@@ -260,7 +331,7 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::BASIC_REV:
         {
 #ifdef USE_SSE
-            if (fastPower) return std::make_shared<GammaBasicOpCPUSSE>(gamma);
+            if (useSIMD) return MakeSSERenderer<OpCPU, GammaBasicOpCPUSSE>(precision, gamma);
             else
 #endif
                 return std::make_shared<GammaBasicOpCPU>(gamma);
@@ -270,7 +341,7 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::BASIC_MIRROR_REV:
         {
 #ifdef USE_SSE
-            if (fastPower) return std::make_shared<GammaBasicMirrorOpCPUSSE>(gamma);
+            if (useSIMD) return MakeSSERenderer<OpCPU, GammaBasicMirrorOpCPUSSE>(precision, gamma);
             else
 #endif
                 return std::make_shared<GammaBasicMirrorOpCPU>(gamma);
@@ -280,7 +351,8 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
         case GammaOpData::BASIC_PASS_THRU_REV:
         {
 #ifdef USE_SSE
-            if (fastPower) return std::make_shared<GammaBasicPassThruOpCPUSSE>(gamma);
+            if (useSIMD)
+                return MakeSSERenderer<OpCPU, GammaBasicPassThruOpCPUSSE>(precision, gamma);
             else
 #endif
                 return std::make_shared<GammaBasicPassThruOpCPU>(gamma);
@@ -318,7 +390,8 @@ void GammaBasicOpCPU::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #ifdef USE_SSE
-void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GammaBasicOpCPUSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -329,7 +402,7 @@ void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels
     {
         __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
-        pixel = ssePower(pixel, gamma);
+        pixel = Math::Power(pixel, gamma);
 
         _mm_storeu_ps(out, pixel);
 
@@ -367,7 +440,8 @@ GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
 }
 
 #ifdef USE_SSE
-void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GammaBasicMirrorOpCPUSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -380,7 +454,7 @@ void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long num
         __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
         __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
 
-        pixel = ssePower(abs_pix, gamma);
+        pixel = Math::Power(abs_pix, gamma);
         pixel = _mm_or_ps(sign_pix, pixel);
 
         _mm_storeu_ps(out, pixel);
@@ -419,7 +493,9 @@ GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
 }
 
 #ifdef USE_SSE
-void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GammaBasicPassThruOpCPUSSE<Math>::apply(const void * inImg, void * outImg,
+                                             long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -432,7 +508,7 @@ void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long n
         __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
         __m128 data = pixel;
 
-        data = ssePower(data, gamma);
+        data = Math::Power(data, gamma);
 
         __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
 
@@ -481,7 +557,8 @@ void GammaMoncurveOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #ifdef USE_SSE
-void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GammaMoncurveOpCPUFwdSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -507,7 +584,7 @@ void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long num
 
         __m128 data = _mm_add_ps(_mm_mul_ps(pixel, scale), offset);
 
-        data = ssePower(data, gamma);
+        data = Math::Power(data, gamma);
 
         __m128 flag = _mm_cmpgt_ps( pixel, breakPnt);
 
@@ -570,7 +647,8 @@ void GammaMoncurveOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #ifdef USE_SSE
-void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GammaMoncurveOpCPURevSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -594,7 +672,7 @@ void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long num
     {
         __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
-        __m128 data = ssePower(pixel, gamma);
+        __m128 data = Math::Power(pixel, gamma);
 
         data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
 
@@ -659,7 +737,9 @@ void GammaMoncurveMirrorOpCPUFwd::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #ifdef USE_SSE
-void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GammaMoncurveMirrorOpCPUFwdSSE<Math>::apply(const void * inImg, void * outImg,
+                                                 long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -687,7 +767,7 @@ void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, lo
 
         __m128 data = _mm_add_ps(_mm_mul_ps(abs_pix, scale), offset);
 
-        data = ssePower(data, gamma);
+        data = Math::Power(data, gamma);
 
         __m128 flagbrk = _mm_cmpgt_ps(abs_pix, breakPnt);
 
@@ -755,7 +835,9 @@ void GammaMoncurveMirrorOpCPURev::update(ConstGammaOpDataRcPtr & gamma)
 }
 
 #ifdef USE_SSE
-void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GammaMoncurveMirrorOpCPURevSSE<Math>::apply(const void * inImg, void * outImg,
+                                                 long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
@@ -781,7 +863,7 @@ void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, lo
         __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
         __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
 
-        __m128 data = ssePower(abs_pix, gamma);
+        __m128 data = Math::Power(abs_pix, gamma);
 
         data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
 
@@ -837,4 +919,62 @@ void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long
     }
 }
 
-} // namespace OCIO_NAMESPACE
\ No newline at end of file
+#if defined(USE_AVX2) || defined(USE_AVX512)
+GammaOpCPUWide::GammaOpCPUWide(ConstGammaOpDataRcPtr & gamma)
+    :   OpCPU()
+    ,   m_style(gamma->getStyle())
+{
+    const GammaOpData::Params * params[4] = { &gamma->getRedParams(),  &gamma->getGreenParams(),
+                                              &gamma->getBlueParams(), &gamma->getAlphaParams() };
+
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        switch (m_style)
+        {
+            case GammaOpData::MONCURVE_FWD:
+            case GammaOpData::MONCURVE_MIRROR_FWD:
+            {
+                ComputeParamsFwd(*params[channel], m_params[channel]);
+                break;
+            }
+            case GammaOpData::MONCURVE_REV:
+            case GammaOpData::MONCURVE_MIRROR_REV:
+            {
+                ComputeParamsRev(*params[channel], m_params[channel]);
+                break;
+            }
+            case GammaOpData::BASIC_FWD:
+            case GammaOpData::BASIC_MIRROR_FWD:
+            case GammaOpData::BASIC_PASS_THRU_FWD:
+            {
+                m_params[channel].gamma = (float)(*params[channel])[0];
+                break;
+            }
+            case GammaOpData::BASIC_REV:
+            case GammaOpData::BASIC_MIRROR_REV:
+            case GammaOpData::BASIC_PASS_THRU_REV:
+            {
+                m_params[channel].gamma = (float)(1. / (*params[channel])[0]);
+                break;
+            }
+        }
+    }
+}
+#endif
+
+#ifdef USE_AVX2
+void GammaOpCPUAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyGamma_AVX2(m_style, m_params, (const float *)inImg, (float *)outImg, numPixels,
+                    m_precision);
+}
+#endif
+
+#ifdef USE_AVX512
+void GammaOpCPUAVX512::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyGamma_AVX512(m_style, m_params, (const float *)inImg, (float *)outImg, numPixels);
+}
+#endif
+
+} // namespace OCIO_NAMESPACE
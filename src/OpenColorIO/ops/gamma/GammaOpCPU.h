@@ -8,14 +8,16 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "MathUtils.h"
 #include "Op.h"
 #include "ops/gamma/GammaOpData.h"
 
 namespace OCIO_NAMESPACE
 {
 
-// Get the Gamma dedicated renderer.
-ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower);
+// Get the Gamma dedicated renderer. The std:: functions are used for LOG_EXP_POW_STD, otherwise
+// the SIMD approximations of the precision tier when available.
+ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, LogExpPowPrecision precision);
 
 } // namespace OCIO_NAMESPACE
 
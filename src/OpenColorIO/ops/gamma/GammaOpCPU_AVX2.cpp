@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/gamma/GammaOpCPU_AVX2.h"
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Note: Same math as the SSE renderers from GammaOpCPU.cpp, but processing two pixels at a time.
+
+namespace
+{
+
+template<typename Math>
+struct GammaKernel
+{
+    static void Apply(GammaOpData::Style style, const RendererParams (&params)[4],
+                      const float * in, float * out, long numPixels)
+    {
+        const __m256 gamma = _mm256_setr_ps(params[0].gamma, params[1].gamma,
+                                            params[2].gamma, params[3].gamma,
+                                            params[0].gamma, params[1].gamma,
+                                            params[2].gamma, params[3].gamma);
+
+        const __m256 scale = _mm256_setr_ps(params[0].scale, params[1].scale,
+                                            params[2].scale, params[3].scale,
+                                            params[0].scale, params[1].scale,
+                                            params[2].scale, params[3].scale);
+
+        const __m256 offset = _mm256_setr_ps(params[0].offset, params[1].offset,
+                                             params[2].offset, params[3].offset,
+                                             params[0].offset, params[1].offset,
+                                             params[2].offset, params[3].offset);
+
+        const __m256 breakPnt = _mm256_setr_ps(params[0].breakPnt, params[1].breakPnt,
+                                               params[2].breakPnt, params[3].breakPnt,
+                                               params[0].breakPnt, params[1].breakPnt,
+                                               params[2].breakPnt, params[3].breakPnt);
+
+        const __m256 slope = _mm256_setr_ps(params[0].slope, params[1].slope,
+                                            params[2].slope, params[3].slope,
+                                            params[0].slope, params[1].slope,
+                                            params[2].slope, params[3].slope);
+
+        const __m256 zero = _mm256_setzero_ps();
+
+        switch (style)
+        {
+            case GammaOpData::BASIC_FWD:
+            case GammaOpData::BASIC_REV:
+            {
+                avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+                {
+                    return Math::Power(pixel, gamma);
+                });
+                break;
+            }
+            case GammaOpData::BASIC_MIRROR_FWD:
+            case GammaOpData::BASIC_MIRROR_REV:
+            {
+                avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+                {
+                    return _mm256_or_ps(avx2Sign(pixel), Math::Power(avx2Abs(pixel), gamma));
+                });
+                break;
+            }
+            case GammaOpData::BASIC_PASS_THRU_FWD:
+            case GammaOpData::BASIC_PASS_THRU_REV:
+            {
+                avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+                {
+                    const __m256 flag = _mm256_cmp_ps(pixel, zero, _CMP_GT_OQ);
+                    return avx2Select(flag, Math::Power(pixel, gamma), pixel);
+                });
+                break;
+            }
+            case GammaOpData::MONCURVE_FWD:
+            {
+                avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+                {
+                    const __m256 data
+                        = Math::Power(_mm256_add_ps(_mm256_mul_ps(pixel, scale), offset), gamma);
+                    const __m256 flag = _mm256_cmp_ps(pixel, breakPnt, _CMP_GT_OQ);
+                    return avx2Select(flag, data, _mm256_mul_ps(pixel, slope));
+                });
+                break;
+            }
+            case GammaOpData::MONCURVE_REV:
+            {
+                avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+                {
+                    const __m256 data
+                        = _mm256_sub_ps(_mm256_mul_ps(Math::Power(pixel, gamma), scale), offset);
+                    const __m256 flag = _mm256_cmp_ps(pixel, breakPnt, _CMP_GT_OQ);
+                    return avx2Select(flag, data, _mm256_mul_ps(pixel, slope));
+                });
+                break;
+            }
+            case GammaOpData::MONCURVE_MIRROR_FWD:
+            {
+                avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+                {
+                    const __m256 absPixel = avx2Abs(pixel);
+                    const __m256 data
+                        = Math::Power(_mm256_add_ps(_mm256_mul_ps(absPixel, scale), offset), gamma);
+                    const __m256 flag = _mm256_cmp_ps(absPixel, breakPnt, _CMP_GT_OQ);
+                    return _mm256_or_ps(avx2Sign(pixel),
+                                        avx2Select(flag, data, _mm256_mul_ps(absPixel, slope)));
+                });
+                break;
+            }
+            case GammaOpData::MONCURVE_MIRROR_REV:
+            {
+                avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+                {
+                    const __m256 absPixel = avx2Abs(pixel);
+                    const __m256 data
+                        = _mm256_sub_ps(_mm256_mul_ps(Math::Power(absPixel, gamma), scale), offset);
+                    const __m256 flag = _mm256_cmp_ps(absPixel, breakPnt, _CMP_GT_OQ);
+                    return _mm256_or_ps(avx2Sign(pixel),
+                                        avx2Select(flag, data, _mm256_mul_ps(absPixel, slope)));
+                });
+                break;
+            }
+        }
+    }
+};
+
+} // anon
+
+void ApplyGamma_AVX2(GammaOpData::Style style, const RendererParams (&params)[4],
+                     const float * in, float * out, long numPixels,
+                     LogExpPowPrecision precision)
+{
+    avx2ApplyPrecision<GammaKernel>(precision, style, params, in, out, numPixels);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_GAMMAOP_CPU_AVX2_H
+#define INCLUDED_OCIO_GAMMAOP_CPU_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "MathUtils.h"
+#include "ops/gamma/GammaOpData.h"
+#include "ops/gamma/GammaOpUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the Gamma style to packed RGBA float pixels, where params holds the red, green, blue
+// and alpha parameters (the basic styles only use the gamma). It uses the same power function
+// approximation as the SSE renderers of the precision tier. Only call it if
+// CPUInfo::hasAVX2() is true.
+void ApplyGamma_AVX2(GammaOpData::Style style, const RendererParams (&params)[4],
+                     const float * in, float * out, long numPixels,
+                     LogExpPowPrecision precision);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/gamma/GammaOpCPU_AVX512.h"
+
+#ifdef USE_AVX512
+
+#include "AVX512.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Note: Same math as the SSE renderers from GammaOpCPU.cpp, but processing four pixels at a time.
+
+void ApplyGamma_AVX512(GammaOpData::Style style, const RendererParams (&params)[4],
+                       const float * in, float * out, long numPixels)
+{
+    const __m512 gamma = _mm512_setr4_ps(params[0].gamma, params[1].gamma,
+                                         params[2].gamma, params[3].gamma);
+
+    const __m512 scale = _mm512_setr4_ps(params[0].scale, params[1].scale,
+                                         params[2].scale, params[3].scale);
+
+    const __m512 offset = _mm512_setr4_ps(params[0].offset, params[1].offset,
+                                          params[2].offset, params[3].offset);
+
+    const __m512 breakPnt = _mm512_setr4_ps(params[0].breakPnt, params[1].breakPnt,
+                                            params[2].breakPnt, params[3].breakPnt);
+
+    const __m512 slope = _mm512_setr4_ps(params[0].slope, params[1].slope,
+                                         params[2].slope, params[3].slope);
+
+    const __m512 zero = _mm512_setzero_ps();
+
+    switch (style)
+    {
+        case GammaOpData::BASIC_FWD:
+        case GammaOpData::BASIC_REV:
+        {
+            avx512ApplyRGBA(in, out, numPixels, [&](__m512 pixel)
+            {
+                return avx512Power(pixel, gamma);
+            });
+            break;
+        }
+        case GammaOpData::BASIC_MIRROR_FWD:
+        case GammaOpData::BASIC_MIRROR_REV:
+        {
+            avx512ApplyRGBA(in, out, numPixels, [&](__m512 pixel)
+            {
+                return avx512Or(avx512Sign(pixel), avx512Power(avx512Abs(pixel), gamma));
+            });
+            break;
+        }
+        case GammaOpData::BASIC_PASS_THRU_FWD:
+        case GammaOpData::BASIC_PASS_THRU_REV:
+        {
+            avx512ApplyRGBA(in, out, numPixels, [&](__m512 pixel)
+            {
+                const __mmask16 flag = _mm512_cmp_ps_mask(pixel, zero, _CMP_GT_OQ);
+                return _mm512_mask_blend_ps(flag, pixel, avx512Power(pixel, gamma));
+            });
+            break;
+        }
+        case GammaOpData::MONCURVE_FWD:
+        {
+            avx512ApplyRGBA(in, out, numPixels, [&](__m512 pixel)
+            {
+                const __m512 data = avx512Power(_mm512_add_ps(_mm512_mul_ps(pixel, scale), offset), gamma);
+                const __mmask16 flag = _mm512_cmp_ps_mask(pixel, breakPnt, _CMP_GT_OQ);
+                return _mm512_mask_blend_ps(flag, _mm512_mul_ps(pixel, slope), data);
+            });
+            break;
+        }
+        case GammaOpData::MONCURVE_REV:
+        {
+            avx512ApplyRGBA(in, out, numPixels, [&](__m512 pixel)
+            {
+                const __m512 data = _mm512_sub_ps(_mm512_mul_ps(avx512Power(pixel, gamma), scale), offset);
+                const __mmask16 flag = _mm512_cmp_ps_mask(pixel, breakPnt, _CMP_GT_OQ);
+                return _mm512_mask_blend_ps(flag, _mm512_mul_ps(pixel, slope), data);
+            });
+            break;
+        }
+        case GammaOpData::MONCURVE_MIRROR_FWD:
+        {
+            avx512ApplyRGBA(in, out, numPixels, [&](__m512 pixel)
+            {
+                const __m512 absPixel = avx512Abs(pixel);
+                const __m512 data = avx512Power(_mm512_add_ps(_mm512_mul_ps(absPixel, scale), offset), gamma);
+                const __mmask16 flag = _mm512_cmp_ps_mask(absPixel, breakPnt, _CMP_GT_OQ);
+                return avx512Or(avx512Sign(pixel),
+                                _mm512_mask_blend_ps(flag, _mm512_mul_ps(absPixel, slope), data));
+            });
+            break;
+        }
+        case GammaOpData::MONCURVE_MIRROR_REV:
+        {
+            avx512ApplyRGBA(in, out, numPixels, [&](__m512 pixel)
+            {
+                const __m512 absPixel = avx512Abs(pixel);
+                const __m512 data = _mm512_sub_ps(_mm512_mul_ps(avx512Power(absPixel, gamma), scale), offset);
+                const __mmask16 flag = _mm512_cmp_ps_mask(absPixel, breakPnt, _CMP_GT_OQ);
+                return avx512Or(avx512Sign(pixel),
+                                _mm512_mask_blend_ps(flag, _mm512_mul_ps(absPixel, slope), data));
+            });
+            break;
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX512
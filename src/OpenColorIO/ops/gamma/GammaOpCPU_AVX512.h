@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H
+#define INCLUDED_OCIO_GAMMAOP_CPU_AVX512_H
+
+
+#ifdef USE_AVX512
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/gamma/GammaOpData.h"
+#include "ops/gamma/GammaOpUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the Gamma style to packed RGBA float pixels, where params holds the red, green, blue
+// and alpha parameters (the basic styles only use the gamma). It uses the same power function
+// approximation as the SSE renderers. Only call it if CPUInfo::hasAVX512() is true.
+void ApplyGamma_AVX512(GammaOpData::Style style, const RendererParams (&params)[4],
+                       const float * in, float * out, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX512
+
+#endif
@@ -50,7 +50,7 @@ public:
                                 DynamicPropertyGradingPrimaryImplRcPtr & prop) override;
     void removeDynamicProperties() override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -184,10 +184,10 @@ void GradingPrimaryOp::removeDynamicProperties()
     primaryData()->removeDynamicProperty();
 }
 
-ConstOpCPURcPtr GradingPrimaryOp::getCPUOp(bool /*fastLogExpPow*/) const
+ConstOpCPURcPtr GradingPrimaryOp::getCPUOp(LogExpPowPrecision precision) const
 {
     ConstGradingPrimaryOpDataRcPtr data = primaryData();
-    return GetGradingPrimaryCPURenderer(data);
+    return GetGradingPrimaryCPURenderer(data, precision);
 }
 
 void GradingPrimaryOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <tuple>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -85,6 +86,7 @@ void GradingPrimaryOpCPU::unifyDynamicProperty(DynamicPropertyType type,
     }
 }
 
+template<typename Math>
 class GradingPrimaryLogFwdOpCPU : public GradingPrimaryOpCPU
 {
 public:
@@ -93,7 +95,8 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
-class GradingPrimaryLogRevOpCPU : public GradingPrimaryLogFwdOpCPU
+template<typename Math>
+class GradingPrimaryLogRevOpCPU : public GradingPrimaryLogFwdOpCPU<Math>
 {
 public:
     explicit GradingPrimaryLogRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
@@ -101,6 +104,7 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
+template<typename Math>
 class GradingPrimaryLinFwdOpCPU : public GradingPrimaryOpCPU
 {
 public:
@@ -109,7 +113,8 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
-class GradingPrimaryLinRevOpCPU : public GradingPrimaryLinFwdOpCPU
+template<typename Math>
+class GradingPrimaryLinRevOpCPU : public GradingPrimaryLinFwdOpCPU<Math>
 {
 public:
     explicit GradingPrimaryLinRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
@@ -117,6 +122,7 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
+template<typename Math>
 class GradingPrimaryVidFwdOpCPU : public GradingPrimaryOpCPU
 {
 public:
@@ -125,7 +131,8 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
-class GradingPrimaryVidRevOpCPU : public GradingPrimaryVidFwdOpCPU
+template<typename Math>
+class GradingPrimaryVidRevOpCPU : public GradingPrimaryVidFwdOpCPU<Math>
 {
 public:
     explicit GradingPrimaryVidRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp);
@@ -141,15 +148,17 @@ inline void ApplyContrast(__m128 & pix, const __m128 contrast, const __m128 pivo
     pix = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(pix, pivot), contrast), pivot);
 }
 
+template<typename Math>
 inline void ApplyLinContrast(__m128 & pix, const __m128 contrast, const __m128 pivot)
 {
     pix = _mm_div_ps(pix, pivot);
     __m128 sign_pix = _mm_and_ps(pix, ESIGN_MASK);
     __m128 abs_pix  = _mm_and_ps(pix, EABS_MASK);
-    pix = _mm_mul_ps(ssePower(abs_pix, contrast), pivot);
+    pix = _mm_mul_ps(Math::Power(abs_pix, contrast), pivot);
     pix = _mm_xor_ps(pix, sign_pix);
 }
 
+template<typename Math>
 inline void ApplyGamma(__m128 & pix, const __m128 gamma, __m128 blackPivot, __m128 whitePivot)
 {
     pix = _mm_sub_ps(pix, blackPivot);
@@ -157,7 +166,7 @@ inline void ApplyGamma(__m128 & pix, const __m128 gamma, __m128 blackPivot, __m1
     __m128 abs_pix = _mm_and_ps(pix, EABS_MASK);
     __m128 range = _mm_sub_ps(whitePivot, blackPivot);
     pix = _mm_div_ps(abs_pix, range);
-    pix = ssePower(pix, gamma);
+    pix = Math::Power(pix, gamma);
     pix = _mm_add_ps(_mm_mul_ps(_mm_xor_ps(pix, sign_pix), range), blackPivot);
 }
 
@@ -267,12 +276,14 @@ inline void ApplyClamp(float * pix, float clampMin, float clampMax)
 
 static constexpr auto PixelSize = 4 * sizeof(float);
 
-GradingPrimaryLogFwdOpCPU::GradingPrimaryLogFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
+template<typename Math>
+GradingPrimaryLogFwdOpCPU<Math>::GradingPrimaryLogFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
     : GradingPrimaryOpCPU(gp)
 {
 }
 
-void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GradingPrimaryLogFwdOpCPU<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
     {
@@ -319,7 +330,7 @@ void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 pixel = _mm_add_ps(pixel, brightness);
                 ApplyContrast(pixel, contrast, pivot);
-                ApplyGamma(pixel, gamma, blackPivot, whitePivot);
+                ApplyGamma<Math>(pixel, gamma, blackPivot, whitePivot);
                 ApplySaturation(pixel, saturation);
                 ApplyClamp(pixel, blackClamp, whiteClamp);
 
@@ -361,7 +372,7 @@ void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 pixel = _mm_add_ps(pixel, brightness);
                 ApplyContrast(pixel, contrast, pivot);
-                ApplyGamma(pixel, gamma, blackPivot, whitePivot);
+                ApplyGamma<Math>(pixel, gamma, blackPivot, whitePivot);
                 ApplyClamp(pixel, blackClamp, whiteClamp);
 
                 _mm_storeu_ps(out, pixel);
@@ -446,14 +457,16 @@ void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 #endif  // USE_SSE
 }
 
-GradingPrimaryLogRevOpCPU::GradingPrimaryLogRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
-    : GradingPrimaryLogFwdOpCPU(gp)
+template<typename Math>
+GradingPrimaryLogRevOpCPU<Math>::GradingPrimaryLogRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
+    : GradingPrimaryLogFwdOpCPU<Math>(gp)
 {
 }
 
-void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GradingPrimaryLogRevOpCPU<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    if (this->m_gp->getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -465,8 +478,8 @@ void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = this->m_gp->getValue();
+    auto & comp = this->m_gp->getComputedValue();
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -500,7 +513,7 @@ void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 ApplyClamp(pixel, clampB, clampW);
                 ApplySaturation(pixel, satInv);
-                ApplyGamma(pixel, gammaInv, pivotBlack, pivotWhite);
+                ApplyGamma<Math>(pixel, gammaInv, pivotBlack, pivotWhite);
                 ApplyContrast(pixel, contrastInv, actualPivot);
                 pixel = _mm_add_ps(pixel, brightnessInv);
 
@@ -541,7 +554,7 @@ void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long nu
                 __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
                 ApplyClamp(pixel, clampB, clampW);
-                ApplyGamma(pixel, gammaInv, pivotBlack, pivotWhite);
+                ApplyGamma<Math>(pixel, gammaInv, pivotBlack, pivotWhite);
                 ApplyContrast(pixel, contrastInv, actualPivot);
                 pixel = _mm_add_ps(pixel, brightnessInv);
 
@@ -620,12 +633,14 @@ void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long nu
 #endif // USE_SSE
 }
 
-GradingPrimaryLinFwdOpCPU::GradingPrimaryLinFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
+template<typename Math>
+GradingPrimaryLinFwdOpCPU<Math>::GradingPrimaryLinFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
     : GradingPrimaryOpCPU(gp)
 {
 }
 
-void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GradingPrimaryLinFwdOpCPU<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
     {
@@ -670,7 +685,7 @@ void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 pixel = _mm_add_ps(pixel, offset);
                 pixel = _mm_mul_ps(pixel, exposure);
-                ApplyLinContrast(pixel, contrast, pivot);
+                ApplyLinContrast<Math>(pixel, contrast, pivot);
                 ApplySaturation(pixel, saturation);
                 ApplyClamp(pixel, clampB, clampW);
 
@@ -712,7 +727,7 @@ void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 pixel = _mm_add_ps(pixel, offset);
                 pixel = _mm_mul_ps(pixel, exposure);
-                ApplyLinContrast(pixel, contrast, pivot);
+                ApplyLinContrast<Math>(pixel, contrast, pivot);
                 ApplyClamp(pixel, clampB, clampW);
 
                 _mm_storeu_ps(out, pixel);
@@ -794,14 +809,16 @@ void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 #endif // USE_SSE
 }
 
-GradingPrimaryLinRevOpCPU::GradingPrimaryLinRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
-    : GradingPrimaryLinFwdOpCPU(gp)
+template<typename Math>
+GradingPrimaryLinRevOpCPU<Math>::GradingPrimaryLinRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
+    : GradingPrimaryLinFwdOpCPU<Math>(gp)
 {
 }
 
-void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GradingPrimaryLinRevOpCPU<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    if (this->m_gp->getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -813,8 +830,8 @@ void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = this->m_gp->getValue();
+    auto & comp = this->m_gp->getComputedValue();
 
     const bool isContrastIdentity = comp.isContrastIdentity();
 
@@ -844,7 +861,7 @@ void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 ApplyClamp(pixel, clampB, clampW);
                 ApplySaturation(pixel, satInv);
-                ApplyLinContrast(pixel, contrastInv, pivot);
+                ApplyLinContrast<Math>(pixel, contrastInv, pivot);
                 pixel = _mm_mul_ps(pixel, exposureInv);
                 pixel = _mm_add_ps(pixel, offsetInv);
 
@@ -885,7 +902,7 @@ void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long nu
                 __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
                 ApplyClamp(pixel, clampB, clampW);
-                ApplyLinContrast(pixel, contrastInv, pivot);
+                ApplyLinContrast<Math>(pixel, contrastInv, pivot);
                 pixel = _mm_mul_ps(pixel, exposureInv);
                 pixel = _mm_add_ps(pixel, offsetInv);
 
@@ -904,7 +921,7 @@ void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long nu
                 __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
                 ApplyClamp(pixel, clampB, clampW);
-                ApplyLinContrast(pixel, contrastInv, pivot);
+                ApplyLinContrast<Math>(pixel, contrastInv, pivot);
                 pixel = _mm_mul_ps(pixel, exposureInv);
                 pixel = _mm_add_ps(pixel, offsetInv);
 
@@ -962,12 +979,14 @@ void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long nu
 #endif // USE_SSE
 }
 
-GradingPrimaryVidFwdOpCPU::GradingPrimaryVidFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
+template<typename Math>
+GradingPrimaryVidFwdOpCPU<Math>::GradingPrimaryVidFwdOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
     : GradingPrimaryOpCPU(gp)
 {
 }
 
-void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GradingPrimaryVidFwdOpCPU<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gp->getLocalBypass())
     {
@@ -1014,7 +1033,7 @@ void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 pixel = _mm_add_ps(pixel, offset);
                 ApplyContrast(pixel, slope, pivotBlack);
-                ApplyGamma(pixel, gamma, pivotBlack, pivotWhite);
+                ApplyGamma<Math>(pixel, gamma, pivotBlack, pivotWhite);
                 ApplySaturation(pixel, saturation);
                 ApplyClamp(pixel, clampB, clampW);
 
@@ -1056,7 +1075,7 @@ void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 pixel = _mm_add_ps(pixel, offset);
                 ApplyContrast(pixel, slope, pivotBlack);
-                ApplyGamma(pixel, gamma, pivotBlack, pivotWhite);
+                ApplyGamma<Math>(pixel, gamma, pivotBlack, pivotWhite);
                 ApplyClamp(pixel, clampB, clampW);
 
                 _mm_storeu_ps(out, pixel);
@@ -1142,14 +1161,16 @@ void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 #endif // USE_SSE
 }
 
-GradingPrimaryVidRevOpCPU::GradingPrimaryVidRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
-    : GradingPrimaryVidFwdOpCPU(gp)
+template<typename Math>
+GradingPrimaryVidRevOpCPU<Math>::GradingPrimaryVidRevOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
+    : GradingPrimaryVidFwdOpCPU<Math>(gp)
 {
 }
 
-void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GradingPrimaryVidRevOpCPU<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    if (this->m_gp->getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -1161,8 +1182,8 @@ void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = this->m_gp->getValue();
+    auto & comp = this->m_gp->getComputedValue();
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -1194,7 +1215,7 @@ void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long nu
 
                 ApplyClamp(pixel, clampB, clampW);
                 ApplySaturation(pixel, satInv);
-                ApplyGamma(pixel, gammaInv, pivotBlack, pivotWhite);
+                ApplyGamma<Math>(pixel, gammaInv, pivotBlack, pivotWhite);
                 ApplyContrast(pixel, slopeInv, pivotBlack);
                 pixel = _mm_add_ps(pixel, offsetInv);
 
@@ -1235,7 +1256,7 @@ void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long nu
                 __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
                 ApplyClamp(pixel, clampB, clampW);
-                ApplyGamma(pixel, gammaInv, pivotBlack, pivotWhite);
+                ApplyGamma<Math>(pixel, gammaInv, pivotBlack, pivotWhite);
                 ApplyContrast(pixel, slopeInv, pivotBlack);
                 pixel = _mm_add_ps(pixel, offsetInv);
 
@@ -1311,24 +1332,38 @@ void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long nu
     }
 #endif  // USE_SSE
 }
+
+// Create the renderer R<Math> of the precision tier (Math is unused without SSE).
+template<template<typename> class R>
+ConstOpCPURcPtr MakeRenderer(LogExpPowPrecision precision, ConstGradingPrimaryOpDataRcPtr & prim)
+{
+#ifdef USE_SSE
+    return MakeSSERenderer<OpCPU, R>(precision, prim);
+#else
+    std::ignore = precision;
+    return std::make_shared<R<void>>(prim);
+#endif  // USE_SSE
+}
+
 } // Anonymous namespace
 
 ///////////////////////////////////////////////////////////////////////////////
 
-ConstOpCPURcPtr GetGradingPrimaryCPURenderer(ConstGradingPrimaryOpDataRcPtr & prim)
+ConstOpCPURcPtr GetGradingPrimaryCPURenderer(ConstGradingPrimaryOpDataRcPtr & prim,
+                                             LogExpPowPrecision precision)
 {
     if (prim->getDirection() == TRANSFORM_DIR_FORWARD)
     {
         switch (prim->getStyle())
         {
         case GRADING_LOG:
-            return std::make_shared<GradingPrimaryLogFwdOpCPU>(prim);
+            return MakeRenderer<GradingPrimaryLogFwdOpCPU>(precision, prim);
             break;
         case GRADING_LIN:
-            return std::make_shared<GradingPrimaryLinFwdOpCPU>(prim);
+            return MakeRenderer<GradingPrimaryLinFwdOpCPU>(precision, prim);
             break;
         case GRADING_VIDEO:
-            return std::make_shared<GradingPrimaryVidFwdOpCPU>(prim);
+            return MakeRenderer<GradingPrimaryVidFwdOpCPU>(precision, prim);
             break;
         }
     }
@@ -1337,13 +1372,13 @@ ConstOpCPURcPtr GetGradingPrimaryCPURenderer(ConstGradingPrimaryOpDataRcPtr & pr
         switch (prim->getStyle())
         {
         case GRADING_LOG:
-            return std::make_shared<GradingPrimaryLogRevOpCPU>(prim);
+            return MakeRenderer<GradingPrimaryLogRevOpCPU>(precision, prim);
             break;
         case GRADING_LIN:
-            return std::make_shared<GradingPrimaryLinRevOpCPU>(prim);
+            return MakeRenderer<GradingPrimaryLinRevOpCPU>(precision, prim);
             break;
         case GRADING_VIDEO:
-            return std::make_shared<GradingPrimaryVidRevOpCPU>(prim);
+            return MakeRenderer<GradingPrimaryVidRevOpCPU>(precision, prim);
             break;
         }
     }
@@ -8,13 +8,17 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "MathUtils.h"
 #include "Op.h"
 #include "ops/gradingprimary/GradingPrimaryOpData.h"
 
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetGradingPrimaryCPURenderer(ConstGradingPrimaryOpDataRcPtr & prim);
+// The renderers always use the SIMD power function approximations when available, the accurate
+// ones for LOG_EXP_POW_STD.
+ConstOpCPURcPtr GetGradingPrimaryCPURenderer(ConstGradingPrimaryOpDataRcPtr & prim,
+                                             LogExpPowPrecision precision);
 
 } // namespace OCIO_NAMESPACE
 
@@ -441,6 +441,48 @@ float GradingBSplineCurveImpl::KnotsCoefs::evalCurve(int c, float x) const
     }
 }
 
+void GradingBSplineCurveImpl::SampledCurves::sample(const KnotsCoefs & knotsCoefs)
+{
+    for (size_t c = 0; c < m_curves.size(); ++c)
+    {
+        Curve & curve = m_curves[c];
+        const int curveIdx = static_cast<int>(c);
+
+        const int coefsSets = knotsCoefs.m_coefsOffsetsArray[2 * c + 1] / 3;
+        if (coefsSets == 0)
+        {
+            curve.m_samples.clear();
+            continue;
+        }
+
+        const int coefsOffs = knotsCoefs.m_coefsOffsetsArray[2 * c];
+        const int knotsCnt  = knotsCoefs.m_knotsOffsetsArray[2 * c + 1];
+        const int knotsOffs = knotsCoefs.m_knotsOffsetsArray[2 * c];
+
+        curve.m_start = knotsCoefs.m_knotsArray[knotsOffs];
+        curve.m_end   = knotsCoefs.m_knotsArray[knotsOffs + knotsCnt - 1];
+
+        // Same slopes as the extrapolation of KnotsCoefs::evalCurve.
+        const float * coefs = &knotsCoefs.m_coefsArray[coefsOffs];
+        const float A  = coefs[coefsSets - 1];
+        const float B  = coefs[coefsSets * 2 - 1];
+        const float kn = knotsCoefs.m_knotsArray[knotsOffs + knotsCnt - 2];
+        curve.m_startSlope = coefs[coefsSets];
+        curve.m_endSlope   = 2.f * A * (curve.m_end - kn) + B;
+
+        const double range = (double)curve.m_end - (double)curve.m_start;
+        curve.m_scale = range > 0. ? (float)((NUM_SAMPLES - 1) / range) : 0.f;
+
+        curve.m_samples.resize(NUM_SAMPLES);
+        for (int i = 0; i < NUM_SAMPLES - 1; ++i)
+        {
+            const double x = curve.m_start + range * i / (NUM_SAMPLES - 1);
+            curve.m_samples[i] = knotsCoefs.evalCurve(curveIdx, (float)x);
+        }
+        curve.m_samples[NUM_SAMPLES - 1] = knotsCoefs.evalCurve(curveIdx, curve.m_end);
+    }
+}
+
 bool operator==(const GradingControlPoint & lhs, const GradingControlPoint & rhs)
 {
     return lhs.m_x == rhs.m_x && lhs.m_y == rhs.m_y;
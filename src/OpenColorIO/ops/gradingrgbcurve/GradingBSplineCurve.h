@@ -5,6 +5,7 @@
 #ifndef INCLUDED_OCIO_GRADINGBSPLINECURVE_H
 #define INCLUDED_OCIO_GRADINGBSPLINECURVE_H
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
@@ -104,6 +105,68 @@ public:
         float evalCurve(int curveIdx, float x) const;
     };
 
+    // Holds the curves of a KnotsCoefs densely sampled over their knots range. The CPU
+    // renderers use it to avoid the knot search of KnotsCoefs::evalCurve for each pixel, so the
+    // owner must re-sample whenever the knots and coefs change (see
+    // DynamicPropertyGradingRGBCurveImpl).
+    //
+    // Between the first and last knots the curve is linearly interpolated from the samples and
+    // outside of that range it uses the same linear extrapolation as KnotsCoefs::evalCurve.
+    struct SampledCurves
+    {
+        SampledCurves() = delete;
+
+        explicit SampledCurves(size_t numCurves)
+        {
+            m_curves.resize(numCurves);
+        }
+
+        // Number of samples per curve. It keeps the interpolation error well below the float
+        // precision of the curve outputs for typical grading curves.
+        static constexpr int NUM_SAMPLES = 4096;
+
+        struct Curve
+        {
+            // Empty when the curve is identity.
+            std::vector<float> m_samples;
+            float m_start{ 0.f };
+            float m_end{ 0.f };
+            // Converts an input value into a sample position i.e. (NUM_SAMPLES - 1) / range.
+            float m_scale{ 0.f };
+            float m_startSlope{ 1.f };
+            float m_endSlope{ 1.f };
+        };
+
+        std::vector<Curve> m_curves;
+
+        // Sample all the curves of knotsCoefs (that must have the same number of curves).
+        void sample(const KnotsCoefs & knotsCoefs);
+
+        inline float evalCurve(int curveIdx, float x) const
+        {
+            const Curve & curve = m_curves[curveIdx];
+            if (curve.m_samples.empty())
+            {
+                return x;
+            }
+
+            if (x <= curve.m_start)
+            {
+                return (x - curve.m_start) * curve.m_startSlope + curve.m_samples.front();
+            }
+            else if (x < curve.m_end)
+            {
+                const float t = (x - curve.m_start) * curve.m_scale;
+                const int i = std::min(static_cast<int>(t), NUM_SAMPLES - 2);
+                const float lo = curve.m_samples[i];
+                return lo + (t - static_cast<float>(i)) * (curve.m_samples[i + 1] - lo);
+            }
+
+            // Also propagates NaNs.
+            return (x - curve.m_end) * curve.m_endSlope + curve.m_samples.back();
+        }
+    };
+
     // Compute knots and coefs for a curve and add result to knotsCoefs. It has to be called for
     // each curve using a given curve order.
     void computeKnotsAndCoefs(KnotsCoefs & knotsCoefs, int curveIdx) const;
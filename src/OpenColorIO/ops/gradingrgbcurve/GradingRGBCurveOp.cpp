@@ -50,7 +50,7 @@ public:
                                 DynamicPropertyGradingRGBCurveImplRcPtr & prop) override;
     void removeDynamicProperties() override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -184,10 +184,10 @@ void GradingRGBCurveOp::removeDynamicProperties()
     rgbCurveData()->removeDynamicProperty();
 }
 
-ConstOpCPURcPtr GradingRGBCurveOp::getCPUOp(bool /*fastLogExpPow*/) const
+ConstOpCPURcPtr GradingRGBCurveOp::getCPUOp(LogExpPowPrecision precision) const
 {
     ConstGradingRGBCurveOpDataRcPtr data = rgbCurveData();
-    return GetGradingRGBCurveCPURenderer(data);
+    return GetGradingRGBCurveCPURenderer(data, precision);
 }
 
 void GradingRGBCurveOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
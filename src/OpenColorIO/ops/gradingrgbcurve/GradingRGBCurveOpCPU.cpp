@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <tuple>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -31,16 +32,18 @@ public:
                               DynamicPropertyGradingRGBCurveImplRcPtr & prop) const override;
 
 protected:
-    void eval(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+    // Use the pre-sampled curves of the dynamic property (re-sampled each time the curves
+    // change) rather than searching the knots for each pixel.
+    void eval(const GradingBSplineCurveImpl::SampledCurves & curves,
               float * out, const float * in) const
     {
-        out[0] = knotsCoefs.evalCurve(static_cast<int>(RGB_RED), in[0]);
-        out[1] = knotsCoefs.evalCurve(static_cast<int>(RGB_GREEN), in[1]);
-        out[2] = knotsCoefs.evalCurve(static_cast<int>(RGB_BLUE), in[2]);
+        out[0] = curves.evalCurve(static_cast<int>(RGB_RED), in[0]);
+        out[1] = curves.evalCurve(static_cast<int>(RGB_GREEN), in[1]);
+        out[2] = curves.evalCurve(static_cast<int>(RGB_BLUE), in[2]);
         // TODO: Add vectorized version for master curve.
-        out[0] = knotsCoefs.evalCurve(static_cast<int>(RGB_MASTER), in[0]);
-        out[1] = knotsCoefs.evalCurve(static_cast<int>(RGB_MASTER), in[1]);
-        out[2] = knotsCoefs.evalCurve(static_cast<int>(RGB_MASTER), in[2]);
+        out[0] = curves.evalCurve(static_cast<int>(RGB_MASTER), out[0]);
+        out[1] = curves.evalCurve(static_cast<int>(RGB_MASTER), out[1]);
+        out[2] = curves.evalCurve(static_cast<int>(RGB_MASTER), out[2]);
     }
 
     // Mutable for the unification process.
@@ -127,12 +130,14 @@ void GradingRGBCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numP
         return;
     }
 
+    const GradingBSplineCurveImpl::SampledCurves & curves = m_grgbcurve->getSampledCurves();
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
-        eval(m_grgbcurve->getKnotsCoefs(), out, in);
+        eval(curves, out, in);
 
         out[3] = in[3];
 
@@ -141,6 +146,7 @@ void GradingRGBCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+template<typename Math>
 class GradingRGBCurveLinearFwdOpCPU : public GradingRGBCurveOpCPU
 {
 public:
@@ -151,13 +157,18 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
-GradingRGBCurveLinearFwdOpCPU::GradingRGBCurveLinearFwdOpCPU(ConstGradingRGBCurveOpDataRcPtr & grgbc)
+template<typename Math>
+GradingRGBCurveLinearFwdOpCPU<Math>::GradingRGBCurveLinearFwdOpCPU(
+    ConstGradingRGBCurveOpDataRcPtr & grgbc)
     : GradingRGBCurveOpCPU(grgbc)
 {
 
 }
 
-void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GradingRGBCurveLinearFwdOpCPU<Math>::apply(const void * inImg,
+                                                void * outImg,
+                                                long numPixels) const
 {
     if (m_grgbcurve->getLocalBypass())
     {
@@ -187,6 +198,8 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
 #else
     static constexpr float base2 = 1.4426950408889634f; // 1/log(2)
 #endif
+    const GradingBSplineCurveImpl::SampledCurves & curves = m_grgbcurve->getSampledCurves();
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -202,7 +215,7 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
 
         pix = _mm_add_ps(pix, mshift);
         pix = _mm_mul_ps(pix, mm);
-        pix = sseLog2(pix);
+        pix = Math::Log2(pix);
 
         pix = _mm_or_ps(_mm_and_ps(flag, pix),
                         _mm_andnot_ps(flag, pixLin));
@@ -221,7 +234,7 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
 #endif
 
         // Curves.
-        eval(m_grgbcurve->getKnotsCoefs(), out, in);
+        eval(curves, out, out);
 
         // Log to lin.
 #ifdef USE_SSE
@@ -231,7 +244,7 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
         pixLin = _mm_sub_ps(pix2, moffs);
         pixLin = _mm_mul_ps(pixLin, mgainInv);
 
-        pix2 = ssePower(mpower, pix2);
+        pix2 = Math::Power(mpower, pix2);
         pix2 = _mm_mul_ps(pix2, mshift018);
         pix2 = _mm_sub_ps(pix2, mshift);
 
@@ -306,7 +319,8 @@ void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, lon
 
 ///////////////////////////////////////////////////////////////////////////////
 
-ConstOpCPURcPtr GetGradingRGBCurveCPURenderer(ConstGradingRGBCurveOpDataRcPtr & prim)
+ConstOpCPURcPtr GetGradingRGBCurveCPURenderer(ConstGradingRGBCurveOpDataRcPtr & prim,
+                                              LogExpPowPrecision precision)
 {
     const bool linToLog = (prim->getStyle() == GRADING_LIN) && !prim->getBypassLinToLog();
 
@@ -314,7 +328,13 @@ ConstOpCPURcPtr GetGradingRGBCurveCPURenderer(ConstGradingRGBCurveOpDataRcPtr &
     {
         if (linToLog)
         {
-            return std::make_shared<GradingRGBCurveLinearFwdOpCPU>(prim);
+#ifdef USE_SSE
+            return MakeSSERenderer<OpCPU, GradingRGBCurveLinearFwdOpCPU>(precision, prim);
+#else
+            // Math is unused without SSE.
+            std::ignore = precision;
+            return std::make_shared<GradingRGBCurveLinearFwdOpCPU<void>>(prim);
+#endif  // USE_SSE
         }
         else
         {
@@ -8,13 +8,17 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "MathUtils.h"
 #include "Op.h"
 #include "ops/gradingrgbcurve/GradingRGBCurveOpData.h"
 
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetGradingRGBCurveCPURenderer(ConstGradingRGBCurveOpDataRcPtr & rgbCurve);
+// The linear renderer always uses the SIMD log & power function approximations when available,
+// the accurate ones for LOG_EXP_POW_STD.
+ConstOpCPURcPtr GetGradingRGBCurveCPURenderer(ConstGradingRGBCurveOpDataRcPtr & rgbCurve,
+                                              LogExpPowPrecision precision);
 
 } // namespace OCIO_NAMESPACE
 
@@ -50,7 +50,7 @@ public:
                                 DynamicPropertyGradingToneImplRcPtr & prop) override;
     void removeDynamicProperties() override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -178,10 +178,10 @@ void GradingToneOp::removeDynamicProperties()
     toneData()->removeDynamicProperty();
 }
 
-ConstOpCPURcPtr GradingToneOp::getCPUOp(bool /*fastLogExpPow*/) const
+ConstOpCPURcPtr GradingToneOp::getCPUOp(LogExpPowPrecision precision) const
 {
     ConstGradingToneOpDataRcPtr data = toneData();
-    return GetGradingToneCPURenderer(data);
+    return GetGradingToneCPURenderer(data, precision);
 }
 
 void GradingToneOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
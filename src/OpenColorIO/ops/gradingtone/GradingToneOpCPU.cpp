@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <tuple>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -101,6 +102,7 @@ protected:
     void scontrast(const GradingTone & v, const GradingTonePreRender & vpr, float * out) const;
 };
 
+template<typename Math>
 class GradingToneLinearFwdOpCPU : public GradingToneFwdOpCPU
 {
 public:
@@ -623,12 +625,14 @@ void GradingToneFwdOpCPU::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
-GradingToneLinearFwdOpCPU::GradingToneLinearFwdOpCPU(ConstGradingToneOpDataRcPtr & gt)
+template<typename Math>
+GradingToneLinearFwdOpCPU<Math>::GradingToneLinearFwdOpCPU(ConstGradingToneOpDataRcPtr & gt)
     : GradingToneFwdOpCPU(gt)
 {
 }
 
-void GradingToneLinearFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void GradingToneLinearFwdOpCPU<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     if (m_gt->getLocalBypass())
     {
@@ -678,7 +682,7 @@ void GradingToneLinearFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 
         pix = _mm_add_ps(pix, mshift);
         pix = _mm_mul_ps(pix, mm);
-        pix = sseLog2(pix);
+        pix = Math::Log2(pix);
 
         pix = _mm_or_ps(_mm_and_ps(flag, pix),
             _mm_andnot_ps(flag, pixLin));
@@ -732,7 +736,7 @@ void GradingToneLinearFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         pixLin = _mm_sub_ps(pix, moffs);
         pixLin = _mm_mul_ps(pixLin, mgainInv);
 
-        pix = ssePower(mpower, pix);
+        pix = Math::Power(mpower, pix);
         pix = _mm_mul_ps(pix, mshift018);
         pix = _mm_sub_ps(pix, mshift);
 
@@ -787,13 +791,20 @@ void GradingToneLinearRevOpCPU::apply(const void * inImg, void * outImg, long nu
 
 ///////////////////////////////////////////////////////////////////////////////
 
-ConstOpCPURcPtr GetGradingToneCPURenderer(ConstGradingToneOpDataRcPtr & tone)
+ConstOpCPURcPtr GetGradingToneCPURenderer(ConstGradingToneOpDataRcPtr & tone,
+                                          LogExpPowPrecision precision)
 {
     if (tone->getDirection() == TRANSFORM_DIR_FORWARD)
     {
         if (tone->getStyle() == GRADING_LIN)
         {
-            return std::make_shared<GradingToneLinearFwdOpCPU>(tone);
+#ifdef USE_SSE
+            return MakeSSERenderer<OpCPU, GradingToneLinearFwdOpCPU>(precision, tone);
+#else
+            // Math is unused without SSE.
+            std::ignore = precision;
+            return std::make_shared<GradingToneLinearFwdOpCPU<void>>(tone);
+#endif  // USE_SSE
         }
         return std::make_shared<GradingToneFwdOpCPU>(tone);
     }
@@ -8,13 +8,17 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "MathUtils.h"
 #include "Op.h"
 #include "ops/gradingtone/GradingToneOpData.h"
 
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetGradingToneCPURenderer(ConstGradingToneOpDataRcPtr & prim);
+// The linear renderer always uses the SIMD log & power function approximations when available,
+// the accurate ones for LOG_EXP_POW_STD.
+ConstOpCPURcPtr GetGradingToneCPURenderer(ConstGradingToneOpDataRcPtr & prim,
+                                          LogExpPowPrecision precision);
 
 } // namespace OCIO_NAMESPACE
 
@@ -42,7 +42,7 @@ public:
     bool isInverse(ConstOpRcPtr & op) const override;
     std::string getCacheID() const override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -104,10 +104,10 @@ std::string LogOp::getCacheID() const
     return cacheIDStream.str();
 }
 
-ConstOpCPURcPtr LogOp::getCPUOp(bool fastLogExpPow) const
+ConstOpCPURcPtr LogOp::getCPUOp(LogExpPowPrecision precision) const
 {
     ConstLogOpDataRcPtr data = logData();
-    return GetLogRenderer(data, fastLogExpPow);
+    return GetLogRenderer(data, precision);
 }
 
 void LogOp::extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const
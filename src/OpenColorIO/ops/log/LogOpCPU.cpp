@@ -11,8 +11,10 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/log/LogOpCPU.h"
+#include "ops/log/LogOpCPU_AVX2.h"
 #include "ops/log/LogUtils.h"
 #include "ops/OpTools.h"
 #include "Platform.h"
@@ -67,6 +69,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class Log2LinRendererSSE : public Log2LinRenderer
 {
 public:
@@ -76,6 +79,19 @@ public:
 };
 #endif
 
+#ifdef USE_AVX2
+class Log2LinRendererAVX2 : public Log2LinRenderer
+{
+public:
+    Log2LinRendererAVX2(ConstLogOpDataRcPtr & log, LogExpPowPrecision precision);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    LogExpPowPrecision m_precision;
+};
+#endif
+
 // Renderer for Lin2Log operations.
 class Lin2LogRenderer : public L2LBaseRenderer
 {
@@ -94,6 +110,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class Lin2LogRendererSSE : public Lin2LogRenderer
 {
 public:
@@ -103,6 +120,19 @@ public:
 };
 #endif
 
+#ifdef USE_AVX2
+class Lin2LogRendererAVX2 : public Lin2LogRenderer
+{
+public:
+    Lin2LogRendererAVX2(ConstLogOpDataRcPtr & log, LogExpPowPrecision precision);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    LogExpPowPrecision m_precision;
+};
+#endif
+
 class CameraL2LBaseRenderer : public L2LBaseRenderer
 {
 public:
@@ -137,6 +167,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class CameraLog2LinRendererSSE : public CameraLog2LinRenderer
 {
 public:
@@ -146,6 +177,19 @@ public:
 };
 #endif
 
+#ifdef USE_AVX2
+class CameraLog2LinRendererAVX2 : public CameraLog2LinRenderer
+{
+public:
+    CameraLog2LinRendererAVX2(ConstLogOpDataRcPtr & log, LogExpPowPrecision precision);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    LogExpPowPrecision m_precision;
+};
+#endif
+
 // Renderer for CameraLin2Log operations.
 class CameraLin2LogRenderer : public CameraL2LBaseRenderer
 {
@@ -165,6 +209,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class CameraLin2LogRendererSSE : public CameraLin2LogRenderer
 {
 public:
@@ -174,6 +219,19 @@ public:
 };
 #endif
 
+#ifdef USE_AVX2
+class CameraLin2LogRendererAVX2 : public CameraLin2LogRenderer
+{
+public:
+    CameraLin2LogRendererAVX2(ConstLogOpDataRcPtr & log, LogExpPowPrecision precision);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    LogExpPowPrecision m_precision;
+};
+#endif
+
 // Renderer for Log10 and Log2 operations.
 class LogRenderer : public LogOpCPU
 {
@@ -187,6 +245,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class LogRendererSSE : public LogRenderer
 {
 public:
@@ -196,6 +255,19 @@ public:
 };
 #endif
 
+#ifdef USE_AVX2
+class LogRendererAVX2 : public LogRenderer
+{
+public:
+    LogRendererAVX2(ConstLogOpDataRcPtr & log, float logScale, LogExpPowPrecision precision);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    LogExpPowPrecision m_precision;
+};
+#endif
+
 // Renderer for AntiLog10 and AntiLog2 operations.
 class AntiLogRenderer : public LogOpCPU
 {
@@ -209,6 +281,7 @@ protected:
 };
 
 #ifdef USE_SSE
+template<typename Math>
 class AntiLogRendererSSE : public AntiLogRenderer
 {
 public:
@@ -218,13 +291,30 @@ public:
 };
 #endif
 
+#ifdef USE_AVX2
+class AntiLogRendererAVX2 : public AntiLogRenderer
+{
+public:
+    AntiLogRendererAVX2(ConstLogOpDataRcPtr & log, float log2base, LogExpPowPrecision precision);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    LogExpPowPrecision m_precision;
+};
+#endif
+
 static constexpr float LOG2_10 = ((float) 3.3219280948873623478703194294894);
 static constexpr float LOG10_2 = ((float) 0.3010299956639811952137388947245);
 
-ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp)
+ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, LogExpPowPrecision precision)
 {
+    const bool useSIMD = precision != LOG_EXP_POW_STD;
 #ifndef USE_SSE
-    std::ignore = fastExp;
+    std::ignore = useSIMD;
+#endif
+#ifdef USE_AVX2
+    const bool useAVX2 = useSIMD && CPUInfo::Instance().hasAVX2();
 #endif
 
     const TransformDirection dir = log->getDirection();
@@ -232,16 +322,22 @@ ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp)
     {
         if (dir == TRANSFORM_DIR_FORWARD)
         {
+#ifdef USE_AVX2
+            if (useAVX2) return std::make_shared<LogRendererAVX2>(log, 1.0f, precision);
+#endif
 #ifdef USE_SSE
-            if (fastExp) return std::make_shared<LogRendererSSE>(log, 1.0f);
+            if (useSIMD) return MakeSSERenderer<OpCPU, LogRendererSSE>(precision, log, 1.0f);
             else
 #endif
                 return std::make_shared<LogRenderer>(log, 1.0f);
         }
         else
         {
+#ifdef USE_AVX2
+            if (useAVX2) return std::make_shared<AntiLogRendererAVX2>(log, 1.0f, precision);
+#endif
 #ifdef USE_SSE
-            if (fastExp) return std::make_shared<AntiLogRendererSSE>(log, 1.0f);
+            if (useSIMD) return MakeSSERenderer<OpCPU, AntiLogRendererSSE>(precision, log, 1.0f);
             else
 #endif
                 return std::make_shared<AntiLogRenderer>(log, 1.0f);
@@ -251,16 +347,22 @@ ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp)
     {
         if (dir == TRANSFORM_DIR_FORWARD)
         {
+#ifdef USE_AVX2
+            if (useAVX2) return std::make_shared<LogRendererAVX2>(log, LOG10_2, precision);
+#endif
 #ifdef USE_SSE
-            if (fastExp) return std::make_shared<LogRendererSSE>(log, LOG10_2);
+            if (useSIMD) return MakeSSERenderer<OpCPU, LogRendererSSE>(precision, log, LOG10_2);
             else
 #endif
                 return std::make_shared<LogRenderer>(log, LOG10_2);
         }
         else
         {
+#ifdef USE_AVX2
+            if (useAVX2) return std::make_shared<AntiLogRendererAVX2>(log, LOG2_10, precision);
+#endif
 #ifdef USE_SSE
-            if (fastExp) return std::make_shared<AntiLogRendererSSE>(log, LOG2_10);
+            if (useSIMD) return MakeSSERenderer<OpCPU, AntiLogRendererSSE>(precision, log, LOG2_10);
             else
 #endif
                 return std::make_shared<AntiLogRenderer>(log, LOG2_10);
@@ -272,16 +374,24 @@ ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp)
         {
             if (dir == TRANSFORM_DIR_FORWARD)
             {
+#ifdef USE_AVX2
+                if (useAVX2) return std::make_shared<CameraLin2LogRendererAVX2>(log, precision);
+#endif
 #ifdef USE_SSE
-                if (fastExp) return std::make_shared<CameraLin2LogRendererSSE>(log);
+                if (useSIMD)
+                    return MakeSSERenderer<OpCPU, CameraLin2LogRendererSSE>(precision, log);
                 else
 #endif
                     return std::make_shared<CameraLin2LogRenderer>(log);
             }
             else
             {
+#ifdef USE_AVX2
+                if (useAVX2) return std::make_shared<CameraLog2LinRendererAVX2>(log, precision);
+#endif
 #ifdef USE_SSE
-                if (fastExp) return std::make_shared<CameraLog2LinRendererSSE>(log);
+                if (useSIMD)
+                    return MakeSSERenderer<OpCPU, CameraLog2LinRendererSSE>(precision, log);
                 else
 #endif
                     return std::make_shared<CameraLog2LinRenderer>(log);
@@ -291,16 +401,22 @@ ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp)
         {
             if (dir == TRANSFORM_DIR_FORWARD)
             {
+#ifdef USE_AVX2
+                if (useAVX2) return std::make_shared<Lin2LogRendererAVX2>(log, precision);
+#endif
 #ifdef USE_SSE
-                if (fastExp) return std::make_shared<Lin2LogRendererSSE>(log);
+                if (useSIMD) return MakeSSERenderer<OpCPU, Lin2LogRendererSSE>(precision, log);
                 else
 #endif
                     return std::make_shared<Lin2LogRenderer>(log);
             }
             else
             {
+#ifdef USE_AVX2
+                if (useAVX2) return std::make_shared<Log2LinRendererAVX2>(log, precision);
+#endif
 #ifdef USE_SSE
-                if (fastExp) return std::make_shared<Log2LinRendererSSE>(log);
+                if (useSIMD) return MakeSSERenderer<OpCPU, Log2LinRendererSSE>(precision, log);
                 else
 #endif
                     return std::make_shared<Log2LinRenderer>(log);
@@ -409,11 +525,13 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 }
 
 #ifdef USE_SSE
-LogRendererSSE::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
+template<typename Math>
+LogRendererSSE<Math>::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
     : LogRenderer(log, logScale)
 {
 }
-void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void LogRendererSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = log2( max(in, minValue) ) * logScale;
@@ -432,7 +550,7 @@ void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) co
     {
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
         mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
+        mm_pixel = Math::Log2(mm_pixel);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_logScale);
 
         const float alphares = in[3];
@@ -477,12 +595,14 @@ void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 }
 
 #ifdef USE_SSE
-AntiLogRendererSSE::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
+template<typename Math>
+AntiLogRendererSSE<Math>::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
     : AntiLogRenderer(log, log2base)
 {
 }
 
-void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void AntiLogRendererSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = pow(base, in);
@@ -502,7 +622,7 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
     for (long idx = 0; idx<numPixels; ++idx)
     {
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = sseExp2(_mm_mul_ps(mm_pixel, mm_log2_base));
+        mm_pixel = Math::Exp2(_mm_mul_ps(mm_pixel, mm_log2_base));
 
         const float alphares = in[3];
 
@@ -567,13 +687,15 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 }
 
 #ifdef USE_SSE
-Log2LinRendererSSE::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
+template<typename Math>
+Log2LinRendererSSE<Math>::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : Log2LinRenderer(log)
 {
 
 }
 
-void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void Log2LinRendererSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     //
     // out = ( pow( base, (in - logOffset) / logSlope ) - linOffset ) / linSlope;
@@ -600,7 +722,7 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
         mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
-        mm_pixel = sseExp2(mm_pixel);
+        mm_pixel = Math::Exp2(mm_pixel);
         mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
 
@@ -669,12 +791,14 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 }
 
 #ifdef USE_SSE
-Lin2LogRendererSSE::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
+template<typename Math>
+Lin2LogRendererSSE<Math>::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : Lin2LogRenderer(log)
 {
 }
 
-void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void Lin2LogRendererSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     // out = ( logSlope * log( base, max( minValue, (in*linSlope + linOffset) ) ) + logOffset )
     //
@@ -700,7 +824,7 @@ void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
         mm_pixel = _mm_add_ps(mm_pixel, mm_b);
         mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
+        mm_pixel = Math::Log2(mm_pixel);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
         mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
 
@@ -797,12 +921,14 @@ void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPix
 }
 
 #ifdef USE_SSE
-CameraLog2LinRendererSSE::CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log)
+template<typename Math>
+CameraLog2LinRendererSSE<Math>::CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLog2LinRenderer(log)
 {
 }
 
-void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void CameraLog2LinRendererSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     // if in <= logBreak
     //  out = ( in - linearOffset ) / linearSlope
@@ -836,7 +962,7 @@ void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long num
 
         mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
-        mm_pixel = sseExp2(mm_pixel);
+        mm_pixel = Math::Exp2(mm_pixel);
         mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
 
@@ -915,12 +1041,14 @@ void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPix
 }
 
 #ifdef USE_SSE
-CameraLin2LogRendererSSE::CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log)
+template<typename Math>
+CameraLin2LogRendererSSE<Math>::CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLin2LogRenderer(log)
 {
 }
 
-void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Math>
+void CameraLin2LogRendererSSE<Math>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     // if in <= linBreak
     //  out = linearSlope * in + linearOffset 
@@ -958,7 +1086,7 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
         mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
         mm_pixel = _mm_add_ps(mm_pixel, mm_b);
         mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
+        mm_pixel = Math::Log2(mm_pixel);
         mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
         mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
 
@@ -976,5 +1104,96 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
 }
 #endif
 
-} // namespace OCIO_NAMESPACE
+#ifdef USE_AVX2
+LogRendererAVX2::LogRendererAVX2(ConstLogOpDataRcPtr & log, float logScale,
+                                 LogExpPowPrecision precision)
+    : LogRenderer(log, logScale)
+    , m_precision(precision)
+{
+}
+
+void LogRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    // out = log2( max(in, minValue) ) * logScale;
+    static constexpr float one[3]  = { 1.0f, 1.0f, 1.0f };
+    static constexpr float zero[3] = { 0.0f, 0.0f, 0.0f };
+    const float logScale[3] = { m_logScale, m_logScale, m_logScale };
+
+    ApplyLin2Log_AVX2((const float *)inImg, (float *)outImg, numPixels, m_precision,
+                      one, zero, logScale, zero);
+}
+
+AntiLogRendererAVX2::AntiLogRendererAVX2(ConstLogOpDataRcPtr & log, float log2base,
+                                         LogExpPowPrecision precision)
+    : AntiLogRenderer(log, log2base)
+    , m_precision(precision)
+{
+}
+
+void AntiLogRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    // out = exp2( log2(base) * in );
+    static constexpr float one[3]  = { 1.0f, 1.0f, 1.0f };
+    static constexpr float zero[3] = { 0.0f, 0.0f, 0.0f };
+    const float log2base[3] = { m_log2_base, m_log2_base, m_log2_base };
+
+    ApplyLog2Lin_AVX2((const float *)inImg, (float *)outImg, numPixels, m_precision,
+                      zero, log2base, zero, one);
+}
+
+Log2LinRendererAVX2::Log2LinRendererAVX2(ConstLogOpDataRcPtr & log,
+                                         LogExpPowPrecision precision)
+    : Log2LinRenderer(log)
+    , m_precision(precision)
+{
+}
 
+void Log2LinRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyLog2Lin_AVX2((const float *)inImg, (float *)outImg, numPixels, m_precision,
+                      m_minuskb, m_kinv, m_minusb, m_minv);
+}
+
+Lin2LogRendererAVX2::Lin2LogRendererAVX2(ConstLogOpDataRcPtr & log,
+                                         LogExpPowPrecision precision)
+    : Lin2LogRenderer(log)
+    , m_precision(precision)
+{
+}
+
+void Lin2LogRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyLin2Log_AVX2((const float *)inImg, (float *)outImg, numPixels, m_precision,
+                      m_m, m_b, m_klog, m_kb);
+}
+
+CameraLog2LinRendererAVX2::CameraLog2LinRendererAVX2(ConstLogOpDataRcPtr & log,
+                                                     LogExpPowPrecision precision)
+    : CameraLog2LinRenderer(log)
+    , m_precision(precision)
+{
+}
+
+void CameraLog2LinRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyCameraLog2Lin_AVX2((const float *)inImg, (float *)outImg, numPixels, m_precision,
+                            m_minuskb, m_kinv, m_minusb, m_minv,
+                            m_logSideBreak, m_minuslino, m_linsinv);
+}
+
+CameraLin2LogRendererAVX2::CameraLin2LogRendererAVX2(ConstLogOpDataRcPtr & log,
+                                                     LogExpPowPrecision precision)
+    : CameraLin2LogRenderer(log)
+    , m_precision(precision)
+{
+}
+
+void CameraLin2LogRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyCameraLin2Log_AVX2((const float *)inImg, (float *)outImg, numPixels, m_precision,
+                            m_m, m_b, m_klog, m_kb,
+                            m_linb, m_linearSlope, m_linearOffset);
+}
+#endif // USE_AVX2
+
+} // namespace OCIO_NAMESPACE
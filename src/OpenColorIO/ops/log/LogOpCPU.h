@@ -7,11 +7,15 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "MathUtils.h"
 #include "ops/log/LogOpData.h"
 
 namespace OCIO_NAMESPACE
 {
-ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastExp);
+
+// The std:: functions are used for LOG_EXP_POW_STD, otherwise the SIMD approximations of the
+// precision tier when available.
+ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, LogExpPowPrecision precision);
 
 } // namespace OCIO_NAMESPACE
 
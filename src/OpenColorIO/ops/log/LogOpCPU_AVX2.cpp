@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/log/LogOpCPU_AVX2.h"
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Duplicate the RGB values in the two pixels of an AVX register (alpha is set to zero).
+inline __m256 LoadRGB(const float (&rgb)[3])
+{
+    return _mm256_setr_ps(rgb[0], rgb[1], rgb[2], 0.0f, rgb[0], rgb[1], rgb[2], 0.0f);
+}
+
+// Smallest normalized float i.e. std::numeric_limits<float>::min().
+inline __m256 MinValue()
+{
+    return _mm256_castsi256_ps(_mm256_set1_epi32(0x00800000));
+}
+
+template<typename Math>
+struct Lin2Log
+{
+    static void Apply(const float * in, float * out, long numPixels,
+                      const float (&m)[3], const float (&b)[3],
+                      const float (&klog)[3], const float (&kb)[3])
+    {
+        const __m256 mm_minValue = MinValue();
+
+        const __m256 mm_m    = LoadRGB(m);
+        const __m256 mm_b    = LoadRGB(b);
+        const __m256 mm_klog = LoadRGB(klog);
+        const __m256 mm_kb   = LoadRGB(kb);
+
+        avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+        {
+            __m256 data = _mm256_add_ps(_mm256_mul_ps(pixel, mm_m), mm_b);
+            data = Math::Log2(_mm256_max_ps(data, mm_minValue));
+            data = _mm256_add_ps(_mm256_mul_ps(data, mm_klog), mm_kb);
+
+            return avx2KeepAlpha(data, pixel);
+        });
+    }
+};
+
+template<typename Math>
+struct Log2Lin
+{
+    static void Apply(const float * in, float * out, long numPixels,
+                      const float (&minuskb)[3], const float (&kinv)[3],
+                      const float (&minusb)[3], const float (&minv)[3])
+    {
+        const __m256 mm_minuskb = LoadRGB(minuskb);
+        const __m256 mm_kinv    = LoadRGB(kinv);
+        const __m256 mm_minusb  = LoadRGB(minusb);
+        const __m256 mm_minv    = LoadRGB(minv);
+
+        avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+        {
+            __m256 data = Math::Exp2(_mm256_mul_ps(_mm256_add_ps(pixel, mm_minuskb), mm_kinv));
+            data = _mm256_mul_ps(_mm256_add_ps(data, mm_minusb), mm_minv);
+
+            return avx2KeepAlpha(data, pixel);
+        });
+    }
+};
+
+template<typename Math>
+struct CameraLin2Log
+{
+    static void Apply(const float * in, float * out, long numPixels,
+                      const float (&m)[3], const float (&b)[3],
+                      const float (&klog)[3], const float (&kb)[3],
+                      const float (&linb)[3], const float (&lins)[3],
+                      const float (&lino)[3])
+    {
+        const __m256 mm_minValue = MinValue();
+
+        const __m256 mm_m    = LoadRGB(m);
+        const __m256 mm_b    = LoadRGB(b);
+        const __m256 mm_klog = LoadRGB(klog);
+        const __m256 mm_kb   = LoadRGB(kb);
+        const __m256 mm_linb = LoadRGB(linb);
+        const __m256 mm_lins = LoadRGB(lins);
+        const __m256 mm_lino = LoadRGB(lino);
+
+        avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+        {
+            const __m256 flag = _mm256_cmp_ps(pixel, mm_linb, _CMP_GT_OQ);
+
+            const __m256 dataLin = _mm256_add_ps(_mm256_mul_ps(pixel, mm_lins), mm_lino);
+
+            __m256 data = _mm256_add_ps(_mm256_mul_ps(pixel, mm_m), mm_b);
+            data = Math::Log2(_mm256_max_ps(data, mm_minValue));
+            data = _mm256_add_ps(_mm256_mul_ps(data, mm_klog), mm_kb);
+
+            return avx2KeepAlpha(avx2Select(flag, data, dataLin), pixel);
+        });
+    }
+};
+
+template<typename Math>
+struct CameraLog2Lin
+{
+    static void Apply(const float * in, float * out, long numPixels,
+                      const float (&minuskb)[3], const float (&kinv)[3],
+                      const float (&minusb)[3], const float (&minv)[3],
+                      const float (&logb)[3], const float (&minuslino)[3],
+                      const float (&linsinv)[3])
+    {
+        const __m256 mm_minuskb   = LoadRGB(minuskb);
+        const __m256 mm_kinv      = LoadRGB(kinv);
+        const __m256 mm_minusb    = LoadRGB(minusb);
+        const __m256 mm_minv      = LoadRGB(minv);
+        const __m256 mm_logb      = LoadRGB(logb);
+        const __m256 mm_minuslino = LoadRGB(minuslino);
+        const __m256 mm_linsinv   = LoadRGB(linsinv);
+
+        avx2ApplyRGBA(in, out, numPixels, [&](__m256 pixel)
+        {
+            const __m256 flag = _mm256_cmp_ps(pixel, mm_logb, _CMP_GT_OQ);
+
+            const __m256 dataLin = _mm256_mul_ps(_mm256_add_ps(pixel, mm_minuslino), mm_linsinv);
+
+            __m256 data = Math::Exp2(_mm256_mul_ps(_mm256_add_ps(pixel, mm_minuskb), mm_kinv));
+            data = _mm256_mul_ps(_mm256_add_ps(data, mm_minusb), mm_minv);
+
+            return avx2KeepAlpha(avx2Select(flag, data, dataLin), pixel);
+        });
+    }
+};
+
+} // anon
+
+void ApplyLin2Log_AVX2(const float * in, float * out, long numPixels,
+                       LogExpPowPrecision precision,
+                       const float (&m)[3], const float (&b)[3],
+                       const float (&klog)[3], const float (&kb)[3])
+{
+    avx2ApplyPrecision<Lin2Log>(precision, in, out, numPixels, m, b, klog, kb);
+}
+
+void ApplyLog2Lin_AVX2(const float * in, float * out, long numPixels,
+                       LogExpPowPrecision precision,
+                       const float (&minuskb)[3], const float (&kinv)[3],
+                       const float (&minusb)[3], const float (&minv)[3])
+{
+    avx2ApplyPrecision<Log2Lin>(precision, in, out, numPixels, minuskb, kinv, minusb, minv);
+}
+
+void ApplyCameraLin2Log_AVX2(const float * in, float * out, long numPixels,
+                             LogExpPowPrecision precision,
+                             const float (&m)[3], const float (&b)[3],
+                             const float (&klog)[3], const float (&kb)[3],
+                             const float (&linb)[3], const float (&lins)[3],
+                             const float (&lino)[3])
+{
+    avx2ApplyPrecision<CameraLin2Log>(precision, in, out, numPixels,
+                                      m, b, klog, kb, linb, lins, lino);
+}
+
+void ApplyCameraLog2Lin_AVX2(const float * in, float * out, long numPixels,
+                             LogExpPowPrecision precision,
+                             const float (&minuskb)[3], const float (&kinv)[3],
+                             const float (&minusb)[3], const float (&minv)[3],
+                             const float (&logb)[3], const float (&minuslino)[3],
+                             const float (&linsinv)[3])
+{
+    avx2ApplyPrecision<CameraLog2Lin>(precision, in, out, numPixels,
+                                      minuskb, kinv, minusb, minv, logb, minuslino, linsinv);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_LOGOP_CPU_AVX2_H
+#define INCLUDED_OCIO_LOGOP_CPU_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "MathUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The AVX2 kernels of the Log renderers, processing packed RGBA float pixels. The parameters
+// hold the red, green and blue values and the alpha channel is left unchanged. They use the
+// same log2 & exp2 approximations as the SSE renderers of the precision tier. Only call them if
+// CPUInfo::hasAVX2() is true.
+
+// out = log2( max( minValue, (in*m + b) ) ) * klog + kb
+void ApplyLin2Log_AVX2(const float * in, float * out, long numPixels,
+                       LogExpPowPrecision precision,
+                       const float (&m)[3], const float (&b)[3],
+                       const float (&klog)[3], const float (&kb)[3]);
+
+// out = ( exp2( (in + minuskb) * kinv ) + minusb ) * minv
+void ApplyLog2Lin_AVX2(const float * in, float * out, long numPixels,
+                       LogExpPowPrecision precision,
+                       const float (&minuskb)[3], const float (&kinv)[3],
+                       const float (&minusb)[3], const float (&minv)[3]);
+
+// out = in > linb ? lin2log(in) : in * lins + lino
+void ApplyCameraLin2Log_AVX2(const float * in, float * out, long numPixels,
+                             LogExpPowPrecision precision,
+                             const float (&m)[3], const float (&b)[3],
+                             const float (&klog)[3], const float (&kb)[3],
+                             const float (&linb)[3], const float (&lins)[3],
+                             const float (&lino)[3]);
+
+// out = in > logb ? log2lin(in) : (in + minuslino) * linsinv
+void ApplyCameraLog2Lin_AVX2(const float * in, float * out, long numPixels,
+                             LogExpPowPrecision precision,
+                             const float (&minuskb)[3], const float (&kinv)[3],
+                             const float (&minusb)[3], const float (&minv)[3],
+                             const float (&logb)[3], const float (&minuslino)[3],
+                             const float (&linsinv)[3]);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
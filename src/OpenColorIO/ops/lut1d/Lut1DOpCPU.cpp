@@ -64,13 +64,18 @@ class BaseLut1DRenderer : public OpCPU
 {
 public:
     explicit BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut);
-    BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth);
+    // When halfLut is true, the LUT values of the float processing (i.e. 32-bit float input and
+    // float output) are stored as half values.
+    BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth, bool halfLut = false);
     virtual ~BaseLut1DRenderer();
 
     // NB: 1D LUT as Lookup table is so important for the performance
     //     that having a way to test it is critical.
     constexpr bool isLookup() const noexcept { return inBD != BIT_DEPTH_F32; }
 
+    // Size in bytes of the LUT values held by the renderer.
+    size_t getLutSize() const noexcept { return m_lutSize; }
+
 protected:
 
     virtual void update(ConstLut1DOpDataRcPtr & lut);
@@ -90,6 +95,9 @@ protected:
     void * m_tmpLutG = nullptr;
     void * m_tmpLutB = nullptr;
 
+    bool m_halfLut = false; // The m_tmpLut* hold half values instead of float values.
+    size_t m_lutSize = 0;
+
     float m_alphaScaling = 0.0f;
 
     BitDepth m_outBitDepth = BIT_DEPTH_UNKNOWN;
@@ -130,10 +138,15 @@ public:
     explicit Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut)
         : BaseLut1DRenderer<inBD, outBD>(lut) {}
 
-    Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth)
-        : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
+    Lut1DRendererHalfCode(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth, bool halfLut = false)
+        : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth, halfLut) {}
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    // The LutType is the type of the interpolated LUT values i.e. float or half.
+    template<typename LutType>
+    void applyImpl(const void * inImg, void * outImg, long numPixels) const;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -145,10 +158,15 @@ public:
     explicit Lut1DRenderer(ConstLut1DOpDataRcPtr & lut) 
         : BaseLut1DRenderer<inBD, outBD>(lut) {}
 
-    Lut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth)
-        : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth) {}
+    Lut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth, bool halfLut = false)
+        : BaseLut1DRenderer<inBD, outBD>(lut, outBitDepth, halfLut) {}
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    // The LutType is the type of the interpolated LUT values i.e. float or half.
+    template<typename LutType>
+    void applyImpl(const void * inImg, void * outImg, long numPixels) const;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -157,10 +175,14 @@ class Lut1DRendererHueAdjust : public Lut1DRenderer<inBD, outBD>
 public:
     Lut1DRendererHueAdjust() = delete;
 
-    explicit Lut1DRendererHueAdjust(ConstLut1DOpDataRcPtr & lut)
-        :  Lut1DRenderer<inBD, outBD>(lut, BIT_DEPTH_F32) {} // HueAdjust needs float processing.
+    explicit Lut1DRendererHueAdjust(ConstLut1DOpDataRcPtr & lut, bool halfLut = false)
+        :  Lut1DRenderer<inBD, outBD>(lut, BIT_DEPTH_F32, halfLut) {} // HueAdjust needs float processing.
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    template<typename LutType>
+    void applyImpl(const void * inImg, void * outImg, long numPixels) const;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -169,10 +191,14 @@ class Lut1DRendererHalfCodeHueAdjust : public Lut1DRendererHalfCode<inBD, outBD>
 public:
     Lut1DRendererHalfCodeHueAdjust() = delete;
 
-    explicit Lut1DRendererHalfCodeHueAdjust(ConstLut1DOpDataRcPtr & lut)
-        : Lut1DRendererHalfCode<inBD, outBD>(lut, BIT_DEPTH_F32) {} // HueAdjust needs float processing.
+    explicit Lut1DRendererHalfCodeHueAdjust(ConstLut1DOpDataRcPtr & lut, bool halfLut = false)
+        : Lut1DRendererHalfCode<inBD, outBD>(lut, BIT_DEPTH_F32, halfLut) {} // HueAdjust needs float processing.
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    template<typename LutType>
+    void applyImpl(const void * inImg, void * outImg, long numPixels) const;
 };
 
 // Holds the parameters of a color component.
@@ -280,9 +306,13 @@ BaseLut1DRenderer<inBD, outBD>::BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
 }
 
 template<BitDepth inBD, BitDepth outBD>
-BaseLut1DRenderer<inBD, outBD>::BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth outBitDepth)
+BaseLut1DRenderer<inBD, outBD>::BaseLut1DRenderer(ConstLut1DOpDataRcPtr & lut,
+                                                  BitDepth outBitDepth,
+                                                  bool halfLut)
     :   OpCPU()
     ,   m_dim(lut->getArray().getLength())
+    // The integer output values would not fit in the half domain.
+    ,   m_halfLut(halfLut && !isLookup() && IsFloatBitDepth(outBD))
     ,   m_outBitDepth(outBitDepth)
 {
     static_assert(inBD!=BIT_DEPTH_UINT32 && inBD!=BIT_DEPTH_UINT14, "Unsupported bit depth.");
@@ -357,6 +387,7 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
         m_tmpLutR = new T[m_dim];
         m_tmpLutG = new T[m_dim];
         m_tmpLutB = new T[m_dim];
+        m_lutSize = m_dim * 3 * sizeof(T);
 
         const Array::Values & lutValues = newLut->getArray().getValues();
 
@@ -368,6 +399,22 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
             ((T*)m_tmpLutB)[i] = L_ADJUST(lutValues[i*3+2] * outMax);
         }
     }
+    else if (m_halfLut)
+    {
+        const Array::Values & lutValues = lut->getArray().getValues();
+
+        m_tmpLutR = new half[m_dim];
+        m_tmpLutG = new half[m_dim];
+        m_tmpLutB = new half[m_dim];
+        m_lutSize = m_dim * 3 * sizeof(half);
+
+        for(unsigned long i=0; i<m_dim; ++i)
+        {
+            ((half*)m_tmpLutR)[i] = SanitizeHalf(lutValues[i*3+0] * outMax);
+            ((half*)m_tmpLutG)[i] = SanitizeHalf(lutValues[i*3+1] * outMax);
+            ((half*)m_tmpLutB)[i] = SanitizeHalf(lutValues[i*3+2] * outMax);
+        }
+    }
     else
     {
         const Array::Values & lutValues = lut->getArray().getValues();
@@ -375,6 +422,7 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
         m_tmpLutR = new float[m_dim];
         m_tmpLutG = new float[m_dim];
         m_tmpLutB = new float[m_dim];
+        m_lutSize = m_dim * 3 * sizeof(float);
 
         for(unsigned long i=0; i<m_dim; ++i)
         {
@@ -427,6 +475,10 @@ void BaseLut1DRenderer<inBD, outBD>::reset()
                 break;
         }
     }
+    else if (m_halfLut)
+    {
+        resetData<half>();
+    }
     else
     {
         resetData<float>();
@@ -450,6 +502,20 @@ BaseLut1DRenderer<inBD, outBD>::~BaseLut1DRenderer()
 
 template<BitDepth inBD, BitDepth outBD>
 void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (this->m_halfLut)
+    {
+        applyImpl<half>(inImg, outImg, numPixels);
+    }
+    else
+    {
+        applyImpl<float>(inImg, outImg, numPixels);
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+template<typename LutType>
+void Lut1DRendererHalfCode<inBD, outBD>::applyImpl(const void * inImg, void * outImg, long numPixels) const
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -480,9 +546,9 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
     }
     else  // Need to interpolate rather than simply lookup.
     {
-        const float * lutR = (const float *)this->m_tmpLutR;
-        const float * lutG = (const float *)this->m_tmpLutG;
-        const float * lutB = (const float *)this->m_tmpLutB;
+        const LutType * lutR = (const LutType *)this->m_tmpLutR;
+        const LutType * lutG = (const LutType *)this->m_tmpLutG;
+        const LutType * lutB = (const LutType *)this->m_tmpLutB;
 
         for(long idx=0; idx<numPixels; ++idx)
         {
@@ -569,6 +635,20 @@ IndexPair IndexPair::GetEdgeFloatValues(float fIn)
 
 template<BitDepth inBD, BitDepth outBD>
 void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (this->m_halfLut)
+    {
+        applyImpl<half>(inImg, outImg, numPixels);
+    }
+    else
+    {
+        applyImpl<float>(inImg, outImg, numPixels);
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+template<typename LutType>
+void Lut1DRenderer<inBD, outBD>::applyImpl(const void * inImg, void * outImg, long numPixels) const
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -599,9 +679,9 @@ void Lut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, long n
     }
     else  // Need to interpolate rather than simply lookup.
     {
-        const float * lutR = (const float *)this->m_tmpLutR;
-        const float * lutG = (const float *)this->m_tmpLutG;
-        const float * lutB = (const float *)this->m_tmpLutB;
+        const LutType * lutR = (const LutType *)this->m_tmpLutR;
+        const LutType * lutG = (const LutType *)this->m_tmpLutG;
+        const LutType * lutB = (const LutType *)this->m_tmpLutB;
 
 #ifdef USE_SSE
         __m128 step = _mm_set_ps(1.0f, this->m_step, this->m_step, this->m_step);
@@ -724,14 +804,24 @@ inline void Order3(const float* RGB, int& min, int& mid, int& max)
 
 template<BitDepth inBD, BitDepth outBD>
 void Lut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (this->m_halfLut)
+    {
+        applyImpl<half>(inImg, outImg, numPixels);
+    }
+    else
+    {
+        applyImpl<float>(inImg, outImg, numPixels);
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+template<typename LutType>
+void Lut1DRendererHalfCodeHueAdjust<inBD, outBD>::applyImpl(const void * inImg, void * outImg, long numPixels) const
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
 
-    const float * lutR = (const float *)this->m_tmpLutR;
-    const float * lutG = (const float *)this->m_tmpLutG;
-    const float * lutB = (const float *)this->m_tmpLutB;
-
     const InType * in = (InType *)inImg;
     OutType * out = (OutType *)outImg;
 
@@ -739,6 +829,10 @@ void Lut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, void
     // (Should be no runtime cost.)
     if (inBD != BIT_DEPTH_F32)
     {
+        const float * lutR = (const float *)this->m_tmpLutR;
+        const float * lutG = (const float *)this->m_tmpLutG;
+        const float * lutB = (const float *)this->m_tmpLutB;
+
         for(long idx=0; idx<numPixels; ++idx)
         {
             const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
@@ -771,6 +865,10 @@ void Lut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, void
     }
     else  // Need to interpolate rather than simply lookup.
     {
+        const LutType * lutR = (const LutType *)this->m_tmpLutR;
+        const LutType * lutG = (const LutType *)this->m_tmpLutG;
+        const LutType * lutB = (const LutType *)this->m_tmpLutB;
+
         for(long idx=0; idx<numPixels; ++idx)
         {
             const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
@@ -819,14 +917,24 @@ void Lut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, void
 
 template<BitDepth inBD, BitDepth outBD>
 void Lut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (this->m_halfLut)
+    {
+        applyImpl<half>(inImg, outImg, numPixels);
+    }
+    else
+    {
+        applyImpl<float>(inImg, outImg, numPixels);
+    }
+}
+
+template<BitDepth inBD, BitDepth outBD>
+template<typename LutType>
+void Lut1DRendererHueAdjust<inBD, outBD>::applyImpl(const void * inImg, void * outImg, long numPixels) const
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
 
-    const float * lutR = (const float *)this->m_tmpLutR;
-    const float * lutG = (const float *)this->m_tmpLutG;
-    const float * lutB = (const float *)this->m_tmpLutB;
-
     const InType * in = (InType *)inImg;
     OutType * out = (OutType *)outImg;
 
@@ -834,6 +942,10 @@ void Lut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * outIm
     // (Should be no runtime cost.)
     if (inBD != BIT_DEPTH_F32)
     {
+        const float * lutR = (const float *)this->m_tmpLutR;
+        const float * lutG = (const float *)this->m_tmpLutG;
+        const float * lutB = (const float *)this->m_tmpLutB;
+
         for(long idx=0; idx<numPixels; ++idx)
         {
             const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
@@ -867,6 +979,10 @@ void Lut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * outIm
     }
     else  // Need to interpolate rather than simply lookup.
     {
+        const LutType * lutR = (const LutType *)this->m_tmpLutR;
+        const LutType * lutG = (const LutType *)this->m_tmpLutG;
+        const LutType * lutB = (const LutType *)this->m_tmpLutB;
+
         for(long i=0; i<numPixels; ++i)
         {
             const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
@@ -1597,7 +1713,7 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
 }
 
 template<BitDepth inBD, BitDepth outBD>
-OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
+OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut, bool halfLut)
 {
     // NB: Unlike bit-depth, the half domain status of a LUT
     //     may not be changed.
@@ -1605,22 +1721,22 @@ OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     {
         if (lut->getHueAdjust() == HUE_NONE)
         {
-            return std::make_shared< Lut1DRendererHalfCode<inBD, outBD> >(lut);
+            return std::make_shared< Lut1DRendererHalfCode<inBD, outBD> >(lut, outBD, halfLut);
         }
         else
         {
-            return std::make_shared< Lut1DRendererHalfCodeHueAdjust<inBD, outBD> >(lut);
+            return std::make_shared< Lut1DRendererHalfCodeHueAdjust<inBD, outBD> >(lut, halfLut);
         }
     }
     else
     {
         if (lut->getHueAdjust() == HUE_NONE)
         {
-            return std::make_shared< Lut1DRenderer<inBD, outBD> >(lut);
+            return std::make_shared< Lut1DRenderer<inBD, outBD> >(lut, outBD, halfLut);
         }
         else
         {
-            return std::make_shared< Lut1DRendererHueAdjust<inBD, outBD> >(lut);
+            return std::make_shared< Lut1DRendererHueAdjust<inBD, outBD> >(lut, halfLut);
         }
     }
 }
@@ -1628,11 +1744,11 @@ OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
 }
 
 template<BitDepth inBD, BitDepth outBD>
-ConstOpCPURcPtr GetLut1DRenderer_OutBitDepth(ConstLut1DOpDataRcPtr & lut)
+ConstOpCPURcPtr GetLut1DRenderer_OutBitDepth(ConstLut1DOpDataRcPtr & lut, bool halfLut)
 {
     if (lut->getDirection() == TRANSFORM_DIR_FORWARD)
     {
-        return GetForwardLut1DRenderer<inBD, outBD>(lut);
+        return GetForwardLut1DRenderer<inBD, outBD>(lut, halfLut);
     }
     else
     {
@@ -1662,22 +1778,23 @@ ConstOpCPURcPtr GetLut1DRenderer_OutBitDepth(ConstLut1DOpDataRcPtr & lut)
 }
 
 template<BitDepth inBD>
-ConstOpCPURcPtr GetLut1DRenderer_InBitDepth(ConstLut1DOpDataRcPtr & lut, BitDepth outBD)
+ConstOpCPURcPtr GetLut1DRenderer_InBitDepth(ConstLut1DOpDataRcPtr & lut, BitDepth outBD,
+                                            bool halfLut)
 {
     switch(outBD)
     {
         case BIT_DEPTH_UINT8:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT8>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT8>(lut, halfLut); break;
         case BIT_DEPTH_UINT10:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT10>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT10>(lut, halfLut); break;
         case BIT_DEPTH_UINT12:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT12>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT12>(lut, halfLut); break;
         case BIT_DEPTH_UINT16:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT16>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_UINT16>(lut, halfLut); break;
         case BIT_DEPTH_F16:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_F16>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_F16>(lut, halfLut); break;
         case BIT_DEPTH_F32:
-            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_F32>(lut); break;
+            return GetLut1DRenderer_OutBitDepth<inBD, BIT_DEPTH_F32>(lut, halfLut); break;
 
         case BIT_DEPTH_UINT14:
         case BIT_DEPTH_UINT32:
@@ -1690,22 +1807,23 @@ ConstOpCPURcPtr GetLut1DRenderer_InBitDepth(ConstLut1DOpDataRcPtr & lut, BitDept
     return ConstOpCPURcPtr();
 }
 
-ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth inBD, BitDepth outBD)
+ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth inBD, BitDepth outBD,
+                                 bool halfLut)
 {
     switch(inBD)
     {
         case BIT_DEPTH_UINT8:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT8>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT8>(lut, outBD, halfLut); break;
         case BIT_DEPTH_UINT10:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT10>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT10>(lut, outBD, halfLut); break;
         case BIT_DEPTH_UINT12:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT12>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT12>(lut, outBD, halfLut); break;
         case BIT_DEPTH_UINT16:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT16>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_UINT16>(lut, outBD, halfLut); break;
         case BIT_DEPTH_F16:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_F16>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_F16>(lut, outBD, halfLut); break;
         case BIT_DEPTH_F32:
-            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_F32>(lut, outBD); break;
+            return GetLut1DRenderer_InBitDepth<BIT_DEPTH_F32>(lut, outBD, halfLut); break;
 
         case BIT_DEPTH_UINT14:
         case BIT_DEPTH_UINT32:
@@ -11,7 +11,11 @@
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth in, BitDepth out);
+// When halfLut is true, the values of a forward LUT are stored as half values for the float
+// processing (i.e. in is 32-bit float and out is a float bit-depth), see
+// OPTIMIZATION_LUT_HALF_STORAGE.
+ConstOpCPURcPtr GetLut1DRenderer(ConstLut1DOpDataRcPtr & lut, BitDepth in, BitDepth out,
+                                 bool halfLut = false);
 
 } // namespace OCIO_NAMESPACE
 
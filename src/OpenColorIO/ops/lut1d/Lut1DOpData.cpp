@@ -9,7 +9,6 @@
 #include "BitDepthUtils.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
-#include "md5/md5.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
 #include "ops/matrix/MatrixOp.h"
@@ -530,16 +529,19 @@ std::string Lut1DOpData::getCacheID() const
 {
     AutoMutex lock(m_mutex);
 
-    const Lut3by1DArray::Values & values = getArray().getValues();
-
     std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]), 
-                                 int(values.size() * sizeof(values[0])))
+    // The hash of the values is the expensive part of the cache ID so it is memoized.
+    cacheIDStream << m_arrayHash.get([this]()
+                     {
+                         const Lut3by1DArray::Values & values = getArray().getValues();
+                         return CacheIDHash(reinterpret_cast<const char*>(&values[0]),
+                                            int(values.size() * sizeof(values[0])));
+                     })
                   << " ";
 
     cacheIDStream << TransformDirectionToString(m_direction)                   << " ";
@@ -816,7 +818,7 @@ void Lut1DOpData::finalize()
     {
         initializeFromForward();
     }
-    m_array.adjustColorComponentNumber();
+    getArray().adjustColorComponentNumber();
 }
 
 void Lut1DOpData::initializeFromForward()
@@ -6,6 +6,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "HashUtils.h"
 #include "Op.h"
 #include "ops/OpArray.h"
 #include "PrivateTypes.h"
@@ -150,7 +151,8 @@ public:
 
     // Get an array containing the LUT elements.
     // The elements are stored as a vector [r0,g0,b0, r1,g1,b1, r2,g2,b2, ...].
-    inline Array & getArray() noexcept { return m_array; }
+    // Note: The elements could then change so the memoized hash of the array is invalidated.
+    inline Array & getArray() noexcept { m_arrayHash.invalidate(); return m_array; }
 
     void validate() const override;
 
@@ -247,6 +249,7 @@ private:
 
     Interpolation       m_interpolation;
     Lut3by1DArray       m_array;
+    MemoizedHash        m_arrayHash; // Hash of the array values used by getCacheID().
     HalfFlags           m_halfFlags;
     Lut1DHueAdjust      m_hueAdjust;
 
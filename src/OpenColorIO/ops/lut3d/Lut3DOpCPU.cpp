@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cstring>
 #include <math.h>
 #include <stdint.h>
 #include <vector>
@@ -9,11 +10,16 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "Caching.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
+#include "Mutex.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
+#include "ops/lut3d/Lut3DOpCPU_AVX2.h"
 #include "ops/OpTools.h"
 #include "Platform.h"
 #include "SSE.h"
+#include "ThreadPool.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -26,20 +32,34 @@ public:
     explicit BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~BaseLut3DRenderer();
 
+    // Size in bytes of the lattice held by the renderer.
+    size_t getLatticeSize() const noexcept;
+
 protected:
+    // When halfLattice is true, the lattice is stored in m_optLutHalf instead of m_optLut.
+    BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfLattice);
+
     void updateData(ConstLut3DOpDataRcPtr & lut);
 
     // Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
     // in order to be able to load the LUT using _mm_load_ps.
     float* createOptLut(const Array::Values& lut) const;
 
+#ifdef USE_SSE
+    // Same as createOptLut() but with half values (i.e. their 16-bit representation).
+    uint16_t* createOptLutHalf(const Array::Values& lut) const;
+#endif
+
 protected:
     // Keep all these values because they are invariant during the
     // processing. So to slim the processing code, these variables
     // are computed in the constructor.
     float*        m_optLut;
+    uint16_t*     m_optLutHalf;
+    bool          m_halfLattice;
     unsigned long m_dim;
     float         m_step;
+    Lut3DLayout   m_layout; // Layout of the m_optLut (or m_optLutHalf) entries.
 
 private:
     BaseLut3DRenderer() = delete;
@@ -54,7 +74,24 @@ public:
     virtual ~Lut3DTetrahedralRenderer();
 
     void apply(const void * inImg, void * outImg, long numPixels) const;
+
+protected:
+    Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut, bool halfLattice);
+};
+
+#ifdef USE_AVX2
+// Only the AVX2 renderers could decode a half lattice.
+class Lut3DTetrahedralRendererAVX2 : public Lut3DTetrahedralRenderer
+{
+public:
+    Lut3DTetrahedralRendererAVX2(ConstLut3DOpDataRcPtr & lut, bool halfLattice)
+        : Lut3DTetrahedralRenderer(lut, halfLattice)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
+#endif
 
 class Lut3DRenderer : public BaseLut3DRenderer
 {
@@ -64,7 +101,22 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const;
 
+protected:
+    Lut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfLattice);
+};
+
+#ifdef USE_AVX2
+class Lut3DRendererAVX2 : public Lut3DRenderer
+{
+public:
+    Lut3DRendererAVX2(ConstLut3DOpDataRcPtr & lut, bool halfLattice)
+        : Lut3DRenderer(lut, halfLattice)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
+#endif
 
 class InvLut3DRenderer : public OpCPU
 {
@@ -160,6 +212,16 @@ class InvLut3DRenderer : public OpCPU
 
 public:
 
+    // The extrapolated 3d-LUT and its tree only depend on the LUT values so they are built
+    // once and shared by all the renderers of the LUT, see GetInvLut3DTree().
+    struct InvTree
+    {
+        std::vector<float> m_grvec;    // extrapolated 3d-LUT values
+        RangeTree          m_tree;     // object to allow fast range queries of
+                                       // the LUT
+    };
+    typedef OCIO_SHARED_PTR<const InvTree> ConstInvTreeRcPtr;
+
     explicit InvLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~InvLut3DRenderer();
 
@@ -168,15 +230,16 @@ public:
     virtual void updateData(ConstLut3DOpDataRcPtr & lut);
 
     // Extrapolate the 3d-LUT to handle values outside the LUT gamut
-    void extrapolate3DArray(ConstLut3DOpDataRcPtr & lut);
+    static void extrapolate3DArray(ConstLut3DOpDataRcPtr & lut, std::vector<float> & grvec);
+
+    // Build the extrapolated 3d-LUT and its tree.
+    static ConstInvTreeRcPtr CreateInvTree(ConstLut3DOpDataRcPtr & lut);
 
 protected:
     float              m_scale;        // output scaling for r, g and b
                                        // components
     long               m_dim;          // grid size of the extrapolated 3d-LUT
-    RangeTree          m_tree;         // object to allow fast range queries of
-                                       // the LUT
-    std::vector<float> m_grvec;        // extrapolated 3d-LUT values
+    ConstInvTreeRcPtr  m_invTree;      // extrapolated 3d-LUT and its tree
 
 private:
     InvLut3DRenderer() = delete;
@@ -184,6 +247,34 @@ private:
     InvLut3DRenderer& operator=(const InvLut3DRenderer&) = delete;
 };
 
+// Renderer of the inverse LUT when OPTIMIZATION_LUT_INV_REFINE is set. Instead of searching the
+// tree, the result of the fast inverse LUT (see MakeFastLut3DFromInverse()) is refined by a few
+// Newton iterations on the tetrahedral interpolation of the extrapolated LUT. The tree is only
+// searched for the values where the iterations do not converge (e.g. around the folds of the
+// extrapolation).
+class InvLut3DRefineRenderer : public InvLut3DRenderer
+{
+public:
+    explicit InvLut3DRefineRenderer(ConstLut3DOpDataRcPtr & lut);
+    virtual ~InvLut3DRefineRenderer();
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Refine the inverse of the target value where the inverse is in index units of the
+    // extrapolated LUT. Return false if the iterations do not converge.
+    bool refine(const float (&target)[3], float (&inverse)[3]) const;
+
+    static constexpr int MaxIterations = 8;
+
+protected:
+    ConstOpCPURcPtr m_fastRenderer; // renderer of the fast inverse LUT i.e. the initial values
+
+private:
+    InvLut3DRefineRenderer() = delete;
+    InvLut3DRefineRenderer(const InvLut3DRefineRenderer&) = delete;
+    InvLut3DRefineRenderer& operator=(const InvLut3DRefineRenderer&) = delete;
+};
+
 
 int GetLut3DIndexBlueFast(int indexR, int indexG, int indexB, long dim)
 {
@@ -241,21 +332,39 @@ inline __m128i GetLut3DIndices(const __m128i &idxR,
     return _mm_slli_epi32(r, 2);
 }
 
-inline void LookupNearest4(float* optLut,
+inline void LookupNearest4(const float* optLut,
+                           const Lut3DLayout & layout,
                            const __m128i &rIndices,
                            const __m128i &gIndices,
                            const __m128i &bIndices,
                            const __m128i &dim,
                            __m128 res[4])
 {
-    __m128i offsets = GetLut3DIndices(rIndices, gIndices, bIndices, dim, dim, dim);
-
-    int* offsetInt = (int*)&offsets;
+    if (layout.m_shift == 0)
+    {
+        // Blue fastest layout i.e. the offsets are computed in one go.
+        OCIO_ALIGN(int offsets[4]);
+        _mm_store_si128((__m128i *)offsets,
+                        GetLut3DIndices(rIndices, gIndices, bIndices, dim, dim, dim));
+
+        res[0] = _mm_load_ps(optLut + offsets[0]);
+        res[1] = _mm_load_ps(optLut + offsets[1]);
+        res[2] = _mm_load_ps(optLut + offsets[2]);
+        res[3] = _mm_load_ps(optLut + offsets[3]);
+        return;
+    }
 
-    res[0] = _mm_load_ps(optLut + offsetInt[0]);
-    res[1] = _mm_load_ps(optLut + offsetInt[1]);
-    res[2] = _mm_load_ps(optLut + offsetInt[2]);
-    res[3] = _mm_load_ps(optLut + offsetInt[3]);
+    OCIO_ALIGN(int idxR[4]);
+    OCIO_ALIGN(int idxG[4]);
+    OCIO_ALIGN(int idxB[4]);
+    _mm_store_si128((__m128i *)idxR, rIndices);
+    _mm_store_si128((__m128i *)idxG, gIndices);
+    _mm_store_si128((__m128i *)idxB, bIndices);
+
+    res[0] = _mm_load_ps(optLut + 4 * layout.getOffset(idxR[0], idxG[0], idxB[0]));
+    res[1] = _mm_load_ps(optLut + 4 * layout.getOffset(idxR[1], idxG[1], idxB[1]));
+    res[2] = _mm_load_ps(optLut + 4 * layout.getOffset(idxR[2], idxG[2], idxB[2]));
+    res[3] = _mm_load_ps(optLut + 4 * layout.getOffset(idxR[3], idxG[3], idxB[3]));
 }
 #else
 
@@ -294,10 +403,18 @@ inline void lerp_rgb(float* out, float* a, float* b, float* c, float* d,
 #endif
 
 BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
+    : BaseLut3DRenderer(lut, false)
+{
+}
+
+BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfLattice)
     : OpCPU()
     , m_optLut(0x0)
+    , m_optLutHalf(0x0)
+    , m_halfLattice(halfLattice)
     , m_dim(0)
     , m_step(0.0f)
+    , m_layout(lut->getArray().getLength())
 {
     updateData(lut);
 }
@@ -306,19 +423,40 @@ BaseLut3DRenderer::~BaseLut3DRenderer()
 {
 #ifdef USE_SSE
     Platform::AlignedFree(m_optLut);
+    Platform::AlignedFree(m_optLutHalf);
 #else
     free(m_optLut);
 #endif
 }
 
+size_t BaseLut3DRenderer::getLatticeSize() const noexcept
+{
+#ifdef USE_SSE
+    return m_layout.m_numEntries * 4 * (m_halfLattice ? sizeof(uint16_t) : sizeof(float));
+#else
+    return m_dim * m_dim * m_dim * 3 * sizeof(float);
+#endif
+}
+
 void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
 {
     m_dim = lut->getArray().getLength();
 
     m_step = ((float)m_dim - 1.0f);
 
+    m_layout = Lut3DLayout(m_dim);
+
 #ifdef USE_SSE
     Platform::AlignedFree(m_optLut);
+    Platform::AlignedFree(m_optLutHalf);
+    m_optLut     = nullptr;
+    m_optLutHalf = nullptr;
+
+    if (m_halfLattice)
+    {
+        m_optLutHalf = createOptLutHalf(lut->getArray().getValues());
+        return;
+    }
 #else
     free(m_optLut);
 #endif
@@ -327,22 +465,61 @@ void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
 
 #ifdef USE_SSE
 // Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
-// in order to be able to load the LUT using _mm_load_ps.
+// in order to be able to load the LUT using _mm_load_ps. The entries are
+// stored using m_layout.
 float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 {
-    const long maxEntries = m_dim * m_dim * m_dim;
+    const size_t numValues = m_layout.m_numEntries * 4;
 
     float *optLut =
-        (float*)Platform::AlignedMalloc(maxEntries * 4 * sizeof(float), 16);
+        (float*)Platform::AlignedMalloc(numValues * sizeof(float), 16);
 
-    float* currentValue = optLut;
-    for (long idx = 0; idx<maxEntries; idx++)
+    // The unused entries of the partial bricks are never read.
+    std::fill(optLut, optLut + numValues, 0.0f);
+
+    const int dim = (int)m_dim;
+    long idx = 0;
+    for (int r = 0; r < dim; ++r)
     {
-        currentValue[0] = SanitizeFloat(lut[idx * 3]);
-        currentValue[1] = SanitizeFloat(lut[idx * 3 + 1]);
-        currentValue[2] = SanitizeFloat(lut[idx * 3 + 2]);
-        currentValue[3] = 0.0f;
-        currentValue += 4;
+        for (int g = 0; g < dim; ++g)
+        {
+            for (int b = 0; b < dim; ++b, ++idx)
+            {
+                float* currentValue = optLut + 4 * m_layout.getOffset(r, g, b);
+                currentValue[0] = SanitizeFloat(lut[idx * 3]);
+                currentValue[1] = SanitizeFloat(lut[idx * 3 + 1]);
+                currentValue[2] = SanitizeFloat(lut[idx * 3 + 2]);
+            }
+        }
+    }
+
+    return optLut;
+}
+
+uint16_t* BaseLut3DRenderer::createOptLutHalf(const Array::Values& lut) const
+{
+    const size_t numValues = m_layout.m_numEntries * 4;
+
+    uint16_t *optLut =
+        (uint16_t*)Platform::AlignedMalloc(numValues * sizeof(uint16_t), 16);
+
+    // The unused entries of the partial bricks are never read.
+    std::fill(optLut, optLut + numValues, (uint16_t)0);
+
+    const int dim = (int)m_dim;
+    long idx = 0;
+    for (int r = 0; r < dim; ++r)
+    {
+        for (int g = 0; g < dim; ++g)
+        {
+            for (int b = 0; b < dim; ++b, ++idx)
+            {
+                uint16_t* currentValue = optLut + 4 * m_layout.getOffset(r, g, b);
+                currentValue[0] = SanitizeHalf(lut[idx * 3]).bits();
+                currentValue[1] = SanitizeHalf(lut[idx * 3 + 1]).bits();
+                currentValue[2] = SanitizeHalf(lut[idx * 3 + 2]).bits();
+            }
+        }
     }
 
     return optLut;
@@ -373,6 +550,11 @@ Lut3DTetrahedralRenderer::Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut)
 {
 }
 
+Lut3DTetrahedralRenderer::Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut, bool halfLattice)
+    : BaseLut3DRenderer(lut, halfLattice)
+{
+}
+
 Lut3DTetrahedralRenderer::~Lut3DTetrahedralRenderer()
 {
 }
@@ -462,7 +644,7 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
                 idxG = _mm_shuffle_epi32(lh01, _MM_SHUFFLE(3, 3, 2, 2));
                 idxB = _mm_shuffle_epi32(lh23, _MM_SHUFFLE(1, 0, 0, 0));
 
-                LookupNearest4(m_optLut, idxR, idxG, idxB, dim, v);
+                LookupNearest4(m_optLut, m_layout, idxR, idxG, idxB, dim, v);
 
                 // Order: R G B => 0 1 2
                 dv0 = _mm_sub_ps(v[1], v[0]);
@@ -483,7 +665,7 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
                 idxG = _mm_shuffle_epi32(lh01, _MM_SHUFFLE(3, 2, 2, 2));
                 idxB = _mm_shuffle_epi32(lh23, _MM_SHUFFLE(1, 1, 0, 0));
 
-                LookupNearest4(m_optLut, idxR, idxG, idxB, dim, v);
+                LookupNearest4(m_optLut, m_layout, idxR, idxG, idxB, dim, v);
 
                 // Order: R B G => 0 2 1
                 dv0 = _mm_sub_ps(v[1], v[0]);
@@ -504,7 +686,7 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
                 idxG = _mm_shuffle_epi32(lh01, _MM_SHUFFLE(3, 2, 2, 2));
                 idxB = _mm_shuffle_epi32(lh23, _MM_SHUFFLE(1, 1, 1, 0));
 
-                LookupNearest4(m_optLut, idxR, idxG, idxB, dim, v);
+                LookupNearest4(m_optLut, m_layout, idxR, idxG, idxB, dim, v);
 
                 // Order: B R G => 2 0 1
                 dv2 = _mm_sub_ps(v[1], v[0]);
@@ -528,7 +710,7 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
                 idxG = _mm_shuffle_epi32(lh01, _MM_SHUFFLE(3, 3, 2, 2));
                 idxB = _mm_shuffle_epi32(lh23, _MM_SHUFFLE(1, 1, 1, 0));
 
-                LookupNearest4(m_optLut, idxR, idxG, idxB, dim, v);
+                LookupNearest4(m_optLut, m_layout, idxR, idxG, idxB, dim, v);
 
                 // Order: B G R => 2 1 0
                 dv2 = _mm_sub_ps(v[1], v[0]);
@@ -549,7 +731,7 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
                 idxG = _mm_shuffle_epi32(lh01, _MM_SHUFFLE(3, 3, 3, 2));
                 idxB = _mm_shuffle_epi32(lh23, _MM_SHUFFLE(1, 0, 0, 0));
 
-                LookupNearest4(m_optLut, idxR, idxG, idxB, dim, v);
+                LookupNearest4(m_optLut, m_layout, idxR, idxG, idxB, dim, v);
 
                 // Order: G R B => 1 0 2
                 dv1 = _mm_sub_ps(v[1], v[0]);
@@ -570,7 +752,7 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
                 idxG = _mm_shuffle_epi32(lh01, _MM_SHUFFLE(3, 3, 3, 2));
                 idxB = _mm_shuffle_epi32(lh23, _MM_SHUFFLE(1, 1, 0, 0));
 
-                LookupNearest4(m_optLut, idxR, idxG, idxB, dim, v);
+                LookupNearest4(m_optLut, m_layout, idxR, idxG, idxB, dim, v);
 
                 // Order: G B R => 1 2 0
                 dv1 = _mm_sub_ps(v[1], v[0]);
@@ -788,6 +970,11 @@ Lut3DRenderer::Lut3DRenderer(ConstLut3DOpDataRcPtr & lut)
 {
 }
 
+Lut3DRenderer::Lut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfLattice)
+    : BaseLut3DRenderer(lut, halfLattice)
+{
+}
+
 Lut3DRenderer::~Lut3DRenderer()
 {
 }
@@ -854,8 +1041,8 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
         idxB = _mm_unpacklo_epi64(lh23, lh23);
 
         // Lookup 8 corners of cube
-        LookupNearest4(m_optLut, idxR_L0, idxG, idxB, dim, v);
-        LookupNearest4(m_optLut, idxR_H0, idxG, idxB, dim, v + 4);
+        LookupNearest4(m_optLut, m_layout, idxR_L0, idxG, idxB, dim, v);
+        LookupNearest4(m_optLut, m_layout, idxR_H0, idxG, idxB, dim, v + 4);
 
         // Perform the trilinear interpolation
         __m128 wr = _mm_shuffle_ps(delta, delta, _MM_SHUFFLE(0, 0, 0, 0));
@@ -1237,6 +1424,24 @@ unsigned long invert_hypercube
     }
 }
 
+// Call func(i) for each i in [0, numItems) using all the hardware threads, where the items are
+// processed by blocks to limit the overhead.
+void ParallelForRange(unsigned long numItems, const std::function<void(unsigned long)> & func)
+{
+    constexpr unsigned long BlockSize = 4096;
+    const long numBlocks = long((numItems + BlockSize - 1) / BlockSize);
+
+    ParallelFor(0, numBlocks, [&](long block)
+    {
+        const unsigned long start = (unsigned long)block * BlockSize;
+        const unsigned long end   = std::min(start + BlockSize, numItems);
+        for (unsigned long i = start; i < end; ++i)
+        {
+            func(i);
+        }
+    });
+}
+
 InvLut3DRenderer::RangeTree::RangeTree()
 {
 }
@@ -1282,10 +1487,11 @@ void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
         throw Exception("Unsupported channel number.");
     }
 
-    float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    for (unsigned long i = 0; i < N; i++)
+    ParallelForRange(N, [&](unsigned long i)
     {
+        float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
         const unsigned long baseOffset = m_baseInds[i].inds[0] * ind0scale +
             m_baseInds[i].inds[1] * ind1scale + m_baseInds[i].inds[2];
 
@@ -1313,7 +1519,7 @@ void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
             m_levels[depthm1].minVals[i * m_chans + k] = minVal[k] - TOL;
             m_levels[depthm1].maxVals[i * m_chans + k] = maxVal[k] + TOL;
         }
-    }
+    });
 }
 
 void InvLut3DRenderer::RangeTree::initInds()
@@ -1425,7 +1631,7 @@ void InvLut3DRenderer::RangeTree::updateRanges(const unsigned long level)
     m_levels[level].minVals.resize(levelSize * m_chans);
     m_levels[level].maxVals.resize(levelSize * m_chans);
 
-    for (unsigned long i = 0; i < levelSize; i++)
+    ParallelForRange(levelSize, [&](unsigned long i)
     {
         const unsigned long index = m_levels[level].child0offsets[i];
         for (unsigned long k = 0; k < m_chans; k++)
@@ -1459,7 +1665,7 @@ void InvLut3DRenderer::RangeTree::updateRanges(const unsigned long level)
                 }
             }
         }
-    }
+    });
 }
 
 void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
@@ -1510,10 +1716,10 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     // Calculate hash for indices.
 
     const unsigned long cnt = (const unsigned long)m_baseInds.size();
-    for (unsigned long i = 0; i < cnt; i++)
+    ParallelForRange(cnt, [&](unsigned long i)
     {
         indsToHash(i);
-    }
+    });
 
     // Sort indices based on hash.
     std::sort(m_baseInds.begin(), m_baseInds.end());
@@ -1588,11 +1794,67 @@ float* extrapolate(float RGB[3], float center, float scale)
     return RGB;
 }
 
+// Data derived from an inverse LUT, which are built on demand and shared by all its renderers.
+struct InvLut3DCacheEntry
+{
+    Mutex                               m_treeMutex;
+    InvLut3DRenderer::ConstInvTreeRcPtr m_invTree;
+};
+
+typedef OCIO_SHARED_PTR<InvLut3DCacheEntry> InvLut3DCacheEntryRcPtr;
+
+// The renderers hold the trees they use so the cache only needs to keep the trees of the
+// recently used LUTs (e.g. to rebuild the processors of a config) and a tree of a large LUT is
+// several MB, hence the cache is bounded.
+constexpr size_t InvLut3DCacheMaxEntries = 32;
+
+// The key is the cache ID of the inverse LUT.
+class InvLut3DCache : public GenericCache<std::string, InvLut3DCacheEntryRcPtr>
+{
+public:
+    InvLut3DCache()
+    {
+        setCapacity(InvLut3DCacheMaxEntries, 0);
+    }
+};
+
+InvLut3DCache g_invLut3DCache;
+
+InvLut3DCacheEntryRcPtr GetInvLut3DCacheEntry(ConstLut3DOpDataRcPtr & lut)
+{
+    if (g_invLut3DCache.isEnabled())
+    {
+        const std::string key = lut->getCacheID();
+
+        AutoMutex guard(g_invLut3DCache.lock());
+
+        InvLut3DCacheEntryRcPtr & entry = g_invLut3DCache[key];
+        if (!entry)
+        {
+            entry = std::make_shared<InvLut3DCacheEntry>();
+        }
+        return entry;
+    }
+
+    return std::make_shared<InvLut3DCacheEntry>();
+}
+
+InvLut3DRenderer::ConstInvTreeRcPtr GetInvLut3DTree(ConstLut3DOpDataRcPtr & lut)
+{
+    InvLut3DCacheEntryRcPtr entry = GetInvLut3DCacheEntry(lut);
+
+    AutoMutex lock(entry->m_treeMutex);
+    if (!entry->m_invTree)
+    {
+        entry->m_invTree = InvLut3DRenderer::CreateInvTree(lut);
+    }
+    return entry->m_invTree;
+}
+
 InvLut3DRenderer::InvLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
     : OpCPU()
     , m_scale(0.0f)
     , m_dim(0)
-    , m_tree()
 {
     updateData(lut);
 }
@@ -1601,15 +1863,25 @@ InvLut3DRenderer:: ~InvLut3DRenderer()
 {
 }
 
+InvLut3DRenderer::ConstInvTreeRcPtr InvLut3DRenderer::CreateInvTree(ConstLut3DOpDataRcPtr & lut)
+{
+    auto invTree = std::make_shared<InvTree>();
+
+    extrapolate3DArray(lut, invTree->m_grvec);
+
+    // Extrapolation adds 2.
+    invTree->m_tree.initialize(invTree->m_grvec.data(), lut->getArray().getLength() + 2);
+    //invTree->m_tree.print();
+
+    return invTree;
+}
+
 void InvLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
 {
-    extrapolate3DArray(lut);
+    m_invTree = GetInvLut3DTree(lut);
 
     m_dim = lut->getArray().getLength() + 2;  // extrapolation adds 2
 
-    m_tree.initialize(m_grvec.data(), m_dim);
-    //m_tree.print();
-
     // Converts from index units to inDepth units of the original LUT.
     // (Note that inDepth of the original LUT is outDepth of the inverse LUT.)
     // (Note that the result should be relative to the unextrapolated LUT,
@@ -1617,7 +1889,7 @@ void InvLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
     m_scale = 1.0f / (float)(m_dim - 3);
 }
 
-void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
+void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut, std::vector<float> & grvec)
 {
     const unsigned long dim = lut->getArray().getLength();
     const unsigned long newDim = dim + 2;
@@ -1628,18 +1900,18 @@ void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
     Lut3DOpData::Lut3DArray newArray(newDim);
 
     // Copy center values.
-    for (unsigned long idx = 0; idx<dim; idx++)
+    ParallelFor(0, (long)dim, [&](long idx)
     {
         for (unsigned long jdx = 0; jdx<dim; jdx++)
         {
             for (unsigned long kdx = 0; kdx<dim; kdx++)
             {
                 float RGB[3];
-                array.getRGB(idx, jdx, kdx, RGB);
+                array.getRGB((unsigned long)idx, jdx, kdx, RGB);
                 newArray.setRGB(idx + 1, jdx + 1, kdx + 1, RGB);
             }
         }
-    }
+    });
 
     const float center = 0.5f;
     const float scale = 4.f;
@@ -1746,19 +2018,21 @@ void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
         }
     }
 
-    m_grvec = newArray.getValues();
+    grvec = newArray.getValues();
 }
 
 // TODO apply() needs further optimization work.
 
 void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const unsigned long* gsz = m_tree.getGridSize();
+    const RangeTree & tree = m_invTree->m_tree;
+    const unsigned long* gsz = tree.getGridSize();
     const float maxDim = float(gsz[0] - 3u);  // unextrapolated max
-    const unsigned long chans = m_tree.getChans();
-    const unsigned long depth = m_tree.getDepth();
-    const TreeLevels& levels = m_tree.getLevels();
-    const BaseIndsVec& baseInds = m_tree.getBaseInds();
+    const unsigned long chans = tree.getChans();
+    const unsigned long depth = tree.getDepth();
+    const TreeLevels& levels = tree.getLevels();
+    const BaseIndsVec& baseInds = tree.getBaseInds();
+    const float * grvec = m_invTree->m_grvec.data();
 
     unsigned long offs[3] = { gsz[2] * gsz[1], gsz[2], 1 };
 
@@ -1858,7 +2132,7 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
 
                         float fxval[3] = { R, G, B };
 
-                        const bool valid = (invert_hypercube(3, result, m_grvec.data(),
+                        const bool valid = (invert_hypercube(3, result, grvec,
                                                              offs, fxval, baseIndx,
                                                              list_len, ops_list,
                                                              entering_list, new_vert_list,
@@ -1894,26 +2168,299 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
-ConstOpCPURcPtr GetForwardLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
+#ifdef USE_AVX2
+void Lut3DTetrahedralRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (m_halfLattice)
+    {
+        ApplyLut3DTetrahedral_AVX2(m_optLutHalf, m_layout, m_dim,
+                                   (const float *)inImg, (float *)outImg, numPixels);
+    }
+    else
+    {
+        ApplyLut3DTetrahedral_AVX2(m_optLut, m_layout, m_dim,
+                                   (const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+
+void Lut3DRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (m_halfLattice)
+    {
+        ApplyLut3DTrilinear_AVX2(m_optLutHalf, m_layout, m_dim,
+                                 (const float *)inImg, (float *)outImg, numPixels);
+    }
+    else
+    {
+        ApplyLut3DTrilinear_AVX2(m_optLut, m_layout, m_dim,
+                                 (const float *)inImg, (float *)outImg, numPixels);
+    }
+}
+#endif
+
+ConstOpCPURcPtr GetForwardLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfLattice)
 {
     const Interpolation interp = lut->getConcreteInterpolation();
     if (interp == INTERP_TETRAHEDRAL)
     {
+#ifdef USE_AVX2
+        if (CPUInfo::Instance().hasAVX2())
+        {
+            return std::make_shared<Lut3DTetrahedralRendererAVX2>(lut, halfLattice);
+        }
+#endif
         return std::make_shared<Lut3DTetrahedralRenderer>(lut);
     }
     else
     {
+#ifdef USE_AVX2
+        if (CPUInfo::Instance().hasAVX2())
+        {
+            return std::make_shared<Lut3DRendererAVX2>(lut, halfLattice);
+        }
+#endif
         return std::make_shared<Lut3DRenderer>(lut);
     }
 }
 
+InvLut3DRefineRenderer::InvLut3DRefineRenderer(ConstLut3DOpDataRcPtr & lut)
+    : InvLut3DRenderer(lut)
+{
+    ConstLut3DOpDataRcPtr fastLut = MakeFastLut3DFromInverse(lut);
+    m_fastRenderer = GetForwardLut3DRenderer(fastLut, false);
+}
+
+InvLut3DRefineRenderer::~InvLut3DRefineRenderer()
+{
+}
+
+float Determinant(const float (&mat)[3][3])
+{
+    return mat[0][0] * (mat[1][1] * mat[2][2] - mat[1][2] * mat[2][1])
+         + mat[0][1] * (mat[1][2] * mat[2][0] - mat[1][0] * mat[2][2])
+         + mat[0][2] * (mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0]);
+}
+
+bool InvLut3DRefineRenderer::refine(const float (&target)[3], float (&inverse)[3]) const
+{
+    const float maxIdx = (float)(m_dim - 1);
+    const float * values = m_invTree->m_grvec.data();
+
+    for (int iter = 0; iter < MaxIterations; ++iter)
+    {
+        int   idx[3];
+        float frac[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            inverse[c] = Clamp(inverse[c], 0.f, maxIdx);
+            idx[c]     = std::min((int)inverse[c], (int)m_dim - 2);
+            frac[c]    = inverse[c] - (float)idx[c];
+        }
+
+        const int base[3] = { idx[0], idx[1], idx[2] };
+
+        // The tetrahedron holding the value is the path from the base corner of the cube which
+        // increments the indices by decreasing fraction.
+        int axes[3] = { 0, 1, 2 };
+        if (frac[axes[0]] < frac[axes[1]]) std::swap(axes[0], axes[1]);
+        if (frac[axes[1]] < frac[axes[2]]) std::swap(axes[1], axes[2]);
+        if (frac[axes[0]] < frac[axes[1]]) std::swap(axes[0], axes[1]);
+
+        // As the interpolation is linear in the tetrahedron, the columns of the jacobian are
+        // the differences between the consecutive corners of the path.
+        const float * prev = &values[GetLut3DIndexBlueFast(idx[0], idx[1], idx[2], m_dim)];
+        float value[3] = { prev[0], prev[1], prev[2] };
+        float jac[3][3];
+        for (int k = 0; k < 3; ++k)
+        {
+            const int axis = axes[k];
+            ++idx[axis];
+            const float * next = &values[GetLut3DIndexBlueFast(idx[0], idx[1], idx[2], m_dim)];
+            for (int c = 0; c < 3; ++c)
+            {
+                jac[c][axis] = next[c] - prev[c];
+                value[c] += frac[axis] * jac[c][axis];
+            }
+            prev = next;
+        }
+
+        const float res[3] = { value[0] - target[0], value[1] - target[1], value[2] - target[2] };
+        if (std::max(std::fabs(res[0]), std::max(std::fabs(res[1]), std::fabs(res[2]))) < 1e-6f)
+        {
+            return true;
+        }
+
+        // Solve jac * delta = res using the Cramer's rule.
+        const float det = Determinant(jac);
+        if (std::fabs(det) < 1e-12f)
+        {
+            return false;
+        }
+
+        float delta[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            float mat[3][3];
+            std::memcpy(mat, jac, sizeof(mat));
+            mat[0][c] = res[0];
+            mat[1][c] = res[1];
+            mat[2][c] = res[2];
+
+            delta[c] = Determinant(mat) / det;
+        }
+
+        // The function is only linear in the cube so the step stops slightly after the face
+        // it crosses, otherwise the iterations could oscillate around the slope changes (e.g.
+        // at the boundary of the extrapolation).
+        constexpr float margin = 1e-3f;
+        float step = 1.f;
+        for (int c = 0; c < 3; ++c)
+        {
+            const float next = inverse[c] - delta[c];
+            if (next < (float)base[c] - margin)
+            {
+                step = std::min(step, (inverse[c] - (float)base[c] + margin) / delta[c]);
+            }
+            else if (next > (float)base[c] + 1.f + margin)
+            {
+                step = std::min(step, (inverse[c] - (float)base[c] - 1.f - margin) / delta[c]);
+            }
+        }
+
+        inverse[0] -= step * delta[0];
+        inverse[1] -= step * delta[1];
+        inverse[2] -= step * delta[2];
+
+        // The residual could stay above the tolerance where the LUT slopes are large (e.g. in
+        // the extrapolation) as the precision of the indices is limited.
+        if (std::max(std::fabs(delta[0]), std::max(std::fabs(delta[1]), std::fabs(delta[2])))
+                < 1e-4f)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void InvLut3DRefineRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    // Unextrapolated max, see InvLut3DRenderer::apply().
+    const float maxDim = (float)(m_dim - 3);
+
+    // The initial values are written in the output buffer, so the input pixels are copied
+    // first as both buffers could be the same.
+    constexpr long BlockSize = 256;
+    float targets[BlockSize * 4];
+
+    // Pixels to search in the tree.
+    float missed[BlockSize * 4];
+    long  missedIdx[BlockSize];
+
+    for (long start = 0; start < numPixels; start += BlockSize)
+    {
+        const long count = std::min(BlockSize, numPixels - start);
+        std::memcpy(targets, in, count * 4 * sizeof(float));
+
+        m_fastRenderer->apply(targets, out, count);
+
+        long numMissed = 0;
+        for (long i = 0; i < count; ++i)
+        {
+            // Same domain as the InvLut3DRenderer.
+            const float target[3] = { Clamp(targets[4 * i + 0], 0.f, 1.f),
+                                      Clamp(targets[4 * i + 1], 0.f, 1.f),
+                                      Clamp(targets[4 * i + 2], 0.f, 1.f) };
+
+            // Need to add 1 since the indices include the extrapolation.
+            float inverse[3] = { out[4 * i + 0] * maxDim + 1.f,
+                                 out[4 * i + 1] * maxDim + 1.f,
+                                 out[4 * i + 2] * maxDim + 1.f };
+
+            if (refine(target, inverse))
+            {
+                out[4 * i + 0] = Clamp(inverse[0] - 1.f, 0.f, maxDim) * m_scale;
+                out[4 * i + 1] = Clamp(inverse[1] - 1.f, 0.f, maxDim) * m_scale;
+                out[4 * i + 2] = Clamp(inverse[2] - 1.f, 0.f, maxDim) * m_scale;
+            }
+            else
+            {
+                std::memcpy(&missed[4 * numMissed], &targets[4 * i], 4 * sizeof(float));
+                missedIdx[numMissed++] = i;
+            }
+        }
+
+        if (numMissed > 0)
+        {
+            InvLut3DRenderer::apply(missed, missed, numMissed);
+
+            for (long i = 0; i < numMissed; ++i)
+            {
+                std::memcpy(&out[4 * missedIdx[i]], &missed[4 * i], 4 * sizeof(float));
+            }
+        }
+
+        in  += 4 * count;
+        out += 4 * count;
+    }
+}
+
 } // anonymous namspace
 
-ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
+void ClearLut3DRendererCaches()
+{
+    g_invLut3DCache.clear();
+}
+
+CacheStats GetLut3DInverseCacheStats()
+{
+    return g_invLut3DCache.getStats();
+}
+
+void ResetLut3DRendererCacheStats()
+{
+    g_invLut3DCache.resetStats();
+}
+
+Lut3DLayout::Lut3DLayout(unsigned long dim)
+{
+#ifdef USE_SSE
+    // The bricks only pay off once the lattice is much larger than the L2 cache i.e. they are
+    // slower for a 65^3 LUT (4.4 MB) but faster for a 129^3 LUT (34 MB). The renderers without
+    // SSE keep the blue fastest layout.
+    m_shift = dim > 65 ? 2 : 0;
+#else
+    m_shift = 0;
+#endif
+    m_mask = (1 << m_shift) - 1;
+
+    const int brickDim     = 1 << m_shift;
+    const int brickEntries = brickDim * brickDim * brickDim;
+    const int numBricks    = ((int)dim + m_mask) >> m_shift;
+
+    m_entryStrides[0] = brickDim * brickDim;
+    m_entryStrides[1] = brickDim;
+    m_entryStrides[2] = 1;
+
+    m_brickStrides[0] = brickEntries * numBricks * numBricks;
+    m_brickStrides[1] = brickEntries * numBricks;
+    m_brickStrides[2] = brickEntries;
+
+    m_numEntries = (unsigned long)brickEntries * numBricks * numBricks * numBricks;
+}
+
+ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut, bool halfLattice, bool refineInverse)
 {
     if (lut->getDirection() == TRANSFORM_DIR_FORWARD)
     {
-        return GetForwardLut3DRenderer(lut);
+        return GetForwardLut3DRenderer(lut, halfLattice);
+    }
+    else if (refineInverse)
+    {
+        return std::make_shared<InvLut3DRefineRenderer>(lut);
     }
     else
     {
@@ -12,7 +12,49 @@
 namespace OCIO_NAMESPACE
 {
 
-ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
+// When halfLattice is true, the lattice of a forward LUT is stored as half values if the
+// renderer is able to decode them (i.e. AVX2 renderers only), see OPTIMIZATION_LUT_HALF_STORAGE.
+// When refineInverse is true, an inverse LUT is evaluated using its fast inverse refined by
+// Newton iterations instead of the exact search, see OPTIMIZATION_LUT_INV_REFINE.
+ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut,
+                                 bool halfLattice = false,
+                                 bool refineInverse = false);
+
+// The extrapolated lattice & search tree of the inverse LUTs are shared by all the renderers of
+// the same LUT i.e. same cache ID.
+void ClearLut3DRendererCaches();
+
+// Reset the counters of the inverse LUT cache, see GetLut3DInverseCacheStats().
+void ResetLut3DRendererCacheStats();
+
+// Layout of the lattice entries in the LUT buffers of the CPU renderers. Large lattices are
+// split into bricks of 4x4x4 entries so the 8 corners of most cells are in one 1 KB block
+// instead of being spread over the complete lattice, where the entries of a brick and the
+// bricks are both stored with the blue index changing fastest. The bricks at the upper ends
+// could be partially used. A null shift means the blue fastest order of the Lut3DOpData
+// array (i.e. bricks of a single entry).
+struct Lut3DLayout
+{
+    explicit Lut3DLayout(unsigned long dim);
+
+    // Offset (in number of entries) of the lattice entry.
+    int getOffset(int idxR, int idxG, int idxB) const
+    {
+        return getAxisOffset(0, idxR) + getAxisOffset(1, idxG) + getAxisOffset(2, idxB);
+    }
+
+    int getAxisOffset(int channel, int idx) const
+    {
+        return (idx >> m_shift) * m_brickStrides[channel]
+               + (idx & m_mask) * m_entryStrides[channel];
+    }
+
+    int           m_shift = 0;
+    int           m_mask  = 0;
+    int           m_brickStrides[3];
+    int           m_entryStrides[3];
+    unsigned long m_numEntries = 0; // Including the unused entries of the partial bricks.
+};
 
 } // namespace OCIO_NAMESPACE
 
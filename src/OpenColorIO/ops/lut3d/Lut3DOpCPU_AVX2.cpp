@@ -0,0 +1,384 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/lut3d/Lut3DOpCPU_AVX2.h"
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Lattice position of eight pixels.
+struct LatticePos
+{
+    __m256  m_delta[3];  // Fractional position in the cell of each channel.
+    __m256i m_base;      // Offset (in values) of the lowest corner of the cell.
+    __m256i m_corner[3]; // Offset from the lowest to the highest corner along each channel.
+};
+
+// Per LUT constants where T is the type of the LUT values i.e. float or the 16-bit
+// representation of half values.
+template<typename T>
+struct LutParams
+{
+    LutParams(const T * optLut, const Lut3DLayout & layout, unsigned long dim)
+        :   m_optLut(optLut)
+        ,   m_step(_mm256_set1_ps((float)dim - 1.0f))
+        ,   m_maxIdx(_mm256_set1_ps((float)(dim - 1)))
+        ,   m_shift(_mm_cvtsi32_si128(layout.m_shift))
+        ,   m_mask(_mm256_set1_epi32(layout.m_mask))
+    {
+        // Offsets are in values i.e. four per RGB0 entry.
+        for (int c = 0; c < 3; ++c)
+        {
+            m_brickStrides[c] = _mm256_set1_epi32(4 * layout.m_brickStrides[c]);
+            m_entryStrides[c] = _mm256_set1_epi32(4 * layout.m_entryStrides[c]);
+        }
+    }
+
+    const T *     m_optLut;
+    __m256        m_step;
+    __m256        m_maxIdx;
+    __m128i       m_shift;
+    __m256i       m_mask;
+    // For the blue fastest layout, the brick strides are the strides between two consecutive
+    // red, green and blue entries.
+    __m256i       m_brickStrides[3];
+    __m256i       m_entryStrides[3];
+};
+
+// Load eight RGBA pixels and transpose them i.e. the lanes of the red, green, blue & alpha
+// registers hold the pixels { 0, 2, 4, 6, 1, 3, 5, 7 }.
+inline void LoadPixels(const float * in, __m256 (&rgba)[4])
+{
+    const __m256 p01 = _mm256_loadu_ps(in);
+    const __m256 p23 = _mm256_loadu_ps(in + 8);
+    const __m256 p45 = _mm256_loadu_ps(in + 16);
+    const __m256 p67 = _mm256_loadu_ps(in + 24);
+
+    const __m256 t0 = _mm256_unpacklo_ps(p01, p23);
+    const __m256 t1 = _mm256_unpackhi_ps(p01, p23);
+    const __m256 t2 = _mm256_unpacklo_ps(p45, p67);
+    const __m256 t3 = _mm256_unpackhi_ps(p45, p67);
+
+    rgba[0] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    rgba[1] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    rgba[2] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    rgba[3] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// Offset (in values) of the index along the channel c, see Lut3DLayout::getAxisOffset().
+template<typename T>
+inline __m256i AxisOffset(const LutParams<T> & params, int c, const __m256i & idx)
+{
+    return _mm256_add_epi32(
+        _mm256_mullo_epi32(_mm256_srl_epi32(idx, params.m_shift), params.m_brickStrides[c]),
+        _mm256_mullo_epi32(_mm256_and_si256(idx, params.m_mask), params.m_entryStrides[c]));
+}
+
+template<bool bricked, typename T>
+inline LatticePos ComputeLatticePos(const LutParams<T> & params, const __m256 (&rgba)[4])
+{
+    LatticePos pos;
+    pos.m_base = _mm256_setzero_si256();
+
+    for (int c = 0; c < 3; ++c)
+    {
+        // NaNs become 0.
+        const __m256 idx = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(rgba[c], params.m_step),
+                                                       _mm256_setzero_ps()),
+                                         params.m_maxIdx);
+
+        const __m256i lowIdx = _mm256_cvttps_epi32(idx);
+        const __m256 lowIdxF = _mm256_cvtepi32_ps(lowIdx);
+
+        pos.m_delta[c] = _mm256_sub_ps(idx, lowIdxF);
+
+        // The offset to the high corner is zero at the last index (where delta is zero).
+        const __m256i hasHigh
+            = _mm256_castps_si256(_mm256_cmp_ps(lowIdxF, params.m_maxIdx, _CMP_LT_OQ));
+
+        if (bricked)
+        {
+            // The high index is lowIdx + 1 i.e. minus the all ones mask.
+            const __m256i lowOffset  = AxisOffset(params, c, lowIdx);
+            const __m256i highOffset = AxisOffset(params, c, _mm256_sub_epi32(lowIdx, hasHigh));
+
+            pos.m_base = _mm256_add_epi32(pos.m_base, lowOffset);
+            pos.m_corner[c] = _mm256_sub_epi32(highOffset, lowOffset);
+        }
+        else
+        {
+            pos.m_base = _mm256_add_epi32(pos.m_base,
+                                          _mm256_mullo_epi32(lowIdx, params.m_brickStrides[c]));
+            pos.m_corner[c] = _mm256_and_si256(hasHigh, params.m_brickStrides[c]);
+        }
+    }
+
+    return pos;
+}
+
+// Load the RGB0 LUT entries of two pixels in the two halves of an AVX register.
+inline __m256 LoadEntries(const float * optLut, int offset0, int offset1)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(optLut + offset0)),
+                                _mm_load_ps(optLut + offset1), 1);
+}
+
+inline __m256 LoadEntries(const uint16_t * optLut, int offset0, int offset1)
+{
+    const __m128i entry0 = _mm_loadl_epi64((const __m128i *)(optLut + offset0));
+    const __m128i entry1 = _mm_loadl_epi64((const __m128i *)(optLut + offset1));
+    return _mm256_cvtph_ps(_mm_unpacklo_epi64(entry0, entry1));
+}
+
+// Broadcast the weights of two pixels in the two halves of an AVX register.
+inline __m256 LoadWeights(const float * weights, int idx0, int idx1)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(weights[idx0])),
+                                _mm_set1_ps(weights[idx1]), 1);
+}
+
+// Linear interpolation i.e. low + w * (high - low).
+inline __m256 Lerp(const __m256 & low, const __m256 & high, const __m256 & w)
+{
+    return _mm256_fmadd_ps(w, _mm256_sub_ps(high, low), low);
+}
+
+// Process eight pixels using a tetrahedral interpolation. The in and out buffers could be the
+// same buffer.
+template<bool bricked, typename T>
+inline void ApplyTetrahedral8(const LutParams<T> & params, const float * in, float * out)
+{
+    __m256 rgba[4];
+    LoadPixels(in, rgba);
+
+    const LatticePos pos = ComputeLatticePos<bricked>(params, rgba);
+    const __m256 (&delta)[3] = pos.m_delta;
+
+    // In tetrahedral interpolation, the cube is divided along the main diagonal into 6
+    // tetrahedra. The vertices are the lowest corner, the corner along the axis of the largest
+    // delta, the corner across the axes of the two largest deltas and the highest corner.
+    // Ties are broken in the R, G, B order for the largest delta and in the B, G, R order for
+    // the smallest one, so that both axes are always different.
+    const __m256 rIsMax = _mm256_and_ps(_mm256_cmp_ps(delta[0], delta[1], _CMP_GE_OQ),
+                                        _mm256_cmp_ps(delta[0], delta[2], _CMP_GE_OQ));
+    const __m256 gIsMax = _mm256_cmp_ps(delta[1], delta[2], _CMP_GE_OQ);
+
+    const __m256 bIsMin = _mm256_and_ps(_mm256_cmp_ps(delta[2], delta[1], _CMP_LE_OQ),
+                                        _mm256_cmp_ps(delta[2], delta[0], _CMP_LE_OQ));
+    const __m256 gIsMin = _mm256_cmp_ps(delta[1], delta[0], _CMP_LE_OQ);
+
+    const __m256i maxCorner
+        = _mm256_castps_si256(
+            avx2Select(rIsMax, _mm256_castsi256_ps(pos.m_corner[0]),
+                       avx2Select(gIsMax, _mm256_castsi256_ps(pos.m_corner[1]),
+                                          _mm256_castsi256_ps(pos.m_corner[2]))));
+
+    const __m256i minCorner
+        = _mm256_castps_si256(
+            avx2Select(bIsMin, _mm256_castsi256_ps(pos.m_corner[2]),
+                       avx2Select(gIsMin, _mm256_castsi256_ps(pos.m_corner[1]),
+                                          _mm256_castsi256_ps(pos.m_corner[0]))));
+
+    const __m256i offset3
+        = _mm256_add_epi32(pos.m_base,
+                           _mm256_add_epi32(pos.m_corner[0],
+                                            _mm256_add_epi32(pos.m_corner[1], pos.m_corner[2])));
+
+    alignas(32) int offsets[4][8];
+    _mm256_store_si256((__m256i *)offsets[0], pos.m_base);
+    _mm256_store_si256((__m256i *)offsets[1], _mm256_add_epi32(pos.m_base, maxCorner));
+    _mm256_store_si256((__m256i *)offsets[2], _mm256_sub_epi32(offset3, minCorner));
+    _mm256_store_si256((__m256i *)offsets[3], offset3);
+
+    const __m256 deltaMax = _mm256_max_ps(delta[0], _mm256_max_ps(delta[1], delta[2]));
+    const __m256 deltaMin = _mm256_min_ps(delta[0], _mm256_min_ps(delta[1], delta[2]));
+    const __m256 deltaMid = _mm256_max_ps(_mm256_min_ps(delta[0], delta[1]),
+                                          _mm256_min_ps(_mm256_max_ps(delta[0], delta[1]),
+                                                        delta[2]));
+
+    alignas(32) float weights[3][8];
+    _mm256_store_ps(weights[0], deltaMax);
+    _mm256_store_ps(weights[1], deltaMid);
+    _mm256_store_ps(weights[2], deltaMin);
+
+    // Interpolate two pixels at a time i.e. the pixels 2*pair and 2*pair+1 which are in the
+    // lanes pair and pair+4.
+    for (int pair = 0; pair < 4; ++pair)
+    {
+        const int l0 = pair;
+        const int l1 = pair + 4;
+
+        const __m256 v0 = LoadEntries(params.m_optLut, offsets[0][l0], offsets[0][l1]);
+        const __m256 v1 = LoadEntries(params.m_optLut, offsets[1][l0], offsets[1][l1]);
+        const __m256 v2 = LoadEntries(params.m_optLut, offsets[2][l0], offsets[2][l1]);
+        const __m256 v3 = LoadEntries(params.m_optLut, offsets[3][l0], offsets[3][l1]);
+
+        __m256 result = _mm256_fmadd_ps(LoadWeights(weights[0], l0, l1),
+                                        _mm256_sub_ps(v1, v0), v0);
+        result = _mm256_fmadd_ps(LoadWeights(weights[1], l0, l1),
+                                 _mm256_sub_ps(v2, v1), result);
+        result = _mm256_fmadd_ps(LoadWeights(weights[2], l0, l1),
+                                 _mm256_sub_ps(v3, v2), result);
+
+        _mm256_storeu_ps(out + 8 * pair,
+                         avx2KeepAlpha(result, _mm256_loadu_ps(in + 8 * pair)));
+    }
+}
+
+// Process eight pixels using a trilinear interpolation. The in and out buffers could be the
+// same buffer.
+template<bool bricked, typename T>
+inline void ApplyTrilinear8(const LutParams<T> & params, const float * in, float * out)
+{
+    __m256 rgba[4];
+    LoadPixels(in, rgba);
+
+    const LatticePos pos = ComputeLatticePos<bricked>(params, rgba);
+
+    // The offsets of the 8 corners of the cells where the index bits 2, 1 & 0 mean the high
+    // red, green & blue corners.
+    const __m256i cornerGB = _mm256_add_epi32(pos.m_corner[1], pos.m_corner[2]);
+    const __m256i baseR    = _mm256_add_epi32(pos.m_base, pos.m_corner[0]);
+
+    alignas(32) int offsets[8][8];
+    _mm256_store_si256((__m256i *)offsets[0], pos.m_base);
+    _mm256_store_si256((__m256i *)offsets[1], _mm256_add_epi32(pos.m_base, pos.m_corner[2]));
+    _mm256_store_si256((__m256i *)offsets[2], _mm256_add_epi32(pos.m_base, pos.m_corner[1]));
+    _mm256_store_si256((__m256i *)offsets[3], _mm256_add_epi32(pos.m_base, cornerGB));
+    _mm256_store_si256((__m256i *)offsets[4], baseR);
+    _mm256_store_si256((__m256i *)offsets[5], _mm256_add_epi32(baseR, pos.m_corner[2]));
+    _mm256_store_si256((__m256i *)offsets[6], _mm256_add_epi32(baseR, pos.m_corner[1]));
+    _mm256_store_si256((__m256i *)offsets[7], _mm256_add_epi32(baseR, cornerGB));
+
+    alignas(32) float weights[3][8];
+    _mm256_store_ps(weights[0], pos.m_delta[0]);
+    _mm256_store_ps(weights[1], pos.m_delta[1]);
+    _mm256_store_ps(weights[2], pos.m_delta[2]);
+
+    // Interpolate two pixels at a time (see ApplyTetrahedral8()) along the blue, then green
+    // and finally red axis like the SSE renderer.
+    for (int pair = 0; pair < 4; ++pair)
+    {
+        const int l0 = pair;
+        const int l1 = pair + 4;
+
+        __m256 v[8];
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            v[corner] = LoadEntries(params.m_optLut, offsets[corner][l0], offsets[corner][l1]);
+        }
+
+        const __m256 wr = LoadWeights(weights[0], l0, l1);
+        const __m256 wg = LoadWeights(weights[1], l0, l1);
+        const __m256 wb = LoadWeights(weights[2], l0, l1);
+
+        const __m256 green0 = Lerp(Lerp(v[0], v[1], wb), Lerp(v[2], v[3], wb), wg);
+        const __m256 green1 = Lerp(Lerp(v[4], v[5], wb), Lerp(v[6], v[7], wb), wg);
+
+        _mm256_storeu_ps(out + 8 * pair,
+                         avx2KeepAlpha(Lerp(green0, green1, wr), _mm256_loadu_ps(in + 8 * pair)));
+    }
+}
+
+// Process the pixels eight at a time, the remaining ones using a padded buffer.
+template<typename T, typename Apply8>
+inline void ApplyLut3D(const LutParams<T> & params, const float * in, float * out, long numPixels,
+                       const Apply8 & apply8)
+{
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        apply8(params, in, out);
+
+        in  += 32;
+        out += 32;
+    }
+
+    if (idx < numPixels)
+    {
+        const long remaining = 4 * (numPixels - idx);
+
+        float buffer[32];
+        for (long i = 0; i < 32; ++i)
+        {
+            buffer[i] = i < remaining ? in[i] : 0.0f;
+        }
+
+        apply8(params, buffer, buffer);
+
+        for (long i = 0; i < remaining; ++i)
+        {
+            out[i] = buffer[i];
+        }
+    }
+}
+
+template<typename T>
+void ApplyTetrahedral(const T * optLut, const Lut3DLayout & layout, unsigned long dim,
+                      const float * in, float * out, long numPixels)
+{
+    const LutParams<T> params(optLut, layout, dim);
+    if (layout.m_shift != 0)
+    {
+        ApplyLut3D(params, in, out, numPixels, ApplyTetrahedral8<true, T>);
+    }
+    else
+    {
+        ApplyLut3D(params, in, out, numPixels, ApplyTetrahedral8<false, T>);
+    }
+}
+
+template<typename T>
+void ApplyTrilinear(const T * optLut, const Lut3DLayout & layout, unsigned long dim,
+                    const float * in, float * out, long numPixels)
+{
+    const LutParams<T> params(optLut, layout, dim);
+    if (layout.m_shift != 0)
+    {
+        ApplyLut3D(params, in, out, numPixels, ApplyTrilinear8<true, T>);
+    }
+    else
+    {
+        ApplyLut3D(params, in, out, numPixels, ApplyTrilinear8<false, T>);
+    }
+}
+
+} // anon
+
+void ApplyLut3DTetrahedral_AVX2(const float * optLut, const Lut3DLayout & layout,
+                                unsigned long dim, const float * in, float * out, long numPixels)
+{
+    ApplyTetrahedral(optLut, layout, dim, in, out, numPixels);
+}
+
+void ApplyLut3DTrilinear_AVX2(const float * optLut, const Lut3DLayout & layout,
+                              unsigned long dim, const float * in, float * out, long numPixels)
+{
+    ApplyTrilinear(optLut, layout, dim, in, out, numPixels);
+}
+
+void ApplyLut3DTetrahedral_AVX2(const uint16_t * optLut, const Lut3DLayout & layout,
+                                unsigned long dim, const float * in, float * out, long numPixels)
+{
+    ApplyTetrahedral(optLut, layout, dim, in, out, numPixels);
+}
+
+void ApplyLut3DTrilinear_AVX2(const uint16_t * optLut, const Lut3DLayout & layout,
+                              unsigned long dim, const float * in, float * out, long numPixels)
+{
+    ApplyTrilinear(optLut, layout, dim, in, out, numPixels);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
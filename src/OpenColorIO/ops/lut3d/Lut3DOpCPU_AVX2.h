@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_LUT3DOP_CPU_AVX2_H
+#define INCLUDED_OCIO_LUT3DOP_CPU_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <cstdint>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/lut3d/Lut3DOpCPU.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the 3D LUT with a tetrahedral interpolation to packed RGBA float pixels, eight pixels
+// at a time. The optLut holds the 16-byte aligned RGB0 entries of the dim^3 lattice stored
+// using the layout (see BaseLut3DRenderer::createOptLut()). The alpha channel is left
+// unchanged. Only call it if CPUInfo::hasAVX2() is true.
+void ApplyLut3DTetrahedral_AVX2(const float * optLut, const Lut3DLayout & layout,
+                                unsigned long dim, const float * in, float * out, long numPixels);
+
+// Same as ApplyLut3DTetrahedral_AVX2() but with a trilinear interpolation.
+void ApplyLut3DTrilinear_AVX2(const float * optLut, const Lut3DLayout & layout,
+                              unsigned long dim, const float * in, float * out, long numPixels);
+
+// Same as above but the optLut holds the 16-bit representation of half values (i.e. RGB0
+// entries of 8 bytes), which are decoded using F16C instructions.
+void ApplyLut3DTetrahedral_AVX2(const uint16_t * optLut, const Lut3DLayout & layout,
+                                unsigned long dim, const float * in, float * out, long numPixels);
+
+void ApplyLut3DTrilinear_AVX2(const uint16_t * optLut, const Lut3DLayout & layout,
+                              unsigned long dim, const float * in, float * out, long numPixels);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
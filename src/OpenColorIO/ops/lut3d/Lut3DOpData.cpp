@@ -6,9 +6,10 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "Caching.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
-#include "md5/md5.h"
+#include "Mutex.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/lut3d/Lut3DOpData.h"
 #include "ops/OpTools.h"
@@ -62,6 +63,69 @@ Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut)
 // 129 allows for a MESH dimension of 7 in the 3dl file format.
 const unsigned long Lut3DOpData::maxSupportedLength = 129;
 
+namespace
+{
+
+struct ComposeCacheEntry
+{
+    Mutex m_mutex;
+    OCIO_SHARED_PTR<const Array::Values> m_values;
+};
+
+typedef OCIO_SHARED_PTR<ComposeCacheEntry> ComposeCacheEntryRcPtr;
+
+// An entry holds the values of a composed LUT (i.e. 1.3 MB for the 48^3 fast inverse LUTs) and
+// only the recently used compositions are worth keeping, hence the cache is bounded.
+constexpr size_t ComposeCacheMaxEntries = 16;
+
+// The key is made of the cache IDs of the two LUTs.
+class ComposeCache : public GenericCache<std::string, ComposeCacheEntryRcPtr>
+{
+public:
+    ComposeCache()
+    {
+        setCapacity(ComposeCacheMaxEntries, 0);
+    }
+};
+
+ComposeCache g_composeCache;
+
+ComposeCacheEntryRcPtr GetComposeCacheEntry(ConstLut3DOpDataRcPtr lut1, ConstLut3DOpDataRcPtr lut2)
+{
+    if (g_composeCache.isEnabled())
+    {
+        const std::string key = lut1->getCacheID() + "x " + lut2->getCacheID();
+
+        AutoMutex guard(g_composeCache.lock());
+
+        ComposeCacheEntryRcPtr & entry = g_composeCache[key];
+        if (!entry)
+        {
+            entry = std::make_shared<ComposeCacheEntry>();
+        }
+        return entry;
+    }
+
+    return std::make_shared<ComposeCacheEntry>();
+}
+
+} // anon.
+
+void ClearLut3DComposeCache()
+{
+    g_composeCache.clear();
+}
+
+CacheStats GetLut3DComposeCacheStats()
+{
+    return g_composeCache.getStats();
+}
+
+void ResetLut3DComposeCacheStats()
+{
+    g_composeCache.resetStats();
+}
+
 // Functional composition is a concept from mathematics where two functions
 // are combined into a single function.  This idea may be applied to ops
 // where we generate a single op that has the same (or similar) effect as
@@ -137,14 +201,37 @@ Lut3DOpDataRcPtr Lut3DOpData::Compose(ConstLut3DOpDataRcPtr & lutc1,
 
     result->setFileOutputBitDepth(fileOutBD);
 
-    const Array::Values & domain = result->getArray().getValues();
+    Array::Values & domain = result->getArray().getValues();
     const long gridSize = result->getArray().getLength();
     const long numPixels = gridSize * gridSize * gridSize;
 
-    EvalTransform((const float*)(&domain[0]),
-                  (float*)(&domain[0]),
-                  numPixels,
-                  ops);
+    // The composed values only depend on the LUTs, so they are computed once for all the
+    // compositions of the same LUTs. Only the compositions with an inverse LUT (e.g. to make a
+    // fast inverse) are cached as the exact inverse searches a tree for each grid point, whereas
+    // evaluating forward LUTs is a cheap interpolation not worth the memory of a cache entry.
+    const bool useCache = lut1->getDirection() == TRANSFORM_DIR_INVERSE
+                          || lut2->getDirection() == TRANSFORM_DIR_INVERSE;
+
+    ComposeCacheEntryRcPtr entry = useCache ? GetComposeCacheEntry(lut1, lut2)
+                                            : std::make_shared<ComposeCacheEntry>();
+
+    AutoMutex lock(entry->m_mutex);
+    if (entry->m_values)
+    {
+        domain = *entry->m_values;
+    }
+    else
+    {
+        EvalTransform((const float*)(&domain[0]),
+                      (float*)(&domain[0]),
+                      numPixels,
+                      ops);
+
+        if (useCache)
+        {
+            entry->m_values = std::make_shared<const Array::Values>(domain);
+        }
+    }
 
     if (restoreInverse)
     {
@@ -472,16 +559,20 @@ std::string Lut3DOpData::getCacheID() const
 {
     AutoMutex lock(m_mutex);
 
-    const Lut3DArray::Values & values = getArray().getValues();
-
     std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
         cacheIDStream << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]),
-                                 int(values.size() * sizeof(values[0])))
+    // Hashing the values is by far the most expensive part so the hash is memoized, and shared
+    // by all the processors using this LUT (e.g. the ones created from a cached LUT file).
+    cacheIDStream << m_arrayHash.get([this]()
+                     {
+                         const Lut3DArray::Values & values = getArray().getValues();
+                         return CacheIDHash(reinterpret_cast<const char*>(&values[0]),
+                                            int(values.size() * sizeof(values[0])));
+                     })
                   << " ";
 
     cacheIDStream << InterpolationToString(m_interpolation)  << " ";
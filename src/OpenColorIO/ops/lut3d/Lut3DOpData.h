@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "HashUtils.h"
 #include "Op.h"
 #include "ops/OpArray.h"
 #include "PrivateTypes.h"
@@ -55,7 +56,8 @@ public:
 
     // Note: The Lut3DOpData Array stores the values in blue-fastest order.
     inline const Array & getArray() const { return m_array; }
-    inline Array & getArray() { return m_array; }
+    // Note: The values could then change so the memoized hash of the array is invalidated.
+    inline Array & getArray() { m_arrayHash.invalidate(); return m_array; }
 
     void setArrayFromRedFastestOrder(const std::vector<float> & lut);
 
@@ -129,6 +131,7 @@ private:
 
     Interpolation       m_interpolation;
     Lut3DArray          m_array;
+    MemoizedHash        m_arrayHash; // Hash of the array values used by getCacheID().
 
     TransformDirection  m_direction;
 
@@ -142,6 +145,13 @@ private:
 // LUT has to be inverse or the function will throw.
 Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut);
 
+// The values computed by Lut3DOpData::Compose() (hence MakeFastLut3DFromInverse()) are cached
+// using the cache IDs of the LUTs.
+void ClearLut3DComposeCache();
+
+// Reset the counters of the composed LUT cache, see GetLut3DComposeCacheStats().
+void ResetLut3DComposeCacheStats();
+
 } // namespace OCIO_NAMESPACE
 
 #endif
@@ -60,7 +60,7 @@ public:
     void finalize() override;
     std::string getCacheID() const override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -181,7 +181,7 @@ std::string MatrixOffsetOp::getCacheID() const
     return cacheIDStream.str();
 }
 
-ConstOpCPURcPtr MatrixOffsetOp::getCPUOp(bool /*fastLogExpPow*/) const
+ConstOpCPURcPtr MatrixOffsetOp::getCPUOp(LogExpPowPrecision /*precision*/) const
 {
     ConstMatrixOpDataRcPtr data = matrixData();
     return GetMatrixRenderer(data);
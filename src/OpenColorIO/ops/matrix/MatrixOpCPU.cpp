@@ -4,8 +4,11 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "MathUtils.h"
 #include "ops/matrix/MatrixOpCPU.h"
+#include "ops/matrix/MatrixOpCPU_AVX2.h"
+#include "ops/range/RangeOpCPU.h"
 #include "Platform.h"
 #include "SSE.h"
 
@@ -22,6 +25,8 @@ public:
     explicit ScaleRenderer(ConstMatrixOpDataRcPtr & mat);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * in, float * const * out,
+                     long numPixels) const override;
 
 private:
     float m_scale[4];
@@ -35,8 +40,10 @@ public:
     explicit ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * in, float * const * out,
+                     long numPixels) const override;
 
-private:
+protected:
     float m_scale[4];
     float m_offset[4];
 };
@@ -49,9 +56,10 @@ public:
     explicit MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * in, float * const * out,
+                     long numPixels) const override;
 
-private:
-
+protected:
     float m_column1[4];
     float m_column2[4];
     float m_column3[4];
@@ -68,14 +76,84 @@ public:
     MatrixRenderer(ConstMatrixOpDataRcPtr & mat);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * in, float * const * out,
+                     long numPixels) const override;
 
-private:
+protected:
     float m_column1[4];
     float m_column2[4];
     float m_column3[4];
     float m_column4[4];
 };
 
+// The following renderers apply the matrix and then a Range op (i.e. the R, G & B values are
+// clamped and possibly scaled) in the same pass over the pixels. The results are identical to
+// the ones of the two separate renderers. A matrix without offsets uses zero offsets.
+
+template<RangeClamp::Style STYLE>
+class ScaleRangeRenderer : public ScaleWithOffsetRenderer
+{
+public:
+    ScaleRangeRenderer(ConstMatrixOpDataRcPtr & mat, ConstRangeOpDataRcPtr & range);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * in, float * const * out,
+                     long numPixels) const override;
+
+protected:
+    const RangeClamp m_clamp;
+};
+
+template<RangeClamp::Style STYLE>
+class MatrixRangeRenderer : public MatrixWithOffsetRenderer
+{
+public:
+    MatrixRangeRenderer(ConstMatrixOpDataRcPtr & mat, ConstRangeOpDataRcPtr & range);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * in, float * const * out,
+                     long numPixels) const override;
+
+protected:
+    const RangeClamp m_clamp;
+};
+
+#ifdef USE_AVX2
+class MatrixWithOffsetRendererAVX2 : public MatrixWithOffsetRenderer
+{
+public:
+    explicit MatrixWithOffsetRendererAVX2(ConstMatrixOpDataRcPtr & mat)
+        : MatrixWithOffsetRenderer(mat)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+
+class MatrixRendererAVX2 : public MatrixRenderer
+{
+public:
+    explicit MatrixRendererAVX2(ConstMatrixOpDataRcPtr & mat)
+        : MatrixRenderer(mat)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+
+template<RangeClamp::Style STYLE>
+class MatrixRangeRendererAVX2 : public MatrixRangeRenderer<STYLE>
+{
+public:
+    MatrixRangeRendererAVX2(ConstMatrixOpDataRcPtr & mat, ConstRangeOpDataRcPtr & range)
+        : MatrixRangeRenderer<STYLE>(mat, range)
+    {
+    }
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+};
+#endif
+
 ScaleRenderer::ScaleRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -104,6 +182,26 @@ void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     }
 }
 
+void ScaleRenderer::applyPlanar(const float * const * in, float * const * out,
+                                long numPixels) const
+{
+    for (int chan = 0; chan < 4; ++chan)
+    {
+        // The alpha plane could be missing.
+        if (out[chan])
+        {
+            const float * src = in[chan];
+            float * dst = out[chan];
+            const float scale = m_scale[chan];
+
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                dst[idx] = src[idx] * scale;
+            }
+        }
+    }
+}
+
 ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -139,6 +237,27 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void ScaleWithOffsetRenderer::applyPlanar(const float * const * in, float * const * out,
+                                          long numPixels) const
+{
+    for (int chan = 0; chan < 4; ++chan)
+    {
+        // The alpha plane could be missing.
+        if (out[chan])
+        {
+            const float * src = in[chan];
+            float * dst = out[chan];
+            const float scale  = m_scale[chan];
+            const float offset = m_offset[chan];
+
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                dst[idx] = src[idx] * scale + offset;
+            }
+        }
+    }
+}
+
 MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -287,6 +406,105 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
+// Apply the matrix to planar pixels, with the same order of operations than the packed
+// renderers i.e. (r*m0 + g*m1) + (b*m2 + a*m3) + offset. The in & out planes could be
+// the same planes.
+template<bool hasAlpha, bool hasOffset>
+void ApplyPlanarMatrix(const float * const * in, float * const * out, long numPixels,
+                       const float (&m0)[4], const float (&m1)[4],
+                       const float (&m2)[4], const float (&m3)[4], const float (&o)[4])
+{
+    const float * rIn = in[0];
+    const float * gIn = in[1];
+    const float * bIn = in[2];
+    const float * aIn = in[3];
+
+    float * rOut = out[0];
+    float * gOut = out[1];
+    float * bOut = out[2];
+    float * aOut = out[3];
+
+    long idx = 0;
+
+#ifdef USE_SSE
+    // Four pixels at a time.
+
+    float * outPlanes[4] = { rOut, gOut, bOut, aOut };
+    const int numChannels = hasAlpha ? 4 : 3;
+
+    __m128 mr[4], mg[4], mb[4], ma[4], mo[4];
+    for (int chan = 0; chan < 4; ++chan)
+    {
+        mr[chan] = _mm_set1_ps(m0[chan]);
+        mg[chan] = _mm_set1_ps(m1[chan]);
+        mb[chan] = _mm_set1_ps(m2[chan]);
+        ma[chan] = _mm_set1_ps(m3[chan]);
+        mo[chan] = _mm_set1_ps(o[chan]);
+    }
+
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        const __m128 r = _mm_loadu_ps(rIn + idx);
+        const __m128 g = _mm_loadu_ps(gIn + idx);
+        const __m128 b = _mm_loadu_ps(bIn + idx);
+        const __m128 a = hasAlpha ? _mm_loadu_ps(aIn + idx) : _mm_setzero_ps();
+
+        for (int chan = 0; chan < numChannels; ++chan)
+        {
+            __m128 res = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, mr[chan]), _mm_mul_ps(g, mg[chan])),
+                                    _mm_add_ps(_mm_mul_ps(b, mb[chan]), _mm_mul_ps(a, ma[chan])));
+            if (hasOffset)
+            {
+                res = _mm_add_ps(res, mo[chan]);
+            }
+
+            _mm_storeu_ps(outPlanes[chan] + idx, res);
+        }
+    }
+#endif
+
+    for (; idx < numPixels; ++idx)
+    {
+        const float r = rIn[idx];
+        const float g = gIn[idx];
+        const float b = bIn[idx];
+        const float a = hasAlpha ? aIn[idx] : 0.0f;
+
+        float res[4];
+        for (int chan = 0; chan < 4; ++chan)
+        {
+            res[chan] = (r * m0[chan] + g * m1[chan]) + (b * m2[chan] + a * m3[chan]);
+            if (hasOffset)
+            {
+                res[chan] += o[chan];
+            }
+        }
+
+        rOut[idx] = res[0];
+        gOut[idx] = res[1];
+        bOut[idx] = res[2];
+        if (hasAlpha)
+        {
+            aOut[idx] = res[3];
+        }
+    }
+}
+
+void MatrixWithOffsetRenderer::applyPlanar(const float * const * in, float * const * out,
+                                           long numPixels) const
+{
+    if (in[3])
+    {
+        ApplyPlanarMatrix<true, true>(in, out, numPixels,
+                                      m_column1, m_column2, m_column3, m_column4, m_offset);
+    }
+    else
+    {
+        ApplyPlanarMatrix<false, true>(in, out, numPixels,
+                                       m_column1, m_column2, m_column3, m_column4, m_offset);
+    }
+}
+
 MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -395,6 +613,240 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
 #endif
 }
 
+void MatrixRenderer::applyPlanar(const float * const * in, float * const * out,
+                                 long numPixels) const
+{
+    static constexpr float zero[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    if (in[3])
+    {
+        ApplyPlanarMatrix<true, false>(in, out, numPixels,
+                                       m_column1, m_column2, m_column3, m_column4, zero);
+    }
+    else
+    {
+        ApplyPlanarMatrix<false, false>(in, out, numPixels,
+                                        m_column1, m_column2, m_column3, m_column4, zero);
+    }
+}
+
+// Apply the range to the R, G & B planes.
+template<RangeClamp::Style STYLE>
+void ApplyPlanarRange(float * const * planes, long numPixels, const RangeClamp & clamp)
+{
+#ifdef USE_SSE
+    const __m128 scale  = _mm_set1_ps(clamp.m_scale);
+    const __m128 offset = _mm_set1_ps(clamp.m_offset);
+    const __m128 lower  = _mm_set1_ps(clamp.m_lowerBound);
+    const __m128 upper  = _mm_set1_ps(clamp.m_upperBound);
+#endif
+
+    for (int chan = 0; chan < 3; ++chan)
+    {
+        float * plane = planes[chan];
+
+        long idx = 0;
+
+#ifdef USE_SSE
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            _mm_storeu_ps(plane + idx, sseApplyRangeClamp<STYLE>(_mm_loadu_ps(plane + idx),
+                                                                 scale, offset, lower, upper));
+        }
+#endif
+
+        for (; idx < numPixels; ++idx)
+        {
+            plane[idx] = ApplyRangeClamp<STYLE>(plane[idx], clamp);
+        }
+    }
+}
+
+template<RangeClamp::Style STYLE>
+ScaleRangeRenderer<STYLE>::ScaleRangeRenderer(ConstMatrixOpDataRcPtr & mat,
+                                              ConstRangeOpDataRcPtr & range)
+    : ScaleWithOffsetRenderer(mat)
+    , m_clamp(*range)
+{
+}
+
+template<RangeClamp::Style STYLE>
+void ScaleRangeRenderer<STYLE>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+#ifdef USE_SSE
+    const __m128 s = _mm_loadu_ps(m_scale);
+    const __m128 o = _mm_loadu_ps(m_offset);
+
+    const __m128 scale  = _mm_set1_ps(m_clamp.m_scale);
+    const __m128 offset = _mm_set1_ps(m_clamp.m_offset);
+    const __m128 lower  = _mm_set1_ps(m_clamp.m_lowerBound);
+    const __m128 upper  = _mm_set1_ps(m_clamp.m_upperBound);
+
+    // Only the alpha lane is set.
+    const __m128 alphaMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const __m128 img = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(in), s), o);
+        const __m128 res = sseApplyRangeClamp<STYLE>(img, scale, offset, lower, upper);
+
+        _mm_storeu_ps(out, _mm_or_ps(_mm_andnot_ps(alphaMask, res), _mm_and_ps(alphaMask, img)));
+
+        in  += 4;
+        out += 4;
+    }
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = ApplyRangeClamp<STYLE>(in[0] * m_scale[0] + m_offset[0], m_clamp);
+        out[1] = ApplyRangeClamp<STYLE>(in[1] * m_scale[1] + m_offset[1], m_clamp);
+        out[2] = ApplyRangeClamp<STYLE>(in[2] * m_scale[2] + m_offset[2], m_clamp);
+        out[3] = in[3] * m_scale[3] + m_offset[3];
+
+        in  += 4;
+        out += 4;
+    }
+#endif
+}
+
+template<RangeClamp::Style STYLE>
+void ScaleRangeRenderer<STYLE>::applyPlanar(const float * const * in, float * const * out,
+                                            long numPixels) const
+{
+    ScaleWithOffsetRenderer::applyPlanar(in, out, numPixels);
+    ApplyPlanarRange<STYLE>(out, numPixels, m_clamp);
+}
+
+template<RangeClamp::Style STYLE>
+MatrixRangeRenderer<STYLE>::MatrixRangeRenderer(ConstMatrixOpDataRcPtr & mat,
+                                                ConstRangeOpDataRcPtr & range)
+    : MatrixWithOffsetRenderer(mat)
+    , m_clamp(*range)
+{
+}
+
+template<RangeClamp::Style STYLE>
+void MatrixRangeRenderer<STYLE>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+#ifdef USE_SSE
+    const __m128 m0 = _mm_loadu_ps(m_column1);
+    const __m128 m1 = _mm_loadu_ps(m_column2);
+    const __m128 m2 = _mm_loadu_ps(m_column3);
+    const __m128 m3 = _mm_loadu_ps(m_column4);
+    const __m128 o  = _mm_loadu_ps(m_offset);
+
+    const __m128 scale  = _mm_set1_ps(m_clamp.m_scale);
+    const __m128 offset = _mm_set1_ps(m_clamp.m_offset);
+    const __m128 lower  = _mm_set1_ps(m_clamp.m_lowerBound);
+    const __m128 upper  = _mm_set1_ps(m_clamp.m_upperBound);
+
+    // Only the alpha lane is set.
+    const __m128 alphaMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const __m128 r = _mm_set1_ps(in[0]);
+        const __m128 g = _mm_set1_ps(in[1]);
+        const __m128 b = _mm_set1_ps(in[2]);
+        const __m128 a = _mm_set1_ps(in[3]);
+
+        // Same operation order as MatrixWithOffsetRenderer.
+        const __m128 rg = _mm_add_ps(_mm_mul_ps(m0, r), _mm_mul_ps(m1, g));
+        const __m128 ba = _mm_add_ps(_mm_mul_ps(m2, b), _mm_mul_ps(m3, a));
+        const __m128 img = _mm_add_ps(_mm_add_ps(rg, ba), o);
+
+        const __m128 res = sseApplyRangeClamp<STYLE>(img, scale, offset, lower, upper);
+
+        _mm_storeu_ps(out, _mm_or_ps(_mm_andnot_ps(alphaMask, res), _mm_and_ps(alphaMask, img)));
+
+        in  += 4;
+        out += 4;
+    }
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+        const float a = in[3];
+
+        float res[4];
+        for (int chan = 0; chan < 4; ++chan)
+        {
+            res[chan] = r * m_column1[chan]
+                      + g * m_column2[chan]
+                      + b * m_column3[chan]
+                      + a * m_column4[chan]
+                      + m_offset[chan];
+        }
+
+        out[0] = ApplyRangeClamp<STYLE>(res[0], m_clamp);
+        out[1] = ApplyRangeClamp<STYLE>(res[1], m_clamp);
+        out[2] = ApplyRangeClamp<STYLE>(res[2], m_clamp);
+        out[3] = res[3];
+
+        in  += 4;
+        out += 4;
+    }
+#endif
+}
+
+template<RangeClamp::Style STYLE>
+void MatrixRangeRenderer<STYLE>::applyPlanar(const float * const * in, float * const * out,
+                                             long numPixels) const
+{
+    MatrixWithOffsetRenderer::applyPlanar(in, out, numPixels);
+    ApplyPlanarRange<STYLE>(out, numPixels, m_clamp);
+}
+
+#ifdef USE_AVX2
+void MatrixWithOffsetRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyMatrix_AVX2((const float *)inImg, (float *)outImg, numPixels,
+                     m_column1, m_column2, m_column3, m_column4, m_offset);
+}
+
+void MatrixRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    static constexpr float zero[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    ApplyMatrix_AVX2((const float *)inImg, (float *)outImg, numPixels,
+                     m_column1, m_column2, m_column3, m_column4, zero);
+}
+
+template<RangeClamp::Style STYLE>
+void MatrixRangeRendererAVX2<STYLE>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    ApplyMatrixRange_AVX2((const float *)inImg, (float *)outImg, numPixels,
+                          this->m_column1, this->m_column2, this->m_column3, this->m_column4,
+                          this->m_offset, this->m_clamp);
+}
+#endif
+
+template<RangeClamp::Style STYLE>
+ConstOpCPURcPtr MakeMatrixRangeRenderer(ConstMatrixOpDataRcPtr & mat,
+                                        ConstRangeOpDataRcPtr & range)
+{
+    if (mat->isDiagonal())
+    {
+        return std::make_shared<ScaleRangeRenderer<STYLE>>(mat, range);
+    }
+
+#ifdef USE_AVX2
+    if (CPUInfo::Instance().hasAVX2())
+    {
+        return std::make_shared<MatrixRangeRendererAVX2<STYLE>>(mat, range);
+    }
+#endif
+    return std::make_shared<MatrixRangeRenderer<STYLE>>(mat, range);
+}
+
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
@@ -416,6 +868,19 @@ ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     }
     else
     {
+#ifdef USE_AVX2
+        if (CPUInfo::Instance().hasAVX2())
+        {
+            if (mat->hasOffsets())
+            {
+                return std::make_shared<MatrixWithOffsetRendererAVX2>(mat);
+            }
+            else
+            {
+                return std::make_shared<MatrixRendererAVX2>(mat);
+            }
+        }
+#endif
         if (mat->hasOffsets())
         {
             return std::make_shared<MatrixWithOffsetRenderer>(mat);
@@ -427,5 +892,25 @@ ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     }
 }
 
-} // namespace OCIO_NAMESPACE
+ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat, ConstRangeOpDataRcPtr & range)
+{
+    if (mat->getDirection() == TRANSFORM_DIR_INVERSE)
+    {
+        throw Exception("Op::finalize has to be called.");
+    }
 
+    switch (RangeClamp(*range).m_style)
+    {
+        case RangeClamp::MAX:
+            return MakeMatrixRangeRenderer<RangeClamp::MAX>(mat, range);
+        case RangeClamp::MIN:
+            return MakeMatrixRangeRenderer<RangeClamp::MIN>(mat, range);
+        case RangeClamp::MIN_MAX:
+            return MakeMatrixRangeRenderer<RangeClamp::MIN_MAX>(mat, range);
+        case RangeClamp::SCALE_MIN_MAX:
+            break;
+    }
+    return MakeMatrixRangeRenderer<RangeClamp::SCALE_MIN_MAX>(mat, range);
+}
+
+} // namespace OCIO_NAMESPACE
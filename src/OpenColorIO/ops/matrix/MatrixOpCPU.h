@@ -8,12 +8,17 @@
 
 #include "Op.h"
 #include "ops/matrix/MatrixOpData.h"
+#include "ops/range/RangeOpData.h"
 
 namespace OCIO_NAMESPACE
 {
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat);
 
+// Get a renderer applying the matrix and then the range in a single pass over the pixels,
+// instead of using two renderers. Both ops must be forward (i.e. Op::finalize was called).
+ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat, ConstRangeOpDataRcPtr & range);
+
 } // namespace OCIO_NAMESPACE
 
 #endif
\ No newline at end of file
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/matrix/MatrixOpCPU_AVX2.h"
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+#include "ops/range/RangeOpCPU_AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Call func on the matrix results of two pixels at a time.
+template<typename Func>
+void ApplyMatrix(const float * in, float * out, long numPixels,
+                 const float (&column1)[4], const float (&column2)[4],
+                 const float (&column3)[4], const float (&column4)[4],
+                 const float (&offset)[4], const Func & func)
+{
+    // Same decomposition per column as the SSE implementation, but for two pixels at a
+    // time i.e. the red, green, blue & alpha values of each pixel are broadcast in their
+    // half of the register.
+    const __m256 m0 = avx2LoadRGBA(column1);
+    const __m256 m1 = avx2LoadRGBA(column2);
+    const __m256 m2 = avx2LoadRGBA(column3);
+    const __m256 m3 = avx2LoadRGBA(column4);
+    const __m256 o  = avx2LoadRGBA(offset);
+
+    avx2ApplyRGBA(in, out, numPixels, [&](__m256 pix)
+    {
+        const __m256 r = _mm256_permute_ps(pix, 0x00);
+        const __m256 g = _mm256_permute_ps(pix, 0x55);
+        const __m256 b = _mm256_permute_ps(pix, 0xAA);
+        const __m256 a = _mm256_permute_ps(pix, 0xFF);
+
+        // Same operation order as the SSE implementation (i.e. no FMA) for identical results.
+        const __m256 rg = _mm256_add_ps(_mm256_mul_ps(m0, r), _mm256_mul_ps(m1, g));
+        const __m256 ba = _mm256_add_ps(_mm256_mul_ps(m2, b), _mm256_mul_ps(m3, a));
+
+        return func(_mm256_add_ps(_mm256_add_ps(rg, ba), o));
+    });
+}
+
+template<RangeClamp::Style STYLE>
+void ApplyMatrixRange(const float * in, float * out, long numPixels,
+                      const float (&column1)[4], const float (&column2)[4],
+                      const float (&column3)[4], const float (&column4)[4],
+                      const float (&offset)[4], const RangeClamp & range)
+{
+    const __m256 scale = _mm256_set1_ps(range.m_scale);
+    const __m256 rOffset = _mm256_set1_ps(range.m_offset);
+    const __m256 lower = _mm256_set1_ps(range.m_lowerBound);
+    const __m256 upper = _mm256_set1_ps(range.m_upperBound);
+
+    ApplyMatrix(in, out, numPixels, column1, column2, column3, column4, offset,
+                [&](__m256 pix)
+    {
+        return avx2KeepAlpha(avx2ApplyRangeClamp<STYLE>(pix, scale, rOffset, lower, upper), pix);
+    });
+}
+
+} // anon
+
+void ApplyMatrix_AVX2(const float * in, float * out, long numPixels,
+                      const float (&column1)[4], const float (&column2)[4],
+                      const float (&column3)[4], const float (&column4)[4],
+                      const float (&offset)[4])
+{
+    ApplyMatrix(in, out, numPixels, column1, column2, column3, column4, offset,
+                [](__m256 pix) { return pix; });
+}
+
+void ApplyMatrixRange_AVX2(const float * in, float * out, long numPixels,
+                           const float (&column1)[4], const float (&column2)[4],
+                           const float (&column3)[4], const float (&column4)[4],
+                           const float (&offset)[4], const RangeClamp & range)
+{
+    switch (range.m_style)
+    {
+        case RangeClamp::SCALE_MIN_MAX:
+            ApplyMatrixRange<RangeClamp::SCALE_MIN_MAX>(in, out, numPixels, column1, column2,
+                                                        column3, column4, offset, range);
+            break;
+        case RangeClamp::MIN_MAX:
+            ApplyMatrixRange<RangeClamp::MIN_MAX>(in, out, numPixels, column1, column2,
+                                                  column3, column4, offset, range);
+            break;
+        case RangeClamp::MIN:
+            ApplyMatrixRange<RangeClamp::MIN>(in, out, numPixels, column1, column2,
+                                              column3, column4, offset, range);
+            break;
+        case RangeClamp::MAX:
+            ApplyMatrixRange<RangeClamp::MAX>(in, out, numPixels, column1, column2,
+                                              column3, column4, offset, range);
+            break;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_MATRIXOP_CPU_AVX2_H
+#define INCLUDED_OCIO_MATRIXOP_CPU_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/range/RangeOpCPU.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the 4x4 matrix (given per column) and the offset to packed RGBA float pixels.
+// Only call it if CPUInfo::hasAVX2() is true.
+void ApplyMatrix_AVX2(const float * in, float * out, long numPixels,
+                      const float (&column1)[4], const float (&column2)[4],
+                      const float (&column3)[4], const float (&column4)[4],
+                      const float (&offset)[4]);
+
+// Same as ApplyMatrix_AVX2() followed by the range on the R, G & B channels.
+void ApplyMatrixRange_AVX2(const float * in, float * out, long numPixels,
+                           const float (&column1)[4], const float (&column2)[4],
+                           const float (&column3)[4], const float (&column4)[4],
+                           const float (&offset)[4], const RangeClamp & range);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
@@ -851,20 +851,12 @@ std::string MatrixOpData::getCacheID() const
 
     cacheIDStream << TransformDirectionToString(m_direction) << " ";
 
-    md5_state_t state;
-    md5_byte_t digest[16];
-
     // TODO: array and offset do not require double precision in cache.
-    md5_init(&state);
-    md5_append(&state,
-        (const md5_byte_t *)&(getArray().getValues()[0]),
-        (int)(16 * sizeof(double)));
-    md5_append(&state,
-        (const md5_byte_t *)getOffsets().getValues(),
-        (int)(4 * sizeof(double)));
-    md5_finish(&state, digest);
-
-    cacheIDStream << GetPrintableHash(digest);
+    double values[16 + 4];
+    std::memcpy(&values[0], &(getArray().getValues()[0]), 16 * sizeof(double));
+    std::memcpy(&values[16], getOffsets().getValues(), 4 * sizeof(double));
+
+    cacheIDStream << CacheIDHash(reinterpret_cast<const char *>(values), (int)sizeof(values));
 
     return cacheIDStream.str();
 }
@@ -48,7 +48,7 @@ public:
     void finalize() override;
     std::string getCacheID() const override;
 
-    ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
+    ConstOpCPURcPtr getCPUOp(LogExpPowPrecision precision) const override;
 
     void extractGpuShaderInfo(GpuShaderCreatorRcPtr & shaderCreator) const override;
 
@@ -192,7 +192,7 @@ std::string RangeOp::getCacheID() const
     return cacheIDStream.str();
 }
 
-ConstOpCPURcPtr RangeOp::getCPUOp(bool /*fastLogExpPow*/) const
+ConstOpCPURcPtr RangeOp::getCPUOp(LogExpPowPrecision /*precision*/) const
 {
     ConstRangeOpDataRcPtr data = rangeData();
     return GetRangeRenderer(data);
@@ -3,198 +3,223 @@
 
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "CPUInfo.h"
 #include "MathUtils.h"
-#include "ops/matrix/MatrixOpCPU.h"
 #include "ops/range/RangeOpCPU.h"
+#include "ops/range/RangeOpCPU_AVX2.h"
 
 namespace OCIO_NAMESPACE
 {
 
-class RangeOpCPU : public OpCPU
+RangeClamp::RangeClamp(const RangeOpData & range)
+    :   m_style(SCALE_MIN_MAX)
+    ,   m_scale((float)range.getScale())
+    ,   m_offset((float)range.getOffset())
+    ,   m_lowerBound((float)range.getMinOutValue())
+    ,   m_upperBound((float)range.getMaxOutValue())
+{
+    if (range.getDirection() == TRANSFORM_DIR_INVERSE)
+    {
+        throw Exception("Op::finalize has to be called.");
+    }
+
+    // Both min & max can not be empty at the same time.
+    if (range.minIsEmpty())
+    {
+        m_style = MAX;
+        m_lowerBound = -std::numeric_limits<float>::infinity();
+    }
+    else if (range.maxIsEmpty())
+    {
+        m_style = MIN;
+        m_upperBound = std::numeric_limits<float>::infinity();
+    }
+    else if (!range.scales())
+    {
+        m_style = MIN_MAX;
+    }
+}
+
+namespace
+{
+
+// The four renderers only differ by the computation of the R, G & B channels.
+template<RangeClamp::Style STYLE>
+class RangeRenderer : public OpCPU
 {
 public:
+    RangeRenderer() = delete;
+    explicit RangeRenderer(ConstRangeOpDataRcPtr & range);
 
-    RangeOpCPU(ConstRangeOpDataRcPtr & range);
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(const float * const * in, float * const * out,
+                     long numPixels) const override;
 
 protected:
-    float m_scale;
-    float m_offset;
-    float m_lowerBound;
-    float m_upperBound;
-
-private:
-    RangeOpCPU() = delete;
+    const RangeClamp m_clamp;
 };
 
-class RangeScaleMinMaxRenderer : public RangeOpCPU
+class RangeScaleMinMaxRenderer : public RangeRenderer<RangeClamp::SCALE_MIN_MAX>
 {
 public:
-    RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range);
-
-    virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    using RangeRenderer::RangeRenderer;
 };
 
-class RangeMinMaxRenderer : public RangeOpCPU
+class RangeMinMaxRenderer : public RangeRenderer<RangeClamp::MIN_MAX>
 {
 public:
-    RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range);
-
-    virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    using RangeRenderer::RangeRenderer;
 };
 
-class RangeMinRenderer : public RangeOpCPU
+class RangeMinRenderer : public RangeRenderer<RangeClamp::MIN>
 {
 public:
-    RangeMinRenderer(ConstRangeOpDataRcPtr & range);
+    using RangeRenderer::RangeRenderer;
+};
 
-    virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+class RangeMaxRenderer : public RangeRenderer<RangeClamp::MAX>
+{
+public:
+    using RangeRenderer::RangeRenderer;
 };
 
-class RangeMaxRenderer : public RangeOpCPU
+#ifdef USE_AVX2
+// Same as Base but processing two pixels at a time using AVX2.
+template<typename Base>
+class RangeRendererAVX2 : public Base
 {
 public:
-    RangeMaxRenderer(ConstRangeOpDataRcPtr & range);
+    explicit RangeRendererAVX2(ConstRangeOpDataRcPtr & range)
+        :   Base(range)
+    {
+    }
 
-    virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        ApplyRange_AVX2(this->m_clamp, (const float *)inImg, (float *)outImg, numPixels);
+    }
 };
+#endif
 
-
-RangeOpCPU::RangeOpCPU(ConstRangeOpDataRcPtr & range)
+template<RangeClamp::Style STYLE>
+RangeRenderer<STYLE>::RangeRenderer(ConstRangeOpDataRcPtr & range)
     :   OpCPU()
-    ,   m_scale(0.0f)
-    ,   m_offset(0.0f)
-    ,   m_lowerBound(0.0f)
-    ,   m_upperBound(0.0f)
+    ,   m_clamp(*range)
 {
-    m_scale      = (float)range->getScale();
-    m_offset     = (float)range->getOffset();
-    m_lowerBound = (float)range->getMinOutValue();
-    m_upperBound = (float)range->getMaxOutValue();
 }
 
-RangeScaleMinMaxRenderer::RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range)
-    :  RangeOpCPU(range)
-{
-}
-
-void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<RangeClamp::Style STYLE>
+void RangeRenderer<STYLE>::apply(const void * inImg, void * outImg, long numPixels) const
 {
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+#ifdef USE_SSE
+    const __m128 scale = _mm_set1_ps(m_clamp.m_scale);
+    const __m128 offset = _mm_set1_ps(m_clamp.m_offset);
+    const __m128 lower = _mm_set1_ps(m_clamp.m_lowerBound);
+    const __m128 upper = _mm_set1_ps(m_clamp.m_upperBound);
+
+    // Only the alpha lane is set.
+    const __m128 alphaMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+    for (long idx = 0; idx < numPixels; ++idx)
     {
-        const float t[3] = { in[0] * m_scale + m_offset,
-                             in[1] * m_scale + m_offset,
-                             in[2] * m_scale + m_offset };
-
-        // NaNs become m_lowerBound.
-        out[0] = Clamp(t[0], m_lowerBound, m_upperBound);
-        out[1] = Clamp(t[1], m_lowerBound, m_upperBound);
-        out[2] = Clamp(t[2], m_lowerBound, m_upperBound);
-        out[3] = in[3];
+        const __m128 pix = _mm_loadu_ps(in);
+        const __m128 res = sseApplyRangeClamp<STYLE>(pix, scale, offset, lower, upper);
+
+        // The alpha value is unchanged (even if it is a NaN).
+        _mm_storeu_ps(out, _mm_or_ps(_mm_andnot_ps(alphaMask, res), _mm_and_ps(alphaMask, pix)));
 
         in  += 4;
         out += 4;
     }
-}
-
-RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
-    :  RangeOpCPU(range)
-{
-}
-
-void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
-{
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    for(long idx=0; idx<numPixels; ++idx)
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
     {
-        // NaNs become m_lowerBound.
-        out[0] = Clamp(in[0], m_lowerBound, m_upperBound);
-        out[1] = Clamp(in[1], m_lowerBound, m_upperBound);
-        out[2] = Clamp(in[2], m_lowerBound, m_upperBound);
+        out[0] = ApplyRangeClamp<STYLE>(in[0], m_clamp);
+        out[1] = ApplyRangeClamp<STYLE>(in[1], m_clamp);
+        out[2] = ApplyRangeClamp<STYLE>(in[2], m_clamp);
         out[3] = in[3];
 
         in  += 4;
         out += 4;
     }
+#endif
 }
 
-RangeMinRenderer::RangeMinRenderer(ConstRangeOpDataRcPtr & range)
-    :  RangeOpCPU(range)
-{
-}
-
-void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<RangeClamp::Style STYLE>
+void RangeRenderer<STYLE>::applyPlanar(const float * const * in, float * const * out,
+                                       long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+#ifdef USE_SSE
+    const __m128 scale = _mm_set1_ps(m_clamp.m_scale);
+    const __m128 offset = _mm_set1_ps(m_clamp.m_offset);
+    const __m128 lower = _mm_set1_ps(m_clamp.m_lowerBound);
+    const __m128 upper = _mm_set1_ps(m_clamp.m_upperBound);
+#endif
 
-    for(long idx=0; idx<numPixels; ++idx)
+    // The R, G & B planes, the alpha plane being unchanged.
+    for (int chan = 0; chan < 3; ++chan)
     {
-        // NaNs become m_lowerBound.
-        out[0] = std::max(m_lowerBound, in[0]);
-        out[1] = std::max(m_lowerBound, in[1]);
-        out[2] = std::max(m_lowerBound, in[2]);
-        out[3] = in[3];
-
-        in  += 4;
-        out += 4;
+        const float * src = in[chan];
+        float * dst = out[chan];
+
+        long idx = 0;
+
+#ifdef USE_SSE
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            _mm_storeu_ps(dst + idx, sseApplyRangeClamp<STYLE>(_mm_loadu_ps(src + idx),
+                                                               scale, offset, lower, upper));
+        }
+#endif
+
+        for (; idx < numPixels; ++idx)
+        {
+            dst[idx] = ApplyRangeClamp<STYLE>(src[idx], m_clamp);
+        }
     }
-}
 
-RangeMaxRenderer::RangeMaxRenderer(ConstRangeOpDataRcPtr & range)
-    :  RangeOpCPU(range)
-{
+    if (out[3] && in[3] != out[3])
+    {
+        memcpy(out[3], in[3], numPixels * sizeof(float));
+    }
 }
 
-void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<typename Renderer>
+ConstOpCPURcPtr MakeRangeRenderer(ConstRangeOpDataRcPtr & range)
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-    for(long idx=0; idx<numPixels; ++idx)
+#ifdef USE_AVX2
+    if (CPUInfo::Instance().hasAVX2())
     {
-        // NaNs become m_upperBound.
-        out[0] = std::min(m_upperBound, in[0]);
-        out[1] = std::min(m_upperBound, in[1]);
-        out[2] = std::min(m_upperBound, in[2]);
-        out[3] = in[3];
-
-        in  += 4;
-        out += 4;
+        return std::make_shared<RangeRendererAVX2<Renderer>>(range);
     }
+#endif
+    return std::make_shared<Renderer>(range);
 }
 
+} // anon
 
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range)
 {
-    ConstRangeOpDataRcPtr rangeFwd = range;
-    if (range->getDirection() == TRANSFORM_DIR_INVERSE)
-    {
-        throw Exception("Op::finalize has to be called.");
-    }
-    // Both min & max can not be empty at the same time.
-    if (rangeFwd->minIsEmpty())
-    {
-        return std::make_shared<RangeMaxRenderer>(rangeFwd);
-    }
-    else if (rangeFwd->maxIsEmpty())
-    {
-        return std::make_shared<RangeMinRenderer>(rangeFwd);
-    }
-
-    // Both min and max have values.
-    if (!rangeFwd->scales())
+    switch (RangeClamp(*range).m_style)
     {
-        return std::make_shared<RangeMinMaxRenderer>(rangeFwd);
+        case RangeClamp::MAX:
+            return MakeRangeRenderer<RangeMaxRenderer>(range);
+        case RangeClamp::MIN:
+            return MakeRangeRenderer<RangeMinRenderer>(range);
+        case RangeClamp::MIN_MAX:
+            return MakeRangeRenderer<RangeMinMaxRenderer>(range);
+        case RangeClamp::SCALE_MIN_MAX:
+            break;
     }
-    return std::make_shared<RangeScaleMinMaxRenderer>(rangeFwd);
+    return MakeRangeRenderer<RangeScaleMinMaxRenderer>(range);
 }
 
 } // namespace OCIO_NAMESPACE
@@ -6,17 +6,87 @@
 #define INCLUDED_OCIO_RANGEOP_CPU_H
 
 
+#include <algorithm>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "MathUtils.h"
 #include "ops/range/RangeOpData.h"
 
+#ifdef USE_SSE
+#include <emmintrin.h>
+#endif
+
 
 namespace OCIO_NAMESPACE
 {
 
+// The computation done by the Range renderers on the R, G & B channels. It lets other renderers
+// apply a following Range op in the same pass over the pixels (see GetMatrixRenderer()).
+struct RangeClamp
+{
+    enum Style
+    {
+        SCALE_MIN_MAX = 0, // Scale and offset, then clamp to [lower, upper].
+        MIN_MAX,           // Clamp to [lower, upper], NaNs become lower.
+        MIN,               // Clamp to [lower, +inf], NaNs become lower.
+        MAX                // Clamp to [-inf, upper], NaNs become upper.
+    };
+
+    // The range must be forward (i.e. Op::finalize was called).
+    explicit RangeClamp(const RangeOpData & range);
+
+    Style m_style;
+    float m_scale;
+    float m_offset;
+    float m_lowerBound;
+    float m_upperBound;
+};
+
+template<RangeClamp::Style STYLE>
+inline float ApplyRangeClamp(float v, const RangeClamp & r)
+{
+    switch (STYLE)
+    {
+        case RangeClamp::SCALE_MIN_MAX:
+            return Clamp(v * r.m_scale + r.m_offset, r.m_lowerBound, r.m_upperBound);
+        case RangeClamp::MIN_MAX:
+            return Clamp(v, r.m_lowerBound, r.m_upperBound);
+        case RangeClamp::MIN:
+            return std::max(r.m_lowerBound, v);
+        case RangeClamp::MAX:
+            return std::min(r.m_upperBound, v);
+    }
+    return v;
+}
+
+#ifdef USE_SSE
+// Same as ApplyRangeClamp() for four values, where the registers hold the RangeClamp values.
+template<RangeClamp::Style STYLE>
+inline __m128 sseApplyRangeClamp(__m128 v, const __m128 & scale, const __m128 & offset,
+                                 const __m128 & lower, const __m128 & upper)
+{
+    if (STYLE == RangeClamp::SCALE_MIN_MAX)
+    {
+        v = _mm_add_ps(_mm_mul_ps(v, scale), offset);
+    }
+
+    // Note that _mm_max_ps & _mm_min_ps return their second argument for NaNs.
+    if (STYLE != RangeClamp::MAX)
+    {
+        v = _mm_max_ps(v, lower);
+    }
+    if (STYLE != RangeClamp::MIN)
+    {
+        v = _mm_min_ps(v, upper);
+    }
+    return v;
+}
+#endif
+
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range);
 
 } // namespace OCIO_NAMESPACE
 
 
-#endif
\ No newline at end of file
+#endif
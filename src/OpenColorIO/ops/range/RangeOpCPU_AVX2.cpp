@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#ifdef USE_AVX2
+
+#include "AVX2.h"
+#include "ops/range/RangeOpCPU_AVX2.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+template<RangeClamp::Style STYLE>
+void ApplyRange(const RangeClamp & range, const float * in, float * out, long numPixels)
+{
+    const __m256 scale  = _mm256_set1_ps(range.m_scale);
+    const __m256 offset = _mm256_set1_ps(range.m_offset);
+    const __m256 lower  = _mm256_set1_ps(range.m_lowerBound);
+    const __m256 upper  = _mm256_set1_ps(range.m_upperBound);
+
+    avx2ApplyRGBA(in, out, numPixels, [&](__m256 pix)
+    {
+        // The alpha values are unchanged (even if they are NaNs).
+        return avx2KeepAlpha(avx2ApplyRangeClamp<STYLE>(pix, scale, offset, lower, upper), pix);
+    });
+}
+
+} // anon
+
+void ApplyRange_AVX2(const RangeClamp & range, const float * in, float * out, long numPixels)
+{
+    switch (range.m_style)
+    {
+        case RangeClamp::SCALE_MIN_MAX:
+            ApplyRange<RangeClamp::SCALE_MIN_MAX>(range, in, out, numPixels);
+            break;
+        case RangeClamp::MIN_MAX:
+            ApplyRange<RangeClamp::MIN_MAX>(range, in, out, numPixels);
+            break;
+        case RangeClamp::MIN:
+            ApplyRange<RangeClamp::MIN>(range, in, out, numPixels);
+            break;
+        case RangeClamp::MAX:
+            ApplyRange<RangeClamp::MAX>(range, in, out, numPixels);
+            break;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_RANGEOP_CPU_AVX2_H
+#define INCLUDED_OCIO_RANGEOP_CPU_AVX2_H
+
+
+#ifdef USE_AVX2
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/range/RangeOpCPU.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply the range to packed RGBA float pixels, the alpha channel being unchanged.
+// Only call it if CPUInfo::hasAVX2() is true.
+void ApplyRange_AVX2(const RangeClamp & range, const float * in, float * out, long numPixels);
+
+// The following is only available to the translation units compiled for AVX2 (i.e. the ones
+// including AVX2.h).
+#ifdef INCLUDED_OCIO_AVX2_H
+
+// Same as ApplyRangeClamp() for eight values, where the registers hold the RangeClamp values.
+template<RangeClamp::Style STYLE>
+inline __m256 avx2ApplyRangeClamp(__m256 v, const __m256 & scale, const __m256 & offset,
+                                  const __m256 & lower, const __m256 & upper)
+{
+    if (STYLE == RangeClamp::SCALE_MIN_MAX)
+    {
+        v = _mm256_add_ps(_mm256_mul_ps(v, scale), offset);
+    }
+
+    // Note that _mm256_max_ps & _mm256_min_ps return their second argument for NaNs.
+    if (STYLE != RangeClamp::MAX)
+    {
+        v = _mm256_max_ps(v, lower);
+    }
+    if (STYLE != RangeClamp::MIN)
+    {
+        v = _mm256_min_ps(v, upper);
+    }
+    return v;
+}
+
+#endif // INCLUDED_OCIO_AVX2_H
+
+} // namespace OCIO_NAMESPACE
+
+#endif // USE_AVX2
+
+#endif
@@ -7,6 +7,7 @@
 #include <map>
 #include <sstream>
 #include <string.h>
+#include <sys/stat.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -709,9 +710,46 @@ typedef OCIO_SHARED_PTR<FileCacheResult> FileCacheResultPtr;
 } // namespace
 
 
+namespace
+{
+
+// The size on disk is a cheap estimate of the loaded file content.
+size_t EstimateFileCacheEntrySize(const std::string & filepath, const FileCacheResultPtr &)
+{
+    struct stat fileInfo;
+    if (stat(filepath.c_str(), &fileInfo) == 0)
+    {
+        return static_cast<size_t>(fileInfo.st_size);
+    }
+    return 0;
+}
+
+} // namespace
+
 // A global file content cache.
 template class GenericCache<std::string, FileCacheResultPtr>;
-GenericCache<std::string, FileCacheResultPtr> g_fileCache;
+using FileCache = GenericCache<std::string, FileCacheResultPtr>;
+FileCache g_fileCache{ FileCache::SizeEstimator(EstimateFileCacheEntrySize) };
+
+void SetFileCacheCapacity(size_t maxEntries, size_t maxBytes)
+{
+    g_fileCache.setCapacity(maxEntries, maxBytes);
+}
+
+size_t GetFileCacheMaxEntries()
+{
+    return g_fileCache.getMaxEntries();
+}
+
+size_t GetFileCacheMaxBytes()
+{
+    return g_fileCache.getMaxBytes();
+}
+
+CacheStats GetFileCacheStats()
+{
+    return g_fileCache.getStats();
+}
 
 
 void GetCachedFileAndFormat(FileFormat * & format,
@@ -732,13 +770,13 @@ void GetCachedFileAndFormat(FileFormat * & format,
         {
             // As the entry is a shared pointer instance, having an empty one
             // means that the entry does not exist in the cache. So, it provides
-            // a fast existence check.
-            result = g_fileCache[filepath];
-            if (!result)
+            // a fast existence check & access in one call.
+            FileCacheResultPtr & entry = g_fileCache[filepath];
+            if (!entry)
             {
-                result = std::make_shared<FileCacheResult>();
-                g_fileCache[filepath] = result;
+                entry = std::make_shared<FileCacheResult>();
             }
+            result = entry;
         }
         else
         {
@@ -808,6 +846,11 @@ void ClearFileTransformCaches()
     g_fileCache.clear();
 }
 
+void ResetFileTransformCacheStats()
+{
+    g_fileCache.resetStats();
+}
+
 void BuildFileTransformOps(OpRcPtrVec & ops,
                            const Config& config,
                            const ConstContextRcPtr & context,
@@ -21,6 +21,9 @@ namespace OCIO_NAMESPACE
 {
 void ClearFileTransformCaches();
 
+// Reset the counters of the file cache, see GetFileCacheStats().
+void ResetFileTransformCacheStats();
+
 class CachedFile
 {
 public:
@@ -3,8 +3,14 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <deque>
+#include <future>
+#include <iomanip>
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -53,6 +59,24 @@ bool StringToInt(int * ival, const char * str);
 
 bool StringToVector(std::vector<int> * ivector, const char * str);
 
+bool SetAttributes(OIIO::ImageSpec & spec,
+                   const std::vector<std::string> & floatAttrs,
+                   const std::vector<std::string> & intAttrs,
+                   const std::vector<std::string> & stringAttrs);
+
+OCIO::ConstProcessorRcPtr CreateProcessor(bool useLut, const char * lutFile,
+                                          bool useDisplayView, const char * display,
+                                          const char * view, const char * inputcolorspace,
+                                          const char * outputcolorspace);
+
+void ConvertSequence(const OCIO::ConstProcessorRcPtr & processor,
+                     const std::string & inputPattern, const std::string & outputPattern,
+                     int firstFrame, int lastFrame,
+                     const std::vector<std::string> & floatAttrs,
+                     const std::vector<std::string> & intAttrs,
+                     const std::vector<std::string> & stringAttrs,
+                     bool verbose);
+
 int main(int argc, const char **argv)
 {
     ArgParse ap;
@@ -70,11 +94,13 @@ int main(int argc, const char **argv)
     bool help           = false;
     bool useLut         = false;
     bool useDisplayView = false;
+    int  frames[2]      = { std::numeric_limits<int>::min(), std::numeric_limits<int>::min() };
 
     ap.options("ocioconvert -- apply colorspace transform to an image \n\n"
                "usage: ocioconvert [options]  inputimage inputcolorspace outputimage outputcolorspace\n"
                "   or: ocioconvert [options] --lut lutfile inputimage outputimage\n"
-               "   or: ocioconvert [options] --view inputimage inputcolorspace outputimage displayname viewname\n\n",
+               "   or: ocioconvert [options] --view inputimage inputcolorspace outputimage displayname viewname\n\n"
+               "With --frames, the image names contain '#' characters (e.g. image.####.exr).\n\n",
                "%*", parse_end_args, "",
                "<SEPARATOR>", "Options:",
                "--lut",       &useLut,         "Convert using a LUT rather than a config file",
@@ -84,6 +110,10 @@ int main(int argc, const char **argv)
                "--gpulegacy", &usegpuLegacy,   "Use the legacy (i.e. baked) GPU color processing "
                                                "instead of the CPU one (--gpu is ignored)",
                "--gpuinfo",  &outputgpuInfo,   "Output the OCIO shader program",
+               "--frames %d %d", &frames[0], &frames[1],
+                                               "Convert the frames [first, last] of an image sequence "
+                                               "where the '#' characters of the image names are "
+                                               "replaced by the zero-padded frame number (CPU only)",
                "--help",     &help,            "Print help message",
                "-v" ,        &verbose,         "Display general information",
                "<SEPARATOR>", "\nOpenImageIO options:",
@@ -178,6 +208,31 @@ int main(int argc, const char **argv)
         view            = args[4].c_str();
     }
 
+    const bool useSequence = frames[0] != std::numeric_limits<int>::min();
+    if (useSequence)
+    {
+        if (frames[0] > frames[1])
+        {
+            std::cerr << "ERROR: The first frame must not be after the last frame." << std::endl;
+            exit(1);
+        }
+
+        if (usegpu || usegpuLegacy || croptofull || !keepChannels.empty())
+        {
+            std::cerr << "ERROR: Options gpu, gpulegacy, croptofull & ch can't be used "
+                         "with option frames." << std::endl;
+            exit(1);
+        }
+
+        if (std::string(inputimage).find('#') == std::string::npos
+            || std::string(outputimage).find('#') == std::string::npos)
+        {
+            std::cerr << "ERROR: The input and output image names must contain '#' characters "
+                         "with option frames." << std::endl;
+            exit(1);
+        }
+    }
+
     if(verbose)
     {
         std::cout << std::endl;
@@ -207,6 +262,31 @@ int main(int argc, const char **argv)
         }
     }
 
+    if (useSequence)
+    {
+        const OCIO::ConstProcessorRcPtr processor
+            = CreateProcessor(useLut, lutFile, useDisplayView, display, view,
+                              inputcolorspace, outputcolorspace);
+
+        try
+        {
+            ConvertSequence(processor, inputimage, outputimage, frames[0], frames[1],
+                            floatAttrs, intAttrs, stringAttrs, verbose);
+        }
+        catch (const std::exception & e)
+        {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            exit(1);
+        }
+        catch (...)
+        {
+            std::cerr << "ERROR: Unknown error converting the image sequence." << std::endl;
+            exit(1);
+        }
+
+        return 0;
+    }
+
     if (usegpuLegacy)
     {
         std::cout << std::endl;
@@ -443,47 +523,10 @@ int main(int argc, const char **argv)
     // Process the image.
     try
     {
-        // Load the current config.
-        OCIO::ConstConfigRcPtr config
-            = useLut ? OCIO::Config::CreateRaw() : OCIO::GetCurrentConfig();
-
         // Get the processor.
-        OCIO::ConstProcessorRcPtr processor;
-
-        try
-        {
-            if (useLut)
-            {
-                // Create the OCIO processor for the specified transform.
-                OCIO::FileTransformRcPtr t = OCIO::FileTransform::Create();
-                t->setSrc(lutFile);
-                t->setInterpolation(OCIO::INTERP_BEST);
-    
-                processor = config->getProcessor(t);
-            }
-            else if (useDisplayView)
-            {
-                OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
-                t->setSrc(inputcolorspace);
-                t->setDisplay(display);
-                t->setView(view);
-                processor = config->getProcessor(t);
-            }
-            else
-            {
-                processor = config->getProcessor(inputcolorspace, outputcolorspace);
-            }
-        }
-        catch (const OCIO::Exception & e)
-        {
-            std::cout << "ERROR: OCIO failed with: " << e.what() << std::endl;
-            exit(1);
-        }
-        catch (...)
-        {
-            std::cout << "ERROR: Creating processor unknown failure." << std::endl;
-            exit(1);
-        }
+        OCIO::ConstProcessorRcPtr processor
+            = CreateProcessor(useLut, lutFile, useDisplayView, display, view,
+                              inputcolorspace, outputcolorspace);
 
 #ifdef OCIO_GPU_ENABLED
         if (usegpu || usegpuLegacy)
@@ -549,55 +592,7 @@ int main(int argc, const char **argv)
     //
     // set the provided OpenImageIO attributes.
     //
-    bool parseerror = false;
-    for(unsigned int i=0; i<floatAttrs.size(); ++i)
-    {
-        std::string name, value;
-        float fval = 0.0f;
-
-        if(!ParseNameValuePair(name, value, floatAttrs[i]) ||
-           !StringToFloat(&fval,value.c_str()))
-        {
-            std::cerr << "ERROR: Attribute string '" << floatAttrs[i]
-                      << "' should be in the form name=floatvalue." << std::endl;
-            parseerror = true;
-            continue;
-        }
-
-        spec.attribute(name, fval);
-    }
-
-    for(unsigned int i=0; i<intAttrs.size(); ++i)
-    {
-        std::string name, value;
-        int ival = 0;
-        if(!ParseNameValuePair(name, value, intAttrs[i]) ||
-           !StringToInt(&ival,value.c_str()))
-        {
-            std::cerr << "ERROR: Attribute string '" << intAttrs[i]
-                      << "' should be in the form name=intvalue." << std::endl;
-            parseerror = true;
-            continue;
-        }
-
-        spec.attribute(name, ival);
-    }
-
-    for(unsigned int i=0; i<stringAttrs.size(); ++i)
-    {
-        std::string name, value;
-        if(!ParseNameValuePair(name, value, stringAttrs[i]))
-        {
-            std::cerr << "ERROR: Attribute string '" << stringAttrs[i]
-                      << "' should be in the form name=value." << std::endl;
-            parseerror = true;
-            continue;
-        }
-
-        spec.attribute(name, value);
-    }
-
-    if(parseerror)
+    if(!SetAttributes(spec, floatAttrs, intAttrs, stringAttrs))
     {
         exit(1);
     }
@@ -705,6 +700,283 @@ bool StringToVector(std::vector<int> * ivector, const char * str)
     return ivector->size() != 0;
 }
 
+// Set the OpenImageIO attributes from "name=value" pairs.
+// return true on success.
+bool SetAttributes(OIIO::ImageSpec & spec,
+                   const std::vector<std::string> & floatAttrs,
+                   const std::vector<std::string> & intAttrs,
+                   const std::vector<std::string> & stringAttrs)
+{
+    bool parseerror = false;
+    for(unsigned int i=0; i<floatAttrs.size(); ++i)
+    {
+        std::string name, value;
+        float fval = 0.0f;
+
+        if(!ParseNameValuePair(name, value, floatAttrs[i]) ||
+           !StringToFloat(&fval,value.c_str()))
+        {
+            std::cerr << "ERROR: Attribute string '" << floatAttrs[i]
+                      << "' should be in the form name=floatvalue." << std::endl;
+            parseerror = true;
+            continue;
+        }
+
+        spec.attribute(name, fval);
+    }
+
+    for(unsigned int i=0; i<intAttrs.size(); ++i)
+    {
+        std::string name, value;
+        int ival = 0;
+        if(!ParseNameValuePair(name, value, intAttrs[i]) ||
+           !StringToInt(&ival,value.c_str()))
+        {
+            std::cerr << "ERROR: Attribute string '" << intAttrs[i]
+                      << "' should be in the form name=intvalue." << std::endl;
+            parseerror = true;
+            continue;
+        }
+
+        spec.attribute(name, ival);
+    }
+
+    for(unsigned int i=0; i<stringAttrs.size(); ++i)
+    {
+        std::string name, value;
+        if(!ParseNameValuePair(name, value, stringAttrs[i]))
+        {
+            std::cerr << "ERROR: Attribute string '" << stringAttrs[i]
+                      << "' should be in the form name=value." << std::endl;
+            parseerror = true;
+            continue;
+        }
+
+        spec.attribute(name, value);
+    }
+
+    return !parseerror;
+}
+
+// Create the processor of the conversion, exit on failure.
+OCIO::ConstProcessorRcPtr CreateProcessor(bool useLut, const char * lutFile,
+                                          bool useDisplayView, const char * display,
+                                          const char * view, const char * inputcolorspace,
+                                          const char * outputcolorspace)
+{
+    try
+    {
+        // Load the current config.
+        OCIO::ConstConfigRcPtr config
+            = useLut ? OCIO::Config::CreateRaw() : OCIO::GetCurrentConfig();
+
+        if (useLut)
+        {
+            // Create the OCIO processor for the specified transform.
+            OCIO::FileTransformRcPtr t = OCIO::FileTransform::Create();
+            t->setSrc(lutFile);
+            t->setInterpolation(OCIO::INTERP_BEST);
+
+            return config->getProcessor(t);
+        }
+        else if (useDisplayView)
+        {
+            OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
+            t->setSrc(inputcolorspace);
+            t->setDisplay(display);
+            t->setView(view);
+            return config->getProcessor(t);
+        }
+        else
+        {
+            return config->getProcessor(inputcolorspace, outputcolorspace);
+        }
+    }
+    catch (const OCIO::Exception & e)
+    {
+        std::cout << "ERROR: OCIO failed with: " << e.what() << std::endl;
+        exit(1);
+    }
+    catch (...)
+    {
+        std::cout << "ERROR: Creating processor unknown failure." << std::endl;
+        exit(1);
+    }
+}
+
+namespace
+{
+
+// Replace the '#' characters of the image name by the zero-padded frame number, the number
+// of '#' characters being the padding (e.g. "img.####.exr" becomes "img.0012.exr").
+std::string GetFrameName(const std::string & pattern, int frame)
+{
+    const size_t first = pattern.find('#');
+    size_t last = pattern.find_first_not_of('#', first);
+    if (last == std::string::npos)
+    {
+        last = pattern.size();
+    }
 
+    std::ostringstream oss;
+    oss << std::setfill('0') << std::internal << std::setw(int(last - first)) << frame;
 
+    return pattern.substr(0, first) + oss.str() + pattern.substr(last);
+}
 
+// Read an image in its own format, throw on failure.
+void ReadImage(const std::string & name, OIIO::ImageSpec & spec, OCIO::ImgBuffer & img)
+{
+#if OIIO_VERSION < 10903
+    OIIO::ImageInput* f = OIIO::ImageInput::create(name);
+#else
+    auto f = OIIO::ImageInput::create(name);
+#endif
+    if(!f)
+    {
+        throw std::runtime_error("Could not create image input for \"" + name + "\".");
+    }
+
+    if(!f->open(name, spec))
+    {
+        throw std::runtime_error("Could not load image \"" + name + "\": " + f->geterror());
+    }
+
+    img.allocate(spec);
+
+    if(!f->read_image(spec.format, img.getBuffer()))
+    {
+        throw std::runtime_error("Reading \"" + name + "\" failed with: " + f->geterror());
+    }
+
+    f->close();
+#if OIIO_VERSION < 10903
+    OIIO::ImageInput::destroy(f);
+#endif
+}
+
+// Write an image, throw on failure.
+void WriteImage(const std::string & name, const OIIO::ImageSpec & spec,
+                const OCIO::ImgBuffer & img)
+{
+#if OIIO_VERSION < 10903
+    OIIO::ImageOutput* f = OIIO::ImageOutput::create(name);
+#else
+    auto f = OIIO::ImageOutput::create(name);
+#endif
+    if(!f)
+    {
+        throw std::runtime_error("Could not create image output for \"" + name + "\".");
+    }
+
+    if(!f->open(name, spec) || !f->write_image(spec.format, img.getBuffer()))
+    {
+        throw std::runtime_error("Writing \"" + name + "\" failed with: " + f->geterror());
+    }
+
+    f->close();
+#if OIIO_VERSION < 10903
+    OIIO::ImageOutput::destroy(f);
+#endif
+}
+
+// A frame of the image sequence being converted.
+struct Frame
+{
+    std::string     m_outputName;
+    OIIO::ImageSpec m_spec;
+    OCIO::ImgBuffer m_img;
+};
+
+} // anon
+
+// Convert the frames of an image sequence using the CPU. The processing is asynchronous so the
+// reading of the next frames and the writing of the previous ones overlap with the processing
+// of the current frame. Throw on failure.
+void ConvertSequence(const OCIO::ConstProcessorRcPtr & processor,
+                     const std::string & inputPattern, const std::string & outputPattern,
+                     int firstFrame, int lastFrame,
+                     const std::vector<std::string> & floatAttrs,
+                     const std::vector<std::string> & intAttrs,
+                     const std::vector<std::string> & stringAttrs,
+                     bool verbose)
+{
+    // Number of frames read but not yet written, which bounds the memory usage.
+    static constexpr size_t maxFramesInFlight = 4;
+
+    const std::chrono::high_resolution_clock::time_point start
+        = std::chrono::high_resolution_clock::now();
+
+    // The pending writes with the name of their image, in the frame order.
+    std::deque<std::pair<std::future<void>, std::string>> writes;
+
+    const auto waitWrite = [&writes]()
+    {
+        writes.front().first.get();
+        std::cout << "Wrote " << writes.front().second << std::endl;
+        writes.pop_front();
+    };
+
+    for (int frame = firstFrame; frame <= lastFrame; ++frame)
+    {
+        if (writes.size() >= maxFramesInFlight)
+        {
+            waitWrite();
+        }
+
+        auto f = std::make_shared<Frame>();
+
+        const std::string inputName = GetFrameName(inputPattern, frame);
+        f->m_outputName = GetFrameName(outputPattern, frame);
+
+        ReadImage(inputName, f->m_spec, f->m_img);
+
+        if (verbose)
+        {
+            std::cout << "Loaded " << inputName << std::endl;
+        }
+
+        if (!SetAttributes(f->m_spec, floatAttrs, intAttrs, stringAttrs))
+        {
+            throw std::runtime_error("Invalid OpenImageIO attributes.");
+        }
+
+        const OCIO::BitDepth bitDepth = OCIO::GetBitDepth(f->m_spec);
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor
+            = processor->getOptimizedCPUProcessor(bitDepth, bitDepth,
+                                                  OCIO::OPTIMIZATION_DEFAULT);
+
+        // All the hardware threads process the frame while the next one is read.
+        OCIO::ImageDescRcPtr imgDesc = OCIO::CreateImageDesc(f->m_spec, f->m_img);
+        std::shared_future<void> processed = cpuProcessor->applyAsync(*imgDesc, 0).share();
+
+        // The CPU processor is kept alive until the end of the processing.
+        std::future<void> written
+            = std::async(std::launch::async, [f, processed, cpuProcessor]()
+                {
+                    processed.get();
+                    WriteImage(f->m_outputName, f->m_spec, f->m_img);
+                });
+
+        writes.emplace_back(std::move(written), f->m_outputName);
+    }
+
+    while (!writes.empty())
+    {
+        waitWrite();
+    }
+
+    if (verbose)
+    {
+        const std::chrono::high_resolution_clock::time_point end
+            = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<float, std::milli> duration = end - start;
+
+        std::cout << std::endl;
+        std::cout << "Converting " << (lastFrame - firstFrame + 1) << " frames took: "
+                  << duration.count()
+                  << " ms" << std::endl;
+    }
+}
@@ -2,6 +2,8 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <cmath>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include <OpenImageIO/imageio.h>
@@ -171,7 +173,8 @@ void LoadImage(const std::string & filepath,
 
 // Process the complete image in one shot.
 void ProcessImage(CustomMeasure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
-                  const OIIO::ImageSpec & spec, const OCIO::ImgBuffer & img)
+                  const OIIO::ImageSpec & spec, const OCIO::ImgBuffer & img,
+                  unsigned numThreads)
 {
     // Always process the same complete image.
     OCIO::ImgBuffer srcImg(img);
@@ -180,7 +183,14 @@ void ProcessImage(CustomMeasure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcessor
     m.resume();
 
     // Apply the color transformation (in place).
-    cpuProcessor->apply(*imgDesc);
+    if (numThreads == 1)
+    {
+        cpuProcessor->apply(*imgDesc);
+    }
+    else
+    {
+        cpuProcessor->apply(*imgDesc, numThreads);
+    }
 
     m.pause();
 }
@@ -262,6 +272,74 @@ void ProcessPixels(CustomMeasure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcesso
     m.pause();
 }
 
+// Measure the processor creation, and the processing of the complete image using synthetic
+// 3D LUTs of several sizes and interpolations.
+void ProcessLut3Ds(const OIIO::ImageSpec & spec, const OCIO::ImgBuffer & img,
+                   unsigned iterations, unsigned numThreads)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    const OCIO::BitDepth bitDepth = OCIO::GetBitDepth(spec);
+
+    for (unsigned long gridSize : { 17, 33, 65, 129 })
+    {
+        // A smooth transform with some crosstalk between the channels.
+        OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(gridSize);
+        const float scale = 1.0f / float(gridSize - 1);
+        for (unsigned long r = 0; r < gridSize; ++r)
+        {
+            for (unsigned long g = 0; g < gridSize; ++g)
+            {
+                for (unsigned long b = 0; b < gridSize; ++b)
+                {
+                    const float red   = float(r) * scale;
+                    const float green = float(g) * scale;
+                    const float blue  = float(b) * scale;
+                    lut->setValue(r, g, b,
+                                  std::sqrt(0.8f * red + 0.1f * green + 0.1f * blue),
+                                  std::sqrt(0.1f * red + 0.8f * green + 0.1f * blue),
+                                  std::sqrt(0.1f * red + 0.1f * green + 0.8f * blue));
+                }
+            }
+        }
+
+        {
+            std::ostringstream oss;
+            oss << "Create a " << gridSize << "^3 LUT processor:\t\t";
+
+            // Use a new config for each iteration to bypass its processor cache, so the time
+            // includes the computation of the processor cache identifier i.e. the LUT hashing.
+            CustomMeasure m(oss.str().c_str(), iterations);
+            for (unsigned iter = 0; iter < iterations; ++iter)
+            {
+                OCIO::ConstConfigRcPtr newConfig = OCIO::Config::CreateRaw();
+
+                m.resume();
+                newConfig->getProcessor(lut)->getCacheID();
+                m.pause();
+            }
+        }
+
+        for (OCIO::Interpolation interp : { OCIO::INTERP_LINEAR, OCIO::INTERP_TETRAHEDRAL })
+        {
+            lut->setInterpolation(interp);
+
+            OCIO::ConstCPUProcessorRcPtr cpuProcessor
+                = config->getProcessor(lut)->getOptimizedCPUProcessor(bitDepth, bitDepth,
+                                                                      OCIO::OPTIMIZATION_DEFAULT);
+
+            std::ostringstream oss;
+            oss << "Process a " << gridSize << "^3 LUT ("
+                << OCIO::InterpolationToString(interp) << "):\t\t";
+
+            CustomMeasure m(oss.str().c_str(), iterations);
+            for (unsigned iter = 0; iter < iterations; ++iter)
+            {
+                ProcessImage(m, cpuProcessor, spec, img, numThreads);
+            }
+        }
+    }
+}
+
 int main(int argc, const char **argv)
 {
     bool help = false;
@@ -271,7 +349,10 @@ int main(int argc, const char **argv)
     std::string inputColorSpace, outputColorSpace, display, view;
     std::string filepath;
     unsigned iterations = 50;
+    unsigned numThreads = 1;
+    int blockSize = -1;
     bool nocache = false;
+    bool lut3d = false;
 
     std::string outBitDepthStr("auto");
 
@@ -292,7 +373,17 @@ int main(int argc, const char **argv)
                "--iter %d", &iterations, "Provide the number of iterations on the processing. Default is 10",
                "--out %s", &outBitDepthStr, "Provide an output bit-depth (auto, ui16, f32)"\
                                             " where auto preserves the input bit-depth",
+               "--threads %d", &numThreads, "Provide the number of threads used to process the"\
+                                            " complete image where 0 means all the hardware"\
+                                            " threads. Default is 1",
+               "--blocksize %d", &blockSize, "Provide the maximum number of pixels processed at"\
+                                             " once through all the ops where 0 means complete"\
+                                             " lines. Default is the library default",
                "--nocache", &nocache, "Bypass all caches",
+               "--lut3d", &lut3d, "Measure the processor creation and the complete image"\
+                                  " processing using 3D LUTs of size 17, 33, 65 & 129 with the"\
+                                  " linear & tetrahedral interpolations instead of a color"\
+                                  " transformation",
                NULL);
 
     if (ap.parse (argc, argv) < 0)
@@ -349,6 +440,24 @@ int main(int argc, const char **argv)
         return 1;
     }
 
+    if (lut3d)
+    {
+        std::cout << std::endl << std::endl;
+        std::cout << "3D LUT processing statistics:" << std::endl << std::endl;
+
+        try
+        {
+            ProcessLut3Ds(spec, img, iterations, numThreads);
+        }
+        catch (std::exception & ex)
+        {
+            std::cerr << "ERROR: " << ex.what() << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+
     outBitDepthStr = StringUtils::Lower(outBitDepthStr);
 
     if (!transformFile.empty())
@@ -580,6 +689,29 @@ int main(int argc, const char **argv)
         std::cout << std::endl << std::endl;
         std::cout << "Image processing statistics:" << std::endl << std::endl;
 
+        if (blockSize >= 0)
+        {
+            OCIO::SetCPUProcessorBlockSize(unsigned(blockSize));
+        }
+
+        std::cout << "Processing blocks of ";
+        if (OCIO::GetCPUProcessorBlockSize() == 0)
+        {
+            std::cout << "complete lines." << std::endl << std::endl;
+        }
+        else
+        {
+            std::cout << OCIO::GetCPUProcessorBlockSize() << " pixels." << std::endl << std::endl;
+        }
+
+        if (numThreads != 1)
+        {
+            std::cout << "Complete image processing uses "
+                      << (numThreads == 0 ? std::string("all the hardware")
+                                          : std::to_string(numThreads))
+                      << " threads." << std::endl << std::endl;
+        }
+
 
         if(testType==0 || testType==-1)
         {
@@ -591,7 +723,7 @@ int main(int argc, const char **argv)
 
                 for(unsigned iter=0; iter<iterations; ++iter)
                 {
-                    ProcessImage(m, cpuProcessor, spec, img);
+                    ProcessImage(m, cpuProcessor, spec, img, numThreads);
                 }
             }
 
@@ -628,7 +760,14 @@ int main(int argc, const char **argv)
 
                 // Apply the color transformation.
                 m.resume();
-                cpuProcessor->apply(*srcImgDesc, *dstImgDesc);
+                if (numThreads == 1)
+                {
+                    cpuProcessor->apply(*srcImgDesc, *dstImgDesc);
+                }
+                else
+                {
+                    cpuProcessor->apply(*srcImgDesc, *dstImgDesc, numThreads);
+                }
                 m.pause();
             }
 
@@ -40,22 +40,39 @@ void bindPyCPUProcessor(py::module & m)
             },
              "srcImgDesc"_a, "dstImgDesc"_a,
              py::call_guard<py::gil_scoped_release>())
+        .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc, unsigned numThreads) 
+            {
+                self->apply((*imgDesc.m_img), numThreads);
+            },
+             "imgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>())
+        .def("apply", [](CPUProcessorRcPtr & self, 
+                         PyImageDesc & srcImgDesc, 
+                         PyImageDesc & dstImgDesc,
+                         unsigned numThreads)
+            {
+                self->apply((*srcImgDesc.m_img), (*dstImgDesc.m_img), numThreads);
+            },
+             "srcImgDesc"_a, "dstImgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>())
         .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & pixel) 
             {
                 py::buffer_info info = pixel.request();
                 checkBufferType(info, py::dtype("float32"));
                 checkBufferDivisible(info, 3);
+                checkBufferContiguous(info);
 
                 py::gil_scoped_release release;
 
-                self->applyRGB(static_cast<float *>(info.ptr));
+                // Process all the pixels at once (e.g. a Nx3 numpy array).
+                self->applyRGBs(static_cast<float *>(info.ptr), static_cast<size_t>(info.size / 3));
                 return pixel;
             },
              "pixel"_a)
         .def("applyRGB", [](CPUProcessorRcPtr & self, std::vector<float> & pixel) 
             {
                 checkVectorDivisible(pixel, 3);
-                self->applyRGB(pixel.data());
+                self->applyRGBs(pixel.data(), pixel.size() / 3);
                 return pixel;
             },
              "pixel"_a,
@@ -65,17 +82,19 @@ void bindPyCPUProcessor(py::module & m)
                 py::buffer_info info = pixel.request();
                 checkBufferType(info, py::dtype("float32"));
                 checkBufferDivisible(info, 4);
+                checkBufferContiguous(info);
 
                 py::gil_scoped_release release;
 
-                self->applyRGBA(static_cast<float *>(info.ptr));
+                // Process all the pixels at once (e.g. a Nx4 numpy array).
+                self->applyRGBAs(static_cast<float *>(info.ptr), static_cast<size_t>(info.size / 4));
                 return pixel;
             },
              "pixel"_a)
         .def("applyRGBA", [](CPUProcessorRcPtr & self, std::vector<float> & pixel) 
             {
                 checkVectorDivisible(pixel, 4);
-                self->applyRGBA(pixel.data());
+                self->applyRGBAs(pixel.data(), pixel.size() / 4);
                 return pixel;
             },
              "pixel"_a,
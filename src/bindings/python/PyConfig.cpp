@@ -373,7 +373,13 @@ void bindPyConfig(py::module & m)
                     "srcContext"_a, "srcConfig"_a, "srcColorSpaceName"_a, "srcInterchangeName"_a, 
                     "dstContext"_a, "dstConfig"_a, "dstColorSpaceName"_a, "dstInterchangeName"_a)
 
-        .def("setProcessorCacheFlags", &Config::setProcessorCacheFlags, "flags"_a);
+        .def("setProcessorCacheFlags", &Config::setProcessorCacheFlags, "flags"_a)
+        .def("setProcessorCacheCapacity", &Config::setProcessorCacheCapacity,
+             "maxEntries"_a, "maxBytes"_a)
+        .def("getProcessorCacheMaxEntries", &Config::getProcessorCacheMaxEntries)
+        .def("getProcessorCacheMaxBytes", &Config::getProcessorCacheMaxBytes)
+        .def("getProcessorCacheStats", &Config::getProcessorCacheStats)
+        .def("resetProcessorCacheStats", &Config::resetProcessorCacheStats);
 
     defStr(cls);
 
@@ -14,6 +14,18 @@ PYBIND11_MODULE(PyOpenColorIO, m)
 
     // Global
     m.def("ClearAllCaches", &ClearAllCaches);
+    m.def("SetCPUProcessorBlockSize", &SetCPUProcessorBlockSize, "numPixels"_a);
+    m.def("GetCPUProcessorBlockSize", &GetCPUProcessorBlockSize);
+    m.def("SetLut3DBakeMaxError", &SetLut3DBakeMaxError, "maxError"_a);
+    m.def("GetLut3DBakeMaxError", &GetLut3DBakeMaxError);
+    m.def("SetFileCacheCapacity", &SetFileCacheCapacity, "maxEntries"_a, "maxBytes"_a);
+    m.def("GetFileCacheMaxEntries", &GetFileCacheMaxEntries);
+    m.def("GetFileCacheMaxBytes", &GetFileCacheMaxBytes);
+    m.def("GetFileCacheStats", &GetFileCacheStats);
+    m.def("GetFileHashCacheStats", &GetFileHashCacheStats);
+    m.def("GetLut3DInverseCacheStats", &GetLut3DInverseCacheStats);
+    m.def("GetLut3DComposeCacheStats", &GetLut3DComposeCacheStats);
+    m.def("ResetGlobalCacheStats", &ResetGlobalCacheStats);
     m.def("GetVersion", &GetVersion);
     m.def("GetVersionHex", &GetVersionHex);
     m.def("GetLoggingLevel", &GetLoggingLevel);
@@ -86,7 +86,13 @@ void bindPyProcessor(py::module & m)
         .def("getOptimizedCPUProcessor", 
              (ConstCPUProcessorRcPtr (Processor::*)(BitDepth, BitDepth, OptimizationFlags) const) 
              &Processor::getOptimizedCPUProcessor, 
-             "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a);
+             "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a)
+
+        // Caches
+        .def("getOptimizedProcessorCacheStats", &Processor::getOptimizedProcessorCacheStats)
+        .def("getGPUProcessorCacheStats", &Processor::getGPUProcessorCacheStats)
+        .def("getCPUProcessorCacheStats", &Processor::getCPUProcessorCacheStats)
+        .def("resetCacheStats", &Processor::resetCacheStats);
 
     py::class_<TransformFormatMetadataIterator>(cls, "TransformFormatMetadataIterator")
         .def("__len__", [](TransformFormatMetadataIterator & it) 
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <sstream>
+
 #include "PyOpenColorIO.h"
 
 namespace OCIO_NAMESPACE
@@ -149,6 +151,8 @@ void bindPyTypes(py::module & m)
         .value("FIXED_FUNCTION_XYZ_TO_xyY", FIXED_FUNCTION_XYZ_TO_xyY)
         .value("FIXED_FUNCTION_XYZ_TO_uvY", FIXED_FUNCTION_XYZ_TO_uvY)
         .value("FIXED_FUNCTION_XYZ_TO_LUV", FIXED_FUNCTION_XYZ_TO_LUV)
+        .value("FIXED_FUNCTION_LIN_TO_PQ", FIXED_FUNCTION_LIN_TO_PQ)
+        .value("FIXED_FUNCTION_LIN_TO_HLG", FIXED_FUNCTION_LIN_TO_HLG)
         .export_values();
 
     py::enum_<ExposureContrastStyle>(m, "ExposureContrastStyle")
@@ -197,6 +201,8 @@ void bindPyTypes(py::module & m)
         .value("OPTIMIZATION_PAIR_IDENTITY_LUT3D", OPTIMIZATION_PAIR_IDENTITY_LUT3D)
         .value("OPTIMIZATION_PAIR_IDENTITY_LOG", OPTIMIZATION_PAIR_IDENTITY_LOG)
         .value("OPTIMIZATION_PAIR_IDENTITY_GRADING", OPTIMIZATION_PAIR_IDENTITY_GRADING)
+        .value("OPTIMIZATION_DRAFT_LOG_EXP_POW", OPTIMIZATION_DRAFT_LOG_EXP_POW)
+        .value("OPTIMIZATION_ACCURATE_LOG_EXP_POW", OPTIMIZATION_ACCURATE_LOG_EXP_POW)
         .value("OPTIMIZATION_COMP_EXPONENT", OPTIMIZATION_COMP_EXPONENT)
         .value("OPTIMIZATION_COMP_GAMMA", OPTIMIZATION_COMP_GAMMA)
         .value("OPTIMIZATION_COMP_MATRIX", OPTIMIZATION_COMP_MATRIX)
@@ -208,6 +214,9 @@ void bindPyTypes(py::module & m)
         .value("OPTIMIZATION_FAST_LOG_EXP_POW", OPTIMIZATION_FAST_LOG_EXP_POW)
         .value("OPTIMIZATION_SIMPLIFY_OPS", OPTIMIZATION_SIMPLIFY_OPS)
         .value("OPTIMIZATION_NO_DYNAMIC_PROPERTIES", OPTIMIZATION_NO_DYNAMIC_PROPERTIES)
+        .value("OPTIMIZATION_BAKE_LUT3D", OPTIMIZATION_BAKE_LUT3D)
+        .value("OPTIMIZATION_LUT_HALF_STORAGE", OPTIMIZATION_LUT_HALF_STORAGE)
+        .value("OPTIMIZATION_LUT_INV_REFINE", OPTIMIZATION_LUT_INV_REFINE)
         .value("OPTIMIZATION_ALL", OPTIMIZATION_ALL)
         .value("OPTIMIZATION_LOSSLESS", OPTIMIZATION_LOSSLESS)
         .value("OPTIMIZATION_VERY_GOOD", OPTIMIZATION_VERY_GOOD)
@@ -271,6 +280,21 @@ void bindPyTypes(py::module & m)
     m.def("NegativeStyleToString", &NegativeStyleToString, "style"_a);
     m.def("NegativeStyleFromString", &NegativeStyleFromString, "str"_a);
 
+    // CacheStats
+    py::class_<CacheStats>(m, "CacheStats")
+        .def_readonly("hits", &CacheStats::m_hits)
+        .def_readonly("misses", &CacheStats::m_misses)
+        .def_readonly("inserts", &CacheStats::m_inserts)
+        .def_readonly("evictions", &CacheStats::m_evictions)
+        .def_readonly("entries", &CacheStats::m_entries)
+        .def_readonly("bytes", &CacheStats::m_bytes)
+        .def("__repr__", [](const CacheStats & self)
+            {
+                std::ostringstream os;
+                os << self;
+                return os.str();
+            });
+
     // Env. variables
     m.attr("OCIO_CONFIG_ENVVAR") = OCIO_CONFIG_ENVVAR;
     m.attr("OCIO_ACTIVE_DISPLAYS_ENVVAR") = OCIO_ACTIVE_DISPLAYS_ENVVAR;
@@ -179,6 +179,23 @@ void checkBufferSize(const py::buffer_info & info, ssize_t numEntries)
     }
 }
 
+void checkBufferContiguous(const py::buffer_info & info)
+{
+    ssize_t expectedStride = info.itemsize;
+    for (ssize_t i = info.ndim - 1; i >= 0; --i)
+    {
+        // The stride of a dimension of size 1 is irrelevant.
+        if (info.shape[i] != 1 && info.strides[i] != expectedStride)
+        {
+            std::ostringstream os;
+            os << "Incompatible buffer layout: expected C-contiguous entries, but received ";
+            os << "strides of " << info.strides[i] << " bytes for dimension " << i;
+            throw std::runtime_error(os.str().c_str());
+        }
+        expectedStride *= info.shape[i];
+    }
+}
+
 unsigned long getBufferLut3DGridSize(const py::buffer_info & info)
 {
     checkBufferDivisible(info, 3);
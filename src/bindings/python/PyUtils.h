@@ -69,6 +69,8 @@ void checkBufferType(const py::buffer_info & info, BitDepth bitDepth);
 void checkBufferDivisible(const py::buffer_info & info, ssize_t numChannels);
 // Throw if Python buffer does not have an exact count of entries
 void checkBufferSize(const py::buffer_info & info, ssize_t numEntries);
+// Throw if Python buffer entries are not contiguous in C order (e.g. a sliced NumPy array)
+void checkBufferContiguous(const py::buffer_info & info);
 
 // Calculate 3D grid size from a packed 3D LUT buffer
 unsigned long getBufferLut3DGridSize(const py::buffer_info & info);
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cstring>
+
+#include "CPUInfo.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(CPUInfo, instance)
+{
+    const OCIO::CPUInfo & info = OCIO::CPUInfo::Instance();
+    OCIO_CHECK_EQUAL(&info, &OCIO::CPUInfo::Instance());
+
+    // The AVX-512 detection implies the AVX2 one.
+    if (info.hasAVX512())
+    {
+        OCIO_CHECK_ASSERT(info.hasAVX2());
+    }
+
+    OCIO_CHECK_ASSERT(std::strlen(info.getVendor()) <= 12);
+}
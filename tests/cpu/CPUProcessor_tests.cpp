@@ -29,6 +29,100 @@ OCIO_ADD_TEST(CPUProcessor, flag_composition)
                      OCIO::OPTIMIZATION_COMP_LUT1D);
 }
 
+OCIO_ADD_TEST(CPUProcessor, log_exp_pow_precision)
+{
+    // The draft tier takes precedence over the fast one which takes precedence over the accurate
+    // one.
+
+    OCIO_CHECK_EQUAL(OCIO::GetLogExpPowPrecision(OCIO::OPTIMIZATION_LOSSLESS),
+                     OCIO::LOG_EXP_POW_STD);
+    OCIO_CHECK_EQUAL(OCIO::GetLogExpPowPrecision(OCIO::OPTIMIZATION_VERY_GOOD),
+                     OCIO::LOG_EXP_POW_FAST);
+    OCIO_CHECK_EQUAL(OCIO::GetLogExpPowPrecision(OCIO::OPTIMIZATION_ACCURATE_LOG_EXP_POW),
+                     OCIO::LOG_EXP_POW_ACCURATE);
+    OCIO_CHECK_EQUAL(OCIO::GetLogExpPowPrecision(
+                        OCIO::OptimizationFlags(OCIO::OPTIMIZATION_VERY_GOOD
+                                                | OCIO::OPTIMIZATION_ACCURATE_LOG_EXP_POW)),
+                     OCIO::LOG_EXP_POW_FAST);
+    OCIO_CHECK_EQUAL(OCIO::GetLogExpPowPrecision(
+                        OCIO::OptimizationFlags(OCIO::OPTIMIZATION_VERY_GOOD
+                                                | OCIO::OPTIMIZATION_DRAFT_LOG_EXP_POW)),
+                     OCIO::LOG_EXP_POW_DRAFT);
+
+    // The conflicting draft and accurate tiers (e.g. set by OPTIMIZATION_ALL) resolve to the
+    // fast tier.
+    OCIO_CHECK_EQUAL(OCIO::GetLogExpPowPrecision(
+                        OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DRAFT_LOG_EXP_POW
+                                                | OCIO::OPTIMIZATION_ACCURATE_LOG_EXP_POW)),
+                     OCIO::LOG_EXP_POW_FAST);
+    OCIO_CHECK_EQUAL(OCIO::GetLogExpPowPrecision(OCIO::OPTIMIZATION_ALL),
+                     OCIO::LOG_EXP_POW_FAST);
+    OCIO_CHECK_ASSERT(!(OCIO::OPTIMIZATION_DRAFT & OCIO::OPTIMIZATION_ACCURATE_LOG_EXP_POW));
+    OCIO_CHECK_EQUAL(OCIO::GetLogExpPowPrecision(OCIO::OPTIMIZATION_DRAFT),
+                     OCIO::LOG_EXP_POW_DRAFT);
+
+    // Each tier stays within its error bound from the std:: functions.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.4, 2.6, 1.0 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    OCIO::LogTransformRcPtr log = OCIO::LogTransform::Create();
+    log->setBase(10.);
+    group->appendTransform(log);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    constexpr long numPixels = 256;
+    std::vector<float> inImg(numPixels * 4);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        inImg[4 * idx + 0] = 0.05f + 4.f * float(idx) / float(numPixels);
+        inImg[4 * idx + 1] = 0.5f * inImg[4 * idx + 0];
+        inImg[4 * idx + 2] = 2.0f * inImg[4 * idx + 0];
+        inImg[4 * idx + 3] = 1.0f;
+    }
+
+    auto applyWithFlags = [&](OCIO::OptimizationFlags flags) -> std::vector<float>
+    {
+        std::vector<float> outImg(inImg);
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32, flags);
+        OCIO::PackedImageDesc desc(&outImg[0], numPixels, 1, 4);
+        cpuProcessor->apply(desc);
+        return outImg;
+    };
+
+    const std::vector<float> expected = applyWithFlags(OCIO::OPTIMIZATION_LOSSLESS);
+
+    const struct
+    {
+        OCIO::OptimizationFlags flags;
+        float threshold;
+    } tiers[] = {
+        { OCIO::OptimizationFlags(OCIO::OPTIMIZATION_LOSSLESS
+                                  | OCIO::OPTIMIZATION_ACCURATE_LOG_EXP_POW), 1e-6f },
+        { OCIO::OptimizationFlags(OCIO::OPTIMIZATION_LOSSLESS
+                                  | OCIO::OPTIMIZATION_FAST_LOG_EXP_POW),     1e-4f },
+        { OCIO::OptimizationFlags(OCIO::OPTIMIZATION_LOSSLESS
+                                  | OCIO::OPTIMIZATION_DRAFT_LOG_EXP_POW),    1e-3f },
+    };
+
+    for (const auto & tier : tiers)
+    {
+        const std::vector<float> outImg = applyWithFlags(tier.flags);
+        for (size_t idx = 0; idx < outImg.size(); ++idx)
+        {
+            OCIO_CHECK_CLOSE(outImg[idx], expected[idx], tier.threshold);
+        }
+    }
+}
+
 
 // TODO: CPUProcessor being part of the OCIO public API limits the ability
 //       to inspect the CPUProcessor instance content i.e. the list of CPUOps.
@@ -817,7 +911,7 @@ OCIO_ADD_TEST(CPUProcessor, with_several_ops)
             const std::string cacheID{ cpuProcessor->getCacheID() };
 
             const std::string expectedID("CPU Processor: from 16ui to 32f oFlags 263995331 ops"
-                ": <Lut1D $a57d7444e629d796d2234c18a0539c74 forward default standard domain none>");
+                ": <Lut1D $bdd466139eb2f2622a7ebba0ad5e88d7 forward default standard domain none>");
 
             // Test integer optimization. The ops should be optimized into a single LUT
             // when finalizing with an integer input bit-depth.
@@ -2198,3 +2292,1107 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
     }
 }
 
+
+namespace
+{
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ValidateMultiThreadedApply(OCIO::ConstProcessorRcPtr & processor, unsigned lineNo)
+{
+    typedef typename OCIO::BitDepthInfo<inBD>::Type InType;
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW_FROM(cpuProcessor
+        = processor->getOptimizedCPUProcessor(inBD, outBD, OCIO::OPTIMIZATION_DEFAULT), lineNo);
+
+    // Use an odd number of lines so the bands do not all have the same size.
+    constexpr long width  = 67;
+    constexpr long height = 41;
+    constexpr size_t numValues = size_t(width * height * 4);
+
+    std::vector<InType> inImg(numValues);
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        const float value = float(idx % 997) / 900.0f - 0.05f;
+        if (OCIO::BitDepthInfo<inBD>::isFloat)
+        {
+            inImg[idx] = InType(value);
+        }
+        else
+        {
+            const float maxValue = float(OCIO::BitDepthInfo<inBD>::maxValue);
+            inImg[idx] = InType(std::max(0.0f, std::min(value, 1.0f)) * maxValue);
+        }
+    }
+
+    const OCIO::PackedImageDesc srcImgDesc(&inImg[0], width, height, 4, inBD,
+                                           sizeof(InType), OCIO::AutoStride, OCIO::AutoStride);
+
+    std::vector<OutType> refImg(numValues);
+    OCIO::PackedImageDesc refImgDesc(&refImg[0], width, height, 4, outBD,
+                                     sizeof(OutType), OCIO::AutoStride, OCIO::AutoStride);
+
+    OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(srcImgDesc, refImgDesc), lineNo);
+
+    for (unsigned numThreads : { 0u, 1u, 2u, 3u, 16u, 100u })
+    {
+        std::vector<OutType> outImg(numValues);
+        OCIO::PackedImageDesc dstImgDesc(&outImg[0], width, height, 4, outBD,
+                                         sizeof(OutType), OCIO::AutoStride, OCIO::AutoStride);
+
+        OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(srcImgDesc, dstImgDesc, numThreads), lineNo);
+
+        // The results must be bit-identical to the single threaded ones.
+        OCIO_CHECK_EQUAL_FROM(std::memcmp(&outImg[0], &refImg[0], numValues * sizeof(OutType)),
+                              0, lineNo);
+    }
+
+    if (inBD == outBD)
+    {
+        // In-place processing.
+        std::vector<InType> img(inImg);
+        OCIO::PackedImageDesc imgDesc(&img[0], width, height, 4, inBD,
+                                      sizeof(InType), OCIO::AutoStride, OCIO::AutoStride);
+
+        OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(imgDesc, 0), lineNo);
+        OCIO_CHECK_EQUAL_FROM(std::memcmp(&img[0], &refImg[0], numValues * sizeof(InType)),
+                              0, lineNo);
+    }
+}
+
+} // anon
+
+OCIO_ADD_TEST(CPUProcessor, multi_threaded_apply)
+{
+    // The unit test validates that the multi-threaded apply produces exactly
+    // the same results than the single threaded one for all the bit-depths.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.7, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.3, 2.4, 1.0 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    OCIO::LogAffineTransformRcPtr log = OCIO::LogAffineTransform::Create();
+    constexpr double linOffset[3] = { 0.01, 0.01, 0.01 };
+    log->setLinSideOffsetValue(linOffset);
+    group->appendTransform(log);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+#define VALIDATE(inBD)                                                                  \
+    ValidateMultiThreadedApply<inBD, OCIO::BIT_DEPTH_UINT8>(processor, __LINE__);      \
+    ValidateMultiThreadedApply<inBD, OCIO::BIT_DEPTH_UINT10>(processor, __LINE__);     \
+    ValidateMultiThreadedApply<inBD, OCIO::BIT_DEPTH_UINT12>(processor, __LINE__);     \
+    ValidateMultiThreadedApply<inBD, OCIO::BIT_DEPTH_UINT16>(processor, __LINE__);     \
+    ValidateMultiThreadedApply<inBD, OCIO::BIT_DEPTH_F16>(processor, __LINE__);        \
+    ValidateMultiThreadedApply<inBD, OCIO::BIT_DEPTH_F32>(processor, __LINE__);
+
+    VALIDATE(OCIO::BIT_DEPTH_UINT8);
+    VALIDATE(OCIO::BIT_DEPTH_UINT10);
+    VALIDATE(OCIO::BIT_DEPTH_UINT12);
+    VALIDATE(OCIO::BIT_DEPTH_UINT16);
+    VALIDATE(OCIO::BIT_DEPTH_F16);
+    VALIDATE(OCIO::BIT_DEPTH_F32);
+
+#undef VALIDATE
+
+    // Planar in and out.
+    constexpr long width  = 5;
+    constexpr long height = 9;
+    std::vector<float> inR(width * height), inG(width * height), inB(width * height);
+    for (size_t idx = 0; idx < inR.size(); ++idx)
+    {
+        inR[idx] = float(idx) / float(inR.size());
+        inG[idx] = 1.0f - inR[idx];
+        inB[idx] = 0.5f * inR[idx];
+    }
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = processor->getDefaultCPUProcessor());
+
+    const OCIO::PlanarImageDesc srcImgDesc(&inR[0], &inG[0], &inB[0], nullptr, width, height);
+
+    std::vector<float> refR(width * height), refG(width * height), refB(width * height);
+    OCIO::PlanarImageDesc refImgDesc(&refR[0], &refG[0], &refB[0], nullptr, width, height);
+    OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, refImgDesc));
+
+    std::vector<float> outR(width * height), outG(width * height), outB(width * height);
+    OCIO::PlanarImageDesc dstImgDesc(&outR[0], &outG[0], &outB[0], nullptr, width, height);
+    OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, dstImgDesc, 4));
+
+    OCIO_CHECK_ASSERT(outR == refR);
+    OCIO_CHECK_ASSERT(outG == refG);
+    OCIO_CHECK_ASSERT(outB == refB);
+
+    // Errors are reported to the caller.
+    std::vector<float> badR(width), badG(width), badB(width);
+    OCIO::PlanarImageDesc badImgDesc(&badR[0], &badG[0], &badB[0], nullptr, width, 1);
+    OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(srcImgDesc, badImgDesc, 4),
+                          OCIO::Exception,
+                          "Dimension inconsistency between source and destination image buffers.");
+}
+
+namespace
+{
+
+// Restore the default block size when going out of scope.
+class BlockSizeGuard
+{
+public:
+    BlockSizeGuard() : m_blockSize(OCIO::GetCPUProcessorBlockSize()) {}
+    ~BlockSizeGuard() { OCIO::SetCPUProcessorBlockSize(m_blockSize); }
+
+private:
+    const unsigned m_blockSize;
+};
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ValidateBlockProcessing(OCIO::ConstProcessorRcPtr & processor, long width,
+                             OCIO::ChannelOrdering inChans, OCIO::ChannelOrdering outChans,
+                             unsigned lineNo)
+{
+    typedef typename OCIO::BitDepthInfo<inBD>::Type InType;
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW_FROM(cpuProcessor
+        = processor->getOptimizedCPUProcessor(inBD, outBD, OCIO::OPTIMIZATION_DEFAULT), lineNo);
+
+    constexpr long height = 3;
+
+    const size_t numInChans
+        = (inChans == OCIO::CHANNEL_ORDERING_RGB || inChans == OCIO::CHANNEL_ORDERING_BGR) ? 3 : 4;
+    const size_t numOutChans
+        = (outChans == OCIO::CHANNEL_ORDERING_RGB || outChans == OCIO::CHANNEL_ORDERING_BGR) ? 3 : 4;
+
+    std::vector<InType> inImg(width * height * numInChans);
+    for (size_t idx = 0; idx < inImg.size(); ++idx)
+    {
+        const float value = float(idx % 251) / 250.0f;
+        inImg[idx] = OCIO::BitDepthInfo<inBD>::isFloat
+                        ? InType(value)
+                        : InType(value * float(OCIO::BitDepthInfo<inBD>::maxValue));
+    }
+
+    const OCIO::PackedImageDesc srcImgDesc(&inImg[0], width, height, inChans, inBD,
+                                           OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+
+    BlockSizeGuard guard;
+
+    // Process complete lines.
+    OCIO::SetCPUProcessorBlockSize(0);
+
+    std::vector<OutType> refImg(width * height * numOutChans);
+    OCIO::PackedImageDesc refImgDesc(&refImg[0], width, height, outChans, outBD,
+                                     OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(srcImgDesc, refImgDesc), lineNo);
+
+    for (unsigned blockSize : { 1u, 7u, 64u, 256u, 1000u })
+    {
+        OCIO::SetCPUProcessorBlockSize(blockSize);
+
+        std::vector<OutType> outImg(width * height * numOutChans);
+        OCIO::PackedImageDesc dstImgDesc(&outImg[0], width, height, outChans, outBD,
+                                         OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(srcImgDesc, dstImgDesc), lineNo);
+
+        OCIO_CHECK_EQUAL_FROM(std::memcmp(&outImg[0], &refImg[0], outImg.size() * sizeof(OutType)),
+                              0, lineNo);
+
+        if (inBD == outBD && inChans == outChans)
+        {
+            // In-place processing.
+            std::vector<InType> img(inImg);
+            OCIO::PackedImageDesc imgDesc(&img[0], width, height, inChans, inBD,
+                                          OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+            OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(imgDesc), lineNo);
+
+            OCIO_CHECK_EQUAL_FROM(std::memcmp(&img[0], &refImg[0], img.size() * sizeof(InType)),
+                                  0, lineNo);
+        }
+    }
+}
+
+} // anon
+
+OCIO_ADD_TEST(CPUProcessor, block_processing)
+{
+    // The unit test validates that processing the image lines in blocks of pixels
+    // produces exactly the same results than processing complete lines.
+
+    OCIO_CHECK_EQUAL(OCIO::GetNumBlockPixels(0, 100), 100);
+    OCIO_CHECK_EQUAL(OCIO::GetNumBlockPixels(64, 100), 64);
+    OCIO_CHECK_EQUAL(OCIO::GetNumBlockPixels(256, 100), 100);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.7, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.3, 2.4, 1.0 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.1);
+    range->setMinOutValue(0.1);
+    group->appendTransform(range);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    for (long width : { 1L, 5L, 256L, 300L, 1031L })
+    {
+        ValidateBlockProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(
+            processor, width, OCIO::CHANNEL_ORDERING_RGBA, OCIO::CHANNEL_ORDERING_RGBA, __LINE__);
+
+        ValidateBlockProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(
+            processor, width, OCIO::CHANNEL_ORDERING_BGR, OCIO::CHANNEL_ORDERING_RGBA, __LINE__);
+
+        ValidateBlockProcessing<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT8>(
+            processor, width, OCIO::CHANNEL_ORDERING_BGRA, OCIO::CHANNEL_ORDERING_BGRA, __LINE__);
+
+        ValidateBlockProcessing<OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_F32>(
+            processor, width, OCIO::CHANNEL_ORDERING_RGBA, OCIO::CHANNEL_ORDERING_RGB, __LINE__);
+
+        ValidateBlockProcessing<OCIO::BIT_DEPTH_F16, OCIO::BIT_DEPTH_UINT10>(
+            processor, width, OCIO::CHANNEL_ORDERING_ABGR, OCIO::CHANNEL_ORDERING_RGBA, __LINE__);
+
+        ValidateBlockProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F16>(
+            processor, width, OCIO::CHANNEL_ORDERING_RGBA, OCIO::CHANNEL_ORDERING_BGRA, __LINE__);
+    }
+
+    // The block processing also applies to the multi-threaded processing.
+    BlockSizeGuard guard;
+    OCIO::SetCPUProcessorBlockSize(16);
+    OCIO_CHECK_EQUAL(OCIO::GetCPUProcessorBlockSize(), 16u);
+    ValidateMultiThreadedApply<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F32>(processor, __LINE__);
+    ValidateMultiThreadedApply<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, __LINE__);
+}
+
+OCIO_ADD_TEST(CPUProcessor, planar_processing)
+{
+    // The unit test validates that the planar F32 images (i.e. processed without packing the
+    // pixels) produce the same results as the packed RGBA images.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.1,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.7, 0.0,
+                                 0.0, 0.0, 0.1, 0.9 };
+    constexpr double offset4[4] = { 0.01, 0.02, 0.03, 0.0 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset4);
+    group->appendTransform(matrix);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.1);
+    range->setMinOutValue(0.05);
+    range->setMaxInValue(0.9);
+    range->setMaxOutValue(1.1);
+    group->appendTransform(range);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.3, 2.4, 1.0 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    double scaleM44[16];
+    double scaleOffset4[4];
+    constexpr double scale4[4] = { 0.5, 1.5, 2.0, 0.9 };
+    OCIO::MatrixTransform::Scale(scaleM44, scaleOffset4, scale4);
+
+    OCIO::MatrixTransformRcPtr scale = OCIO::MatrixTransform::Create();
+    scale->setMatrix(scaleM44);
+    scale->setOffset(offset4);
+    group->appendTransform(scale);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = processor->getDefaultCPUProcessor());
+
+    constexpr long width  = 301;
+    constexpr long height = 3;
+    constexpr long numPixels = width * height;
+
+    std::vector<float> src(4 * numPixels);
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        src[idx] = float(idx % 251) / 200.0f - 0.1f;
+    }
+
+    // Reference results from the packed RGBA & RGB images.
+
+    std::vector<float> refRGBA(src);
+    OCIO::PackedImageDesc refRGBADesc(&refRGBA[0], width, height, 4);
+    OCIO_CHECK_NO_THROW(cpuProcessor->apply(refRGBADesc));
+
+    std::vector<float> refRGB(3 * numPixels);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        refRGB[3 * idx + 0] = src[4 * idx + 0];
+        refRGB[3 * idx + 1] = src[4 * idx + 1];
+        refRGB[3 * idx + 2] = src[4 * idx + 2];
+    }
+    OCIO::PackedImageDesc refRGBDesc(&refRGB[0], width, height, 3);
+    OCIO_CHECK_NO_THROW(cpuProcessor->apply(refRGBDesc));
+
+    // Split the source image in planes.
+
+    std::vector<float> srcPlanes[4];
+    for (int chan = 0; chan < 4; ++chan)
+    {
+        srcPlanes[chan].resize(numPixels);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            srcPlanes[chan][idx] = src[4 * idx + chan];
+        }
+    }
+
+    const auto checkPlanes = [&](const std::vector<float> (&planes)[4], bool hasAlpha,
+                                 unsigned lineNo)
+    {
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (int chan = 0; chan < (hasAlpha ? 4 : 3); ++chan)
+            {
+                const float ref = hasAlpha ? refRGBA[4 * idx + chan] : refRGB[3 * idx + chan];
+                OCIO_CHECK_EQUAL_FROM(planes[chan][idx], ref, lineNo);
+            }
+        }
+    };
+
+    {
+        // From the source planes to the destination planes.
+
+        std::vector<float> dstPlanes[4];
+        for (auto & plane : dstPlanes)
+        {
+            plane.resize(numPixels, -1.0f);
+        }
+
+        OCIO::PlanarImageDesc srcDesc(&srcPlanes[0][0], &srcPlanes[1][0],
+                                      &srcPlanes[2][0], &srcPlanes[3][0], width, height);
+        OCIO::PlanarImageDesc dstDesc(&dstPlanes[0][0], &dstPlanes[1][0],
+                                      &dstPlanes[2][0], &dstPlanes[3][0], width, height);
+
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, dstDesc));
+        checkPlanes(dstPlanes, true, __LINE__);
+
+        // The source image is unchanged.
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            OCIO_CHECK_EQUAL(srcPlanes[0][idx], src[4 * idx]);
+        }
+    }
+
+    {
+        // In-place processing, in blocks of pixels & with several threads.
+
+        BlockSizeGuard guard;
+        OCIO::SetCPUProcessorBlockSize(64);
+
+        std::vector<float> planes[4] = { srcPlanes[0], srcPlanes[1], srcPlanes[2], srcPlanes[3] };
+
+        OCIO::PlanarImageDesc desc(&planes[0][0], &planes[1][0],
+                                   &planes[2][0], &planes[3][0], width, height);
+
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc, 2));
+        checkPlanes(planes, true, __LINE__);
+    }
+
+    {
+        // Planes without alpha.
+
+        std::vector<float> planes[4] = { srcPlanes[0], srcPlanes[1], srcPlanes[2], {} };
+
+        OCIO::PlanarImageDesc desc(&planes[0][0], &planes[1][0], &planes[2][0], nullptr,
+                                   width, height);
+
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc));
+        checkPlanes(planes, false, __LINE__);
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, apply_rgbs)
+{
+    // The unit test validates the processing of arrays of RGB & RGBA pixels against the
+    // image processing and the single pixel processing.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.7, 0.1,
+                                 0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.3, 2.4, 1.0 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = processor->getDefaultCPUProcessor());
+
+    constexpr size_t numPixels = 1031;
+
+    std::vector<float> rgba(4 * numPixels);
+    for (size_t idx = 0; idx < rgba.size(); ++idx)
+    {
+        rgba[idx] = float(idx % 97) / 80.0f;
+    }
+
+    std::vector<float> rgb(3 * numPixels);
+    for (size_t idx = 0; idx < numPixels; ++idx)
+    {
+        rgb[3 * idx + 0] = rgba[4 * idx + 0];
+        rgb[3 * idx + 1] = rgba[4 * idx + 1];
+        rgb[3 * idx + 2] = rgba[4 * idx + 2];
+    }
+
+    {
+        std::vector<float> res(rgba);
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBAs(&res[0], numPixels));
+
+        std::vector<float> ref(rgba);
+        OCIO::PackedImageDesc desc(&ref[0], long(numPixels), 1, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc));
+
+        OCIO_CHECK_ASSERT(res == ref);
+
+        std::vector<float> pixel(rgba.begin() + 4 * 17, rgba.begin() + 4 * 18);
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBA(&pixel[0]));
+        OCIO_CHECK_ASSERT(std::equal(pixel.begin(), pixel.end(), ref.begin() + 4 * 17));
+    }
+
+    {
+        std::vector<float> res(rgb);
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBs(&res[0], numPixels));
+
+        std::vector<float> ref(rgb);
+        OCIO::PackedImageDesc desc(&ref[0], long(numPixels), 1, 3);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc));
+
+        OCIO_CHECK_ASSERT(res == ref);
+
+        // The single pixel only holds three values.
+        std::vector<float> pixel(rgb.begin() + 3 * 17, rgb.begin() + 3 * 18);
+        OCIO_CHECK_NO_THROW(cpuProcessor->applyRGB(&pixel[0]));
+        OCIO_CHECK_ASSERT(std::equal(pixel.begin(), pixel.end(), ref.begin() + 3 * 17));
+    }
+
+    // Nothing to process.
+    OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBAs(nullptr, 0));
+    OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBs(nullptr, 0));
+}
+
+OCIO_ADD_TEST(CPUProcessor, scanline_helper_reuse)
+{
+    // The unit test validates that the scanline helpers reused by the successive processings
+    // (i.e. with different processors, image sizes & block sizes) still produce the right
+    // results, using the processing of pixel arrays as reference.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.7, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.3, 2.4, 1.0 };
+    exponent->setValue(gamma);
+
+    OCIO::ConstCPUProcessorRcPtr cpuMatrix, cpuExponent;
+    OCIO_CHECK_NO_THROW(cpuMatrix = config->getProcessor(matrix)->getDefaultCPUProcessor());
+    OCIO_CHECK_NO_THROW(cpuExponent = config->getProcessor(exponent)->getDefaultCPUProcessor());
+
+    BlockSizeGuard guard;
+
+    const auto validate = [](OCIO::ConstCPUProcessorRcPtr & cpu, long width, long height,
+                             unsigned blockSize, unsigned lineNo)
+    {
+        OCIO::SetCPUProcessorBlockSize(blockSize);
+
+        std::vector<float> img(3 * width * height);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = float(idx % 101) / 90.0f;
+        }
+
+        std::vector<float> ref(img);
+        cpu->applyRGBs(&ref[0], ref.size() / 3);
+
+        OCIO::PackedImageDesc desc(&img[0], width, height, 3);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(desc), lineNo);
+        OCIO_CHECK_ASSERT_FROM(img == ref, lineNo);
+    };
+
+    validate(cpuMatrix,   300, 4,  0, __LINE__);
+    validate(cpuExponent,  10, 3,  0, __LINE__);
+    validate(cpuMatrix,   300, 2, 16, __LINE__);
+    validate(cpuExponent, 513, 2,  0, __LINE__);
+    validate(cpuMatrix,     7, 5,  0, __LINE__);
+}
+
+OCIO_ADD_TEST(CPUProcessor, apply_roi)
+{
+    // The unit test validates that only the regions of interest of the images are processed,
+    // with the same results as processing the complete images.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.9, 0.1, 0.0, 0.1,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.7, 0.0,
+                                 0.0, 0.0, 0.1, 0.9 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.3, 2.4, 1.0 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = processor->getDefaultCPUProcessor());
+
+    constexpr long width  = 37;
+    constexpr long height = 11;
+    constexpr long numPixels = width * height;
+
+    const OCIO::ImageROI roi(5, 3, 20, 6);
+
+    std::vector<float> src(4 * numPixels);
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        src[idx] = float(idx % 251) / 200.0f;
+    }
+
+    std::vector<float> ref(src);
+    OCIO::PackedImageDesc refDesc(&ref[0], width, height, 4);
+    OCIO_CHECK_NO_THROW(cpuProcessor->apply(refDesc));
+
+    const auto isInROI = [](const OCIO::ImageROI & r, long x, long y)
+    {
+        return x >= r.m_x && x < r.m_x + r.m_width && y >= r.m_y && y < r.m_y + r.m_height;
+    };
+
+    // Check the pixels of an image of width x height pixels in-place processed in the roi.
+    const auto checkInPlace = [&](const std::vector<float> & img, unsigned lineNo)
+    {
+        for (long y = 0; y < height; ++y)
+        {
+            for (long x = 0; x < width; ++x)
+            {
+                const long idx = 4 * (y * width + x);
+                const std::vector<float> & expected = isInROI(roi, x, y) ? ref : src;
+                for (long chan = 0; chan < 4; ++chan)
+                {
+                    OCIO_CHECK_EQUAL_FROM(img[idx + chan], expected[idx + chan], lineNo);
+                }
+            }
+        }
+    };
+
+    // In-place processing of a packed RGBA image, using one or several threads.
+
+    for (unsigned numThreads : { 1u, 3u })
+    {
+        std::vector<float> img(src);
+        OCIO::PackedImageDesc desc(&img[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc, roi, numThreads));
+        checkInPlace(img, __LINE__);
+    }
+
+    // In-place processing of a planar RGBA image.
+
+    {
+        std::vector<float> planes[4];
+        for (int chan = 0; chan < 4; ++chan)
+        {
+            planes[chan].resize(numPixels);
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                planes[chan][idx] = src[4 * idx + chan];
+            }
+        }
+
+        OCIO::PlanarImageDesc desc(&planes[0][0], &planes[1][0], &planes[2][0], &planes[3][0],
+                                   width, height);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(desc, roi));
+
+        std::vector<float> img(4 * numPixels);
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            for (int chan = 0; chan < 4; ++chan)
+            {
+                img[4 * idx + chan] = planes[chan][idx];
+            }
+        }
+        checkInPlace(img, __LINE__);
+    }
+
+    // Processing from a packed RGBA image to a smaller packed BGR image, where the regions
+    // of interest are at different positions.
+
+    {
+        constexpr long dstWidth  = 24;
+        constexpr long dstHeight = 8;
+        const OCIO::ImageROI dstROI(2, 1, roi.m_width, roi.m_height);
+
+        std::vector<float> dst(3 * dstWidth * dstHeight, -1.0f);
+        OCIO::PackedImageDesc srcDesc(&src[0], width, height, 4);
+        OCIO::PackedImageDesc dstDesc(&dst[0], dstWidth, dstHeight, OCIO::CHANNEL_ORDERING_BGR);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, roi, dstDesc, dstROI));
+
+        for (long y = 0; y < dstHeight; ++y)
+        {
+            for (long x = 0; x < dstWidth; ++x)
+            {
+                const long idx = 3 * (y * dstWidth + x);
+                if (isInROI(dstROI, x, y))
+                {
+                    const long refIdx
+                        = 4 * ((y - dstROI.m_y + roi.m_y) * width + x - dstROI.m_x + roi.m_x);
+                    OCIO_CHECK_EQUAL(dst[idx + 0], ref[refIdx + 2]);
+                    OCIO_CHECK_EQUAL(dst[idx + 1], ref[refIdx + 1]);
+                    OCIO_CHECK_EQUAL(dst[idx + 2], ref[refIdx + 0]);
+                }
+                else
+                {
+                    OCIO_CHECK_EQUAL(dst[idx + 0], -1.0f);
+                    OCIO_CHECK_EQUAL(dst[idx + 1], -1.0f);
+                    OCIO_CHECK_EQUAL(dst[idx + 2], -1.0f);
+                }
+            }
+        }
+    }
+
+    // Processing from a packed RGBA 8-bit image to a packed RGBA F32 image.
+
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessorUint8;
+        OCIO_CHECK_NO_THROW(cpuProcessorUint8
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F32,
+                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        std::vector<uint8_t> srcUint8(4 * numPixels);
+        for (long idx = 0; idx < 4 * numPixels; ++idx)
+        {
+            srcUint8[idx] = uint8_t(idx % 256);
+        }
+        OCIO::PackedImageDesc srcDesc(&srcUint8[0], width, height, 4,
+                                      OCIO::BIT_DEPTH_UINT8, 1, 4, 4 * width);
+
+        std::vector<float> refUint8(4 * numPixels);
+        OCIO::PackedImageDesc refUint8Desc(&refUint8[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessorUint8->apply(srcDesc, refUint8Desc));
+
+        std::vector<float> dst(4 * numPixels, -1.0f);
+        OCIO::PackedImageDesc dstDesc(&dst[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessorUint8->apply(srcDesc, roi, dstDesc, roi, 2));
+
+        for (long y = 0; y < height; ++y)
+        {
+            for (long x = 0; x < width; ++x)
+            {
+                const long idx = 4 * (y * width + x);
+                for (long chan = 0; chan < 4; ++chan)
+                {
+                    const float expected = isInROI(roi, x, y) ? refUint8[idx + chan] : -1.0f;
+                    OCIO_CHECK_EQUAL(dst[idx + chan], expected);
+                }
+            }
+        }
+    }
+
+    // Faulty regions of interest.
+
+    {
+        std::vector<float> img(src);
+        OCIO::PackedImageDesc desc(&img[0], width, height, 4);
+
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(desc, OCIO::ImageROI(30, 0, 8, 1)),
+                              OCIO::Exception, "is not inside the image buffer");
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(desc, OCIO::ImageROI(0, -1, 8, 1)),
+                              OCIO::Exception, "is not inside the image buffer");
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(desc, OCIO::ImageROI(0, 0, 0, 1)),
+                              OCIO::Exception, "is not inside the image buffer");
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(desc, roi, desc, OCIO::ImageROI(0, 0, 20, 5)),
+                              OCIO::Exception, "Dimension inconsistency");
+
+        // Nothing was processed.
+        OCIO_CHECK_ASSERT(img == src);
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, apply_async)
+{
+    // The unit test validates that the asynchronous processing gives the same results as the
+    // synchronous one, in the submission order, and that the errors are reported by the futures.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double gamma[4] = { 2.2, 2.3, 2.4, 1.0 };
+    exponent->setValue(gamma);
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(exponent));
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor
+        = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT16,
+                                              OCIO::OPTIMIZATION_DEFAULT));
+
+    constexpr long width  = 64;
+    constexpr long height = 23;
+    constexpr long numPixels = width * height;
+    constexpr size_t numFrames = 7;
+
+    std::vector<std::vector<float>> src(numFrames, std::vector<float>(4 * numPixels));
+    std::vector<std::vector<uint16_t>> ref(numFrames, std::vector<uint16_t>(4 * numPixels));
+    for (size_t frame = 0; frame < numFrames; ++frame)
+    {
+        for (long idx = 0; idx < 4 * numPixels; ++idx)
+        {
+            src[frame][idx] = float((idx + 13 * frame) % 251) / 250.0f;
+        }
+
+        OCIO::PackedImageDesc srcDesc(&src[frame][0], width, height, 4);
+        OCIO::PackedImageDesc refDesc(&ref[frame][0], width, height, 4,
+                                      OCIO::BIT_DEPTH_UINT16, 2, 8, 8 * width);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcDesc, refDesc));
+    }
+
+    // More frames than the queue capacity are submitted, using one or several threads.
+
+    for (unsigned numThreads : { 1u, 2u })
+    {
+        std::vector<std::vector<uint16_t>> dst(numFrames, std::vector<uint16_t>(4 * numPixels));
+        std::vector<std::future<void>> futures;
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            // The image descriptions are destroyed before the end of the processing.
+            OCIO::PackedImageDesc srcDesc(&src[frame][0], width, height, 4);
+            OCIO::PackedImageDesc dstDesc(&dst[frame][0], width, height, 4,
+                                          OCIO::BIT_DEPTH_UINT16, 2, 8, 8 * width);
+            futures.push_back(cpuProcessor->applyAsync(srcDesc, dstDesc, numThreads));
+        }
+
+        // The frames are processed in the submission order.
+        OCIO_CHECK_NO_THROW(futures.back().get());
+        for (size_t frame = 0; frame + 1 < numFrames; ++frame)
+        {
+            OCIO_CHECK_ASSERT(futures[frame].wait_for(std::chrono::seconds(0))
+                                == std::future_status::ready);
+            OCIO_CHECK_NO_THROW(futures[frame].get());
+        }
+
+        for (size_t frame = 0; frame < numFrames; ++frame)
+        {
+            OCIO_CHECK_ASSERT(dst[frame] == ref[frame]);
+        }
+    }
+
+    // An in-place processing.
+
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessorF32;
+        OCIO_CHECK_NO_THROW(cpuProcessorF32 = processor->getDefaultCPUProcessor());
+
+        std::vector<float> expected(src[0]);
+        OCIO::PackedImageDesc expectedDesc(&expected[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessorF32->apply(expectedDesc));
+
+        std::vector<float> img(src[0]);
+        OCIO::PackedImageDesc desc(&img[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessorF32->applyAsync(desc).get());
+        OCIO_CHECK_ASSERT(img == expected);
+    }
+
+    // The processing error is reported by the future and the next images are still processed.
+
+    {
+        std::vector<uint16_t> dst(4 * numPixels);
+        OCIO::PackedImageDesc srcDesc(&src[0][0], width, height, 4);
+        OCIO::PackedImageDesc faultyDesc(&dst[0], width, height, 4,
+                                         OCIO::BIT_DEPTH_UINT8, 1, 4, 4 * width);
+        OCIO::PackedImageDesc dstDesc(&dst[0], width, height, 4,
+                                      OCIO::BIT_DEPTH_UINT16, 2, 8, 8 * width);
+
+        std::future<void> faulty = cpuProcessor->applyAsync(srcDesc, faultyDesc);
+        std::future<void> valid  = cpuProcessor->applyAsync(srcDesc, dstDesc);
+
+        OCIO_CHECK_THROW_WHAT(faulty.get(), OCIO::Exception, "Bit-depth mismatch");
+        OCIO_CHECK_NO_THROW(valid.get());
+        OCIO_CHECK_ASSERT(dst == ref[0]);
+    }
+}
+
+#ifdef USE_AVX2
+
+namespace
+{
+
+void ValidatePackingAVX2(unsigned chanBytes, unsigned numChannels, const int (&chanIndex)[4],
+                         unsigned lineNo)
+{
+    for (long numPixels = 1; numPixels < 40; ++numPixels)
+    {
+        const size_t pxlBytes = numChannels * chanBytes;
+
+        std::vector<char> img(numPixels * pxlBytes);
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = char(idx * 7 + 3);
+        }
+
+        // Pack the interleaved pixels to RGBA pixels.
+
+        std::vector<char> rgba(numPixels * 4 * chanBytes, 'x');
+        OCIO::PackRGBA_AVX2(&img[0], &rgba[0], numPixels, chanBytes, numChannels, chanIndex);
+
+        for (long pxl = 0; pxl < numPixels; ++pxl)
+        {
+            for (unsigned chan = 0; chan < 4; ++chan)
+            {
+                for (unsigned byte = 0; byte < chanBytes; ++byte)
+                {
+                    const char expected = chanIndex[chan] < 0
+                        ? 0 : img[pxl * pxlBytes + chanIndex[chan] * chanBytes + byte];
+
+                    OCIO_CHECK_EQUAL_FROM(rgba[(pxl * 4 + chan) * chanBytes + byte],
+                                          expected, lineNo);
+                }
+            }
+        }
+
+        // Unpack them back.
+
+        std::vector<char> res(img.size(), 'x');
+        OCIO::UnpackRGBA_AVX2(&rgba[0], &res[0], numPixels, chanBytes, numChannels, chanIndex);
+
+        OCIO_CHECK_EQUAL_FROM(std::memcmp(&res[0], &img[0], img.size()), 0, lineNo);
+    }
+}
+
+} // anon
+
+OCIO_ADD_TEST(CPUProcessor, image_packing_avx2)
+{
+    // The unit test validates the AVX2 functions used to pack & unpack the interleaved images,
+    // and to convert their values from & to float values.
+
+    if (!OCIO::CPUInfo::Instance().hasAVX2())
+    {
+        return;
+    }
+
+    for (unsigned chanBytes : { 1u, 2u, 4u })
+    {
+        ValidatePackingAVX2(chanBytes, 3, {  0,  1,  2, -1 }, __LINE__);
+        ValidatePackingAVX2(chanBytes, 3, {  2,  1,  0, -1 }, __LINE__);
+        ValidatePackingAVX2(chanBytes, 4, {  0,  1,  2,  3 }, __LINE__);
+        ValidatePackingAVX2(chanBytes, 4, {  2,  1,  0,  3 }, __LINE__);
+        ValidatePackingAVX2(chanBytes, 4, {  3,  2,  1,  0 }, __LINE__);
+    }
+
+    // Validate the conversions to & from float values against the scalar ones.
+
+    std::vector<float> values;
+    for (int idx = -200; idx < 70000; ++idx)
+    {
+        values.push_back(float(idx) * 0.37f);
+    }
+    values.push_back(-std::numeric_limits<float>::infinity());
+    values.push_back(std::numeric_limits<float>::infinity());
+    values.push_back(std::numeric_limits<float>::max());
+    values.push_back(1e-8f);
+
+    const long numValues = (long)values.size();
+
+    {
+        const float scale = 1.0f / 255.0f;
+
+        std::vector<uint8_t> res(numValues);
+        OCIO::ConvertFromFloat_AVX2(&values[0], &res[0], numValues, 1.0f / scale, 255.0f);
+
+        std::vector<float> flt(numValues);
+        OCIO::ConvertToFloat_AVX2(&res[0], &flt[0], numValues, scale);
+
+        for (long idx = 0; idx < numValues; ++idx)
+        {
+            OCIO_CHECK_EQUAL(res[idx], OCIO::Converter<OCIO::BIT_DEPTH_UINT8>::CastValue(
+                                           values[idx] * (1.0f / scale)));
+            OCIO_CHECK_EQUAL(flt[idx], float(res[idx]) * scale);
+        }
+    }
+
+    {
+        const float scale = 1.0f / 1023.0f;
+
+        std::vector<uint16_t> res(numValues);
+        OCIO::ConvertFromFloat_AVX2(&values[0], &res[0], numValues, 1.0f / scale, 1023.0f);
+
+        std::vector<float> flt(numValues);
+        OCIO::ConvertToFloat_AVX2(&res[0], &flt[0], numValues, scale);
+
+        for (long idx = 0; idx < numValues; ++idx)
+        {
+            OCIO_CHECK_EQUAL(res[idx], OCIO::Converter<OCIO::BIT_DEPTH_UINT10>::CastValue(
+                                           values[idx] * (1.0f / scale)));
+            OCIO_CHECK_EQUAL(flt[idx], float(res[idx]) * scale);
+        }
+    }
+
+    {
+        std::vector<uint16_t> res(numValues);
+        OCIO::ConvertFromFloat_AVX2(&values[0], &res[0], numValues, 1.0f, 65535.0f);
+
+        for (long idx = 0; idx < numValues; ++idx)
+        {
+            OCIO_CHECK_EQUAL(res[idx], OCIO::Converter<OCIO::BIT_DEPTH_UINT16>::CastValue(values[idx]));
+        }
+    }
+
+    {
+        std::vector<uint16_t> res(numValues);
+        OCIO::ConvertFloatToHalf_AVX2(&values[0], &res[0], numValues);
+
+        for (long idx = 0; idx < numValues; ++idx)
+        {
+            OCIO_CHECK_EQUAL(res[idx], half(values[idx]).bits());
+        }
+    }
+
+    // Check all the half values (including an odd number of values).
+
+    std::vector<uint16_t> halfs(65535);
+    for (size_t idx = 0; idx < halfs.size(); ++idx)
+    {
+        halfs[idx] = uint16_t(idx);
+    }
+
+    std::vector<float> flt(halfs.size());
+    OCIO::ConvertHalfToFloat_AVX2(&halfs[0], &flt[0], (long)halfs.size());
+
+    for (size_t idx = 0; idx < halfs.size(); ++idx)
+    {
+        half h;
+        h.setBits(halfs[idx]);
+
+        if (h.isNan())
+        {
+            OCIO_CHECK_ASSERT(std::isnan(flt[idx]));
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL(flt[idx], float(h));
+        }
+    }
+}
+
+#endif // USE_AVX2
+
+OCIO_ADD_TEST(CPUProcessor, lut_half_storage)
+{
+    // The OPTIMIZATION_LUT_HALF_STORAGE flag stores the LUT values as half values.
+
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(33);
+    for (unsigned long r = 0; r < 33; ++r)
+    {
+        for (unsigned long g = 0; g < 33; ++g)
+        {
+            for (unsigned long b = 0; b < 33; ++b)
+            {
+                lut->setValue(r, g, b, std::sqrt(r / 32.f), std::sqrt(g / 32.f) * 0.9f,
+                              std::sqrt((r + b) / 64.f));
+            }
+        }
+    }
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(lut));
+
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE));
+    OCIO::ConstCPUProcessorRcPtr cpuHalf;
+    OCIO_CHECK_NO_THROW(cpuHalf = proc->getOptimizedCPUProcessor(
+                            OCIO::OptimizationFlags(OCIO::OPTIMIZATION_NONE
+                                                    | OCIO::OPTIMIZATION_LUT_HALF_STORAGE)));
+
+    constexpr long numPixels = 257;
+    std::vector<float> pixels(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        pixels[idx] = (float)((idx * 37) % 257) / 256.0f;
+    }
+
+    std::vector<float> results(pixels);
+    OCIO::PackedImageDesc desc(results.data(), numPixels, 1, 4);
+    cpu->apply(desc);
+
+    std::vector<float> resultsHalf(pixels);
+    OCIO::PackedImageDesc descHalf(resultsHalf.data(), numPixels, 1, 4);
+    cpuHalf->apply(descHalf);
+
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        OCIO_CHECK_CLOSE(resultsHalf[idx], results[idx], 4.9e-4f);
+    }
+
+    // Only the AVX2 renderers decode the half values.
+    const bool usesHalfValues = resultsHalf != results;
+#ifdef USE_AVX2
+    OCIO_CHECK_EQUAL(usesHalfValues, OCIO::CPUInfo::Instance().hasAVX2());
+#else
+    OCIO_CHECK_ASSERT(!usesHalfValues);
+#endif
+}
@@ -2,6 +2,10 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "Caching.cpp"
 
 #include "testutils/UnitTest.h"
@@ -139,3 +143,218 @@ OCIO_ADD_TEST(Caching, processor_cache)
     }
 }
 
+
+OCIO_ADD_TEST(Caching, generic_cache_get_or_create)
+{
+    // A unit test to check the creation of the cache entries.
+
+    OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+    std::atomic<int> numCreations{ 0 };
+    auto create = [&numCreations]() -> DataRcPtr
+    {
+        ++numCreations;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return std::make_shared<Data>();
+    };
+
+    // Concurrent requests of the same key only create the entry once.
+
+    DataRcPtr entry1, entry2;
+    std::thread thread1([&]() { entry1 = cache.getOrCreate("entry1", create); });
+    std::thread thread2([&]() { entry2 = cache.getOrCreate("entry1", create); });
+    thread1.join();
+    thread2.join();
+
+    OCIO_CHECK_EQUAL(numCreations.load(), 1);
+    OCIO_REQUIRE_ASSERT(entry1);
+    OCIO_CHECK_EQUAL(entry1, entry2);
+    OCIO_CHECK_EQUAL(cache.getOrCreate("entry1", create), entry1);
+    OCIO_CHECK_EQUAL(numCreations.load(), 1);
+
+    // The cache is not locked while an entry is created i.e. the creation of 'entry2' would
+    // never end if the creation of 'entry3' was waiting for it.
+
+    std::atomic<bool> entry3Created{ false };
+    auto waitEntry3 = [&entry3Created]() -> DataRcPtr
+    {
+        const auto start = std::chrono::steady_clock::now();
+        while (!entry3Created
+               && std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        DataRcPtr data = std::make_shared<Data>();
+        data->status = entry3Created;
+        return data;
+    };
+
+    std::thread thread3([&]() { entry2 = cache.getOrCreate("entry2", waitEntry3); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    cache.getOrCreate("entry3", [&entry3Created]() -> DataRcPtr
+    {
+        entry3Created = true;
+        return std::make_shared<Data>();
+    });
+    thread3.join();
+
+    OCIO_REQUIRE_ASSERT(entry2);
+    OCIO_CHECK_ASSERT(entry2->status);
+
+    // A failed creation does not add the entry.
+
+    OCIO_CHECK_THROW_WHAT(cache.getOrCreate("entry4", []() -> DataRcPtr
+                                            {
+                                                throw OCIO::Exception("Creation failed.");
+                                            }),
+                          OCIO::Exception,
+                          "Creation failed.");
+    {
+        OCIO::AutoMutex guard(cache.lock());
+        OCIO_CHECK_ASSERT(!cache.exists("entry4"));
+    }
+
+    // A disabled cache always creates the entry.
+
+    cache.enable(false);
+    OCIO_CHECK_ASSERT(cache.getOrCreate("entry1", create) != entry1);
+    OCIO_CHECK_EQUAL(numCreations.load(), 2);
+}
+
+OCIO_ADD_TEST(Caching, generic_cache_capacity)
+{
+    // A unit test to check the eviction of the least recently used entries.
+
+    using Cache = OCIO::GenericCache<std::string, DataRcPtr>;
+    Cache cache{ Cache::SizeEstimator(
+        [](const std::string & key, const DataRcPtr &) -> size_t { return key.size(); }) };
+    OCIO_CHECK_EQUAL(cache.getMaxEntries(), 0);
+    OCIO_CHECK_EQUAL(cache.getMaxBytes(), 0);
+
+    DataRcPtr entryA;
+    {
+        OCIO::AutoMutex guard(cache.lock());
+
+        cache["a"]   = std::make_shared<Data>();
+        cache["bb"]  = std::make_shared<Data>();
+        cache["ccc"] = std::make_shared<Data>();
+        OCIO_CHECK_EQUAL(cache.size(), 3);
+        OCIO_CHECK_EQUAL(cache.bytes(), 6);
+
+        // Accessing 'a' makes 'bb' the least recently used entry.
+        entryA = cache["a"];
+    }
+
+    OCIO_CHECK_NO_THROW(cache.setCapacity(2, 0));
+    OCIO_CHECK_EQUAL(cache.getMaxEntries(), 2);
+
+    {
+        OCIO::AutoMutex guard(cache.lock());
+
+        OCIO_CHECK_EQUAL(cache.size(), 2);
+        OCIO_CHECK_ASSERT(cache.exists("a"));
+        OCIO_CHECK_ASSERT(!cache.exists("bb"));
+        OCIO_CHECK_ASSERT(cache.exists("ccc"));
+        OCIO_CHECK_EQUAL(cache["a"], entryA);
+
+        cache["dddd"] = std::make_shared<Data>();
+        OCIO_CHECK_EQUAL(cache.size(), 2);
+        OCIO_CHECK_ASSERT(cache.exists("a"));
+        OCIO_CHECK_ASSERT(!cache.exists("ccc"));
+        OCIO_CHECK_ASSERT(cache.exists("dddd"));
+        OCIO_CHECK_EQUAL(cache.bytes(), 5);
+    }
+
+    // The capacity in bytes.
+    OCIO_CHECK_NO_THROW(cache.setCapacity(0, 6));
+
+    {
+        OCIO::AutoMutex guard(cache.lock());
+
+        cache["ee"] = std::make_shared<Data>();
+        OCIO_CHECK_EQUAL(cache.size(), 2);
+        OCIO_CHECK_ASSERT(!cache.exists("a"));
+        OCIO_CHECK_ASSERT(cache.exists("dddd"));
+        OCIO_CHECK_ASSERT(cache.exists("ee"));
+        OCIO_CHECK_EQUAL(cache.bytes(), 6);
+
+        // The most recently inserted entry is kept even if it exceeds the capacity on its own.
+        cache["fffffff"] = std::make_shared<Data>();
+        OCIO_CHECK_EQUAL(cache.size(), 1);
+        OCIO_CHECK_ASSERT(cache.exists("fffffff"));
+    }
+
+    // Unbounded again.
+    OCIO_CHECK_NO_THROW(cache.setCapacity(0, 0));
+
+    {
+        OCIO::AutoMutex guard(cache.lock());
+
+        cache["a"] = std::make_shared<Data>();
+        OCIO_CHECK_EQUAL(cache.size(), 2);
+        OCIO_CHECK_EQUAL(cache.bytes(), 8);
+    }
+
+    cache.enable(false);
+    OCIO_CHECK_EQUAL(cache.size(), 0);
+    OCIO_CHECK_EQUAL(cache.bytes(), 0);
+}
+
+OCIO_ADD_TEST(Caching, generic_cache_stats)
+{
+    // A unit test to check the usage statistics of the GenericCache class.
+
+    using Cache = OCIO::GenericCache<std::string, DataRcPtr>;
+    Cache cache{ Cache::SizeEstimator(
+        [](const std::string & key, const DataRcPtr &) -> size_t { return key.size(); }) };
+
+    OCIO::CacheStats stats = cache.getStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_misses, 0);
+
+    {
+        OCIO::AutoMutex guard(cache.lock());
+
+        DataRcPtr & entry = cache["a"];
+        OCIO_CHECK_ASSERT(!entry);
+        entry = std::make_shared<Data>();
+
+        OCIO_CHECK_ASSERT(cache["a"]);
+        cache["bb"] = std::make_shared<Data>();
+    }
+
+    auto create = []() { return std::make_shared<Data>(); };
+    OCIO_CHECK_ASSERT(cache.getOrCreate("ccc", create));
+    OCIO_CHECK_ASSERT(cache.getOrCreate("ccc", create));
+
+    stats = cache.getStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 2);
+    OCIO_CHECK_EQUAL(stats.m_misses, 3);
+    OCIO_CHECK_EQUAL(stats.m_inserts, 3);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, 3);
+    OCIO_CHECK_EQUAL(stats.m_bytes, 6);
+
+    OCIO_CHECK_NO_THROW(cache.setCapacity(1, 0));
+
+    stats = cache.getStats();
+    OCIO_CHECK_EQUAL(stats.m_evictions, 2);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+    OCIO_CHECK_EQUAL(stats.m_bytes, 3);
+
+    // Only the counters are reset.
+    OCIO_CHECK_NO_THROW(cache.resetStats());
+
+    stats = cache.getStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_misses, 0);
+    OCIO_CHECK_EQUAL(stats.m_inserts, 0);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+    OCIO_CHECK_EQUAL(stats.m_bytes, 3);
+
+    std::ostringstream oss;
+    oss << stats;
+    OCIO_CHECK_EQUAL(oss.str(), "<CacheStats hits=0, misses=0, inserts=0, evictions=0, "
+                                "entries=1, bytes=3>");
+}
@@ -6250,6 +6250,135 @@ colorspaces:
     }
 }
 
+OCIO_ADD_TEST(Config, processor_cache_capacity)
+{
+    // Validation of the eviction of the least recently used processors.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO_CHECK_EQUAL(config->getProcessorCacheMaxEntries(), 0);
+    OCIO_CHECK_EQUAL(config->getProcessorCacheMaxBytes(), 0);
+
+    OCIO_CHECK_NO_THROW(config->setProcessorCacheCapacity(2, 0));
+    OCIO_CHECK_EQUAL(config->getProcessorCacheMaxEntries(), 2);
+
+    auto createTransform = [](double offset)
+    {
+        OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+        const double offset4[4] = { offset, offset, offset, 0. };
+        matrix->setOffset(offset4);
+        return matrix;
+    };
+
+    OCIO::ConstProcessorRcPtr proc1 = config->getProcessor(createTransform(0.1));
+    OCIO::ConstProcessorRcPtr proc2 = config->getProcessor(createTransform(0.2));
+
+    // Accessing the first processor makes the second one the least recently used.
+    OCIO_CHECK_EQUAL(config->getProcessor(createTransform(0.1)).get(), proc1.get());
+
+    OCIO::ConstProcessorRcPtr proc3 = config->getProcessor(createTransform(0.3));
+
+    OCIO_CHECK_EQUAL(config->getProcessor(createTransform(0.1)).get(), proc1.get());
+    OCIO_CHECK_EQUAL(config->getProcessor(createTransform(0.3)).get(), proc3.get());
+
+    // The second processor was evicted but, as it is still in use, the cache fallback finds it.
+    OCIO_CHECK_EQUAL(config->getProcessorCacheStats().m_evictions, 1);
+    OCIO_CHECK_EQUAL(config->getProcessor(createTransform(0.2)).get(), proc2.get());
+    OCIO_CHECK_EQUAL(config->getProcessorCacheStats().m_evictions, 2);
+    OCIO_CHECK_EQUAL(config->getProcessorCacheStats().m_entries, 2);
+
+    // The capacity is kept by the copies.
+    OCIO::ConfigRcPtr cfg = config->createEditableCopy();
+    OCIO_CHECK_EQUAL(cfg->getProcessorCacheMaxEntries(), 2);
+    OCIO_CHECK_EQUAL(cfg->getProcessorCacheMaxBytes(), 0);
+}
+
+OCIO_ADD_TEST(Config, processor_cache_fallback_index)
+{
+    // The cache fallback finds the identical processors by their cache ID, including the ones
+    // evicted from the cache but still in use.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO_CHECK_NO_THROW(config->setProcessorCacheCapacity(1, 0));
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double offset[4] = { 0.1, 0.2, 0.3, 0. };
+    matrix->setOffset(offset);
+
+    // A different transform, hence a different cache key, producing the same processor.
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(matrix);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(matrix));
+    OCIO_CHECK_EQUAL(config->getProcessor(group).get(), proc.get());
+
+    // Evict the processor from the cache.
+    OCIO::MatrixTransformRcPtr other = OCIO::MatrixTransform::Create();
+    const double otherOffset[4] = { 0.4, 0.5, 0.6, 0. };
+    other->setOffset(otherOffset);
+    OCIO_CHECK_NO_THROW(config->getProcessor(other));
+    OCIO_CHECK_EQUAL(config->getProcessorCacheStats().m_entries, 1);
+
+    OCIO_CHECK_EQUAL(config->getProcessor(matrix).get(), proc.get());
+    OCIO_CHECK_EQUAL(config->getProcessor(group).get(), proc.get());
+}
+
+OCIO_ADD_TEST(Config, processor_cache_stats)
+{
+    // Validation of the usage statistics of the processor caches.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double offset[4] = { 0.1, 0.2, 0.3, 0. };
+    matrix->setOffset(offset);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(matrix));
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(matrix));
+
+    OCIO::CacheStats stats = config->getProcessorCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 1);
+    OCIO_CHECK_EQUAL(stats.m_misses, 1);
+    OCIO_CHECK_EQUAL(stats.m_inserts, 1);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+    OCIO_CHECK_ASSERT(stats.m_bytes > 0);
+
+    OCIO_CHECK_NO_THROW(config->resetProcessorCacheStats());
+    stats = config->getProcessorCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_misses, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+
+    // The caches of the processor instance.
+
+    OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor());
+    OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor());
+    OCIO_CHECK_NO_THROW(proc->getDefaultGPUProcessor());
+
+    stats = proc->getCPUProcessorCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 1);
+    OCIO_CHECK_EQUAL(stats.m_misses, 1);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+
+    stats = proc->getGPUProcessorCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_misses, 1);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+
+    stats = proc->getOptimizedProcessorCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_misses, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, 0);
+
+    OCIO_CHECK_NO_THROW(proc->resetCacheStats());
+    stats = proc->getCPUProcessorCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_misses, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+}
+
 OCIO_ADD_TEST(Config, context_variables_typical_use_cases)
 {
     // Case 1 - No context variables used in the config.
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "HashUtils.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(HashUtils, printable_hash)
+{
+    const uint8_t digest[3] = { 0x12, 0xab, 0x0f };
+    OCIO_CHECK_EQUAL(OCIO::GetPrintableHash(digest, 3), std::string("$21baf0"));
+    OCIO_CHECK_EQUAL(OCIO::GetPrintableHash(digest, 0), std::string("$"));
+}
+
+OCIO_ADD_TEST(HashUtils, cache_id_hash)
+{
+    const std::string empty = OCIO::CacheIDHash("", 0);
+    OCIO_CHECK_EQUAL(empty.size(), 33);
+    OCIO_CHECK_EQUAL(empty[0], '$');
+
+    const std::string text("The quick brown fox jumps over the lazy dog");
+    const std::string hash = OCIO::CacheIDHash(text.c_str(), (int)text.size());
+    OCIO_CHECK_EQUAL(hash.size(), 33);
+    OCIO_CHECK_EQUAL(hash[0], '$');
+    OCIO_CHECK_NE(hash, empty);
+
+    // The hash only depends on the content.
+    const std::string copy(text);
+    OCIO_CHECK_EQUAL(OCIO::CacheIDHash(copy.c_str(), (int)copy.size()), hash);
+
+    // Check the inputs differing by a single bit, across several 64-byte stripes and the tail.
+    std::vector<char> buffer(200, 0);
+    std::vector<std::string> hashes;
+    hashes.push_back(OCIO::CacheIDHash(buffer.data(), (int)buffer.size()));
+    for (size_t idx = 0; idx < buffer.size(); idx += 7)
+    {
+        buffer[idx] = 1;
+        hashes.push_back(OCIO::CacheIDHash(buffer.data(), (int)buffer.size()));
+        buffer[idx] = 0;
+    }
+
+    // Check the inputs only differing by their number of trailing zeros.
+    for (int size = 0; size < 130; ++size)
+    {
+        hashes.push_back(OCIO::CacheIDHash(buffer.data(), size));
+    }
+
+    std::sort(hashes.begin(), hashes.end());
+    OCIO_CHECK_ASSERT(std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+}
+
+OCIO_ADD_TEST(HashUtils, memoized_hash)
+{
+    int numComputations = 0;
+    auto computeHash = [&numComputations]()
+    {
+        ++numComputations;
+        return std::string("$hash") + std::to_string(numComputations);
+    };
+
+    OCIO::MemoizedHash hash;
+    OCIO_CHECK_EQUAL(hash.get(computeHash), "$hash1");
+    OCIO_CHECK_EQUAL(hash.get(computeHash), "$hash1");
+    OCIO_CHECK_EQUAL(numComputations, 1);
+
+    // A copy keeps the hash.
+    OCIO::MemoizedHash copy(hash);
+    OCIO_CHECK_EQUAL(copy.get(computeHash), "$hash1");
+    OCIO_CHECK_EQUAL(numComputations, 1);
+
+    hash.invalidate();
+    OCIO_CHECK_EQUAL(hash.get(computeHash), "$hash2");
+    OCIO_CHECK_EQUAL(numComputations, 2);
+    OCIO_CHECK_EQUAL(copy.get(computeHash), "$hash1");
+
+    copy = hash;
+    OCIO_CHECK_EQUAL(copy.get(computeHash), "$hash2");
+    OCIO_CHECK_EQUAL(numComputations, 2);
+}
@@ -63,6 +63,39 @@ void CompareRender(OCIO::OpRcPtrVec & ops1, OCIO::OpRcPtrVec & ops2,
     }
 }
 
+// Compare the renders of the code values of an integer input bit-depth i.e. in [0, 1].
+void CompareRenderCodes(OCIO::OpRcPtrVec & ops1, OCIO::OpRcPtrVec & ops2,
+                        unsigned maxCode, unsigned line, float errorThreshold)
+{
+    const long nbPixels = long(maxCode) + 1;
+
+    std::vector<float> img1(4 * nbPixels);
+    for (long idx = 0; idx < nbPixels; ++idx)
+    {
+        img1[4 * idx + 0] = float(idx) / float(maxCode);
+        img1[4 * idx + 1] = float((idx * 7) % nbPixels) / float(maxCode);
+        img1[4 * idx + 2] = float((idx * 13) % nbPixels) / float(maxCode);
+        img1[4 * idx + 3] = 0.5f;
+    }
+
+    std::vector<float> img2 = img1;
+
+    for (const auto & op : ops1)
+    {
+        op->apply(&img1[0], &img1[0], nbPixels);
+    }
+
+    for (const auto & op : ops2)
+    {
+        op->apply(&img2[0], &img2[0], nbPixels);
+    }
+
+    for (size_t idx = 0; idx < img1.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE_FROM(img1[idx], img2[idx], errorThreshold, line);
+    }
+}
+
 } // namespace
 
 OCIO_ADD_TEST(OpOptimizers, remove_leading_clamp_identity)
@@ -1055,6 +1088,56 @@ OCIO_ADD_TEST(OpOptimizers, range_lut)
     CompareRender(ops, optOps, __LINE__, 1e-6f);
 }
 
+OCIO_ADD_TEST(OpOptimizers, cdl_redundant_range)
+{
+    // A clamping CDL already limits values to [0, 1], so a following clamp to [0, 1] is removed.
+
+    auto cdlData = std::make_shared<OCIO::CDLOpData>();
+    cdlData->setSlopeParams(OCIO::CDLOpData::ChannelParams(1.2, 0.9, 1.1));
+    cdlData->setPowerParams(OCIO::CDLOpData::ChannelParams(1.1, 1.2, 0.9));
+    cdlData->setStyle(OCIO::CDLOpData::CDL_V1_2_FWD);
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateCDLOp(ops, cdlData, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(ops, 0., 1., 0., 1., OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(ops.size(), 2);
+
+    OCIO::OpRcPtrVec optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.finalize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+    OCIO_CHECK_EQUAL(optOps[0]->getInfo(), "<CDLOp>");
+
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_NONE));
+    CompareRender(ops, optOps, __LINE__, 1e-6f);
+
+    // The range is kept without the identity optimization.
+    optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.finalize(AllBut(OCIO::OPTIMIZATION_IDENTITY)));
+    OCIO_CHECK_EQUAL(optOps.size(), 2);
+
+    // The range is kept if it clamps more than the CDL.
+    ops.clear();
+    OCIO_CHECK_NO_THROW(OCIO::CreateCDLOp(ops, cdlData, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(ops, 0.1, 1., 0.1, 1., OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_EQUAL(ops.size(), 2);
+
+    // The range is kept if it scales.
+    ops.clear();
+    OCIO_CHECK_NO_THROW(OCIO::CreateCDLOp(ops, cdlData, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(ops, 0., 1., 0., 2., OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_EQUAL(ops.size(), 2);
+
+    // The range is kept if the CDL does not clamp.
+    cdlData->setStyle(OCIO::CDLOpData::CDL_NO_CLAMP_FWD);
+    ops.clear();
+    OCIO_CHECK_NO_THROW(OCIO::CreateCDLOp(ops, cdlData, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(ops, 0., 1., 0., 1., OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_EQUAL(ops.size(), 2);
+}
+
 OCIO_ADD_TEST(OpOptimizers, dynamic_ops)
 {
     // Non-identity matrix.
@@ -1342,6 +1425,140 @@ OCIO_ADD_TEST(OpOptimizers, opt_prefix_test1)
     OCIO_CHECK_EQUAL(lut0->getArray().getLength(), 65536u);
 }
 
+OCIO_ADD_TEST(OpOptimizers, bake_lut3d)
+{
+    // Test the bake of ops with channel crosstalk to a shaper 1D LUT & a 3D LUT.
+
+    struct MaxErrorGuard
+    {
+        const float m_maxError = OCIO::GetLut3DBakeMaxError();
+        ~MaxErrorGuard() { OCIO::SetLut3DBakeMaxError(m_maxError); }
+    } guard;
+
+    OCIO::OpRcPtrVec originalOps;
+
+    OCIO::GammaOpData::Params params = { 2.2 };
+    OCIO::GammaOpData::Params paramsA = { 1. };
+
+    OCIO::GammaOpDataRcPtr gamma
+        = std::make_shared<OCIO::GammaOpData>(OCIO::GammaOpData::BASIC_FWD,
+                                              params, params, params, paramsA);
+    OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(originalOps, gamma, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::MatrixOpDataRcPtr matrix = std::make_shared<OCIO::MatrixOpData>();
+    matrix->setArrayValue(0, 0.8);
+    matrix->setArrayValue(1, 0.15);
+    matrix->setArrayValue(2, 0.05);
+    matrix->setArrayValue(4, 0.1);
+    matrix->setArrayValue(5, 0.85);
+    matrix->setArrayValue(6, 0.05);
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+
+    auto cdl = std::make_shared<OCIO::CDLOpData>();
+    cdl->setSlopeParams(OCIO::CDLOpData::ChannelParams(0.8, 0.9, 1.1));
+    cdl->setOffsetParams(OCIO::CDLOpData::ChannelParams(0.02));
+    cdl->setPowerParams(OCIO::CDLOpData::ChannelParams(1.2, 1.0, 1.3));
+    cdl->setSaturation(1.2);
+    cdl->setStyle(OCIO::CDLOpData::CDL_NO_CLAMP_FWD);
+    OCIO_CHECK_NO_THROW(OCIO::CreateCDLOp(originalOps, cdl, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO_CHECK_NO_THROW(originalOps.finalize(OCIO::OPTIMIZATION_NONE));
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 3);
+
+    // Not requested.
+
+    OCIO::OpRcPtrVec optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_NONE));
+    OCIO_CHECK_EQUAL(optimizedOps.size(), 3);
+
+    // Float input bit-depths are not baked.
+
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F16,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT3D));
+    OCIO_CHECK_EQUAL(optimizedOps.size(), 3);
+
+    // The gamma becomes the shaper.
+
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT3D));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 2);
+
+    OCIO::ConstOpRcPtr o0 = optimizedOps[0];
+    OCIO::ConstOpRcPtr o1 = optimizedOps[1];
+    OCIO_REQUIRE_EQUAL(o0->data()->getType(), OCIO::OpData::Lut1DType);
+    OCIO_REQUIRE_EQUAL(o1->data()->getType(), OCIO::OpData::Lut3DType);
+
+    auto shaper = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut1DOpData>(o0->data());
+    OCIO_CHECK_EQUAL(shaper->getArray().getLength(), 1024u);
+
+    auto lut = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(o1->data());
+    OCIO_CHECK_EQUAL(lut->getArray().getLength(), 65u);
+
+    CompareRenderCodes(originalOps, optimizedOps, 1023, __LINE__,
+                       2.0f * OCIO::GetLut3DBakeMaxError());
+
+    // A larger error allows a smaller 3D LUT.
+
+    OCIO::SetLut3DBakeMaxError(1e-2f);
+
+    optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT8,
+                                                         OCIO::BIT_DEPTH_UINT8,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT3D));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 2);
+
+    o1  = optimizedOps[1];
+    lut = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(o1->data());
+    OCIO_REQUIRE_ASSERT(lut);
+    OCIO_CHECK_EQUAL(lut->getArray().getLength(), 17u);
+
+    CompareRenderCodes(originalOps, optimizedOps, 255, __LINE__, 2e-2f);
+
+    // Without a separable op at the head of the list, there is no shaper.
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(ops, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(ops, gamma, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateCDLOp(ops, cdl, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_NONE));
+
+    optimizedOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT8,
+                                                         OCIO::BIT_DEPTH_UINT8,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT3D));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1);
+    o0 = optimizedOps[0];
+    OCIO_CHECK_EQUAL(o0->data()->getType(), OCIO::OpData::Lut3DType);
+
+    // The ops are kept when no grid size is within the maximum error.
+
+    OCIO::SetLut3DBakeMaxError(1e-7f);
+
+    optimizedOps = originalOps.clone();
+    OCIO_CHECK_NO_THROW(optimizedOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10,
+                                                         OCIO::BIT_DEPTH_F32,
+                                                         OCIO::OPTIMIZATION_BAKE_LUT3D));
+    OCIO_CHECK_EQUAL(optimizedOps.size(), 3);
+
+    // Only one expensive op.
+
+    OCIO::SetLut3DBakeMaxError(1e-2f);
+
+    ops.clear();
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(ops, matrix, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateCDLOp(ops, cdl, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize(OCIO::OPTIMIZATION_NONE));
+
+    OCIO_CHECK_NO_THROW(ops.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT8,
+                                                OCIO::BIT_DEPTH_UINT8,
+                                                OCIO::OPTIMIZATION_BAKE_LUT3D));
+    OCIO_CHECK_EQUAL(ops.size(), 2);
+}
+
 OCIO_ADD_TEST(OpOptimizers, replace_ops)
 {
     auto cdlData = std::make_shared<OCIO::CDLOpData>();
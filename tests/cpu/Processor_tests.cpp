@@ -27,7 +27,7 @@ OCIO_ADD_TEST(Processor, basic)
     auto processorMat = config->getProcessor(mat);
     OCIO_CHECK_EQUAL(processorMat->getNumTransforms(), 1);
 
-    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "$b8861d4acd905af0e84ddf10c860b220");
+    OCIO_CHECK_EQUAL(std::string(processorMat->getCacheID()), "$4c669f662fcbfe142c3296fecb7aaa34");
 }
 
 OCIO_ADD_TEST(Processor, shared_dynamic_properties)
@@ -11,6 +11,7 @@
 #include "MathUtils.h"
 #include "SSE.h"
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -289,6 +290,65 @@ OCIO_ADD_TEST(SSE, sse2_exp2_test)
     }
 }
 
+namespace
+{
+
+// Check the log2, exp2 & power functions of a precision tier against double computations, the
+// error being relative to the result magnitude or absolute for results smaller than 1.
+template<typename Math>
+void CheckPrecisionTier(const char * tier, const float tolerance)
+{
+    float sseResult[4];
+
+    const float log2Values[] = { 1e-10f, 0.001f, 0.1f, 0.5f, 0.9f, 1.f, 1.1f,
+                                 2.f, 11.f, 112.f, 2425.f, 2e15f };
+    for (const float x : log2Values)
+    {
+        const float expected = (float)(std::log((double)x) / std::log(2.0));
+        _mm_storeu_ps(sseResult, Math::Log2(_mm_set1_ps(x)));
+        OCIO_CHECK_ASSERT_MESSAGE(
+            OCIO::EqualWithSafeRelError(sseResult[0], expected, tolerance, 1.f),
+            GetErrorMessage(std::string(tier) + " " + GetOperation("log2", x),
+                            expected, sseResult));
+    }
+
+    const float exp2Values[] = { -20.5f, -7.11f, -1.f, -0.33f, 0.f, 1e-5f,
+                                 0.1f, 0.5f, 1.5f, 3.2f, 13.23f, 27.001f };
+    for (const float x : exp2Values)
+    {
+        const float expected = (float)std::pow(2.0, (double)x);
+        _mm_storeu_ps(sseResult, Math::Exp2(_mm_set1_ps(x)));
+        OCIO_CHECK_ASSERT_MESSAGE(
+            OCIO::EqualWithSafeRelError(sseResult[0], expected, tolerance, 1.f),
+            GetErrorMessage(std::string(tier) + " " + GetOperation("exp2", x),
+                            expected, sseResult));
+    }
+
+    const float powerBases[] = { 0.001f, 0.112f, 0.5f, 0.7f, 1.f, 1.9f, 8.f, 100.f };
+    const float powerExponents[] = { 0.3f, 1.f / 2.4f, 1.f, 2.2f, 2.6f, 4.f };
+    for (const float base : powerBases)
+    {
+        for (const float exponent : powerExponents)
+        {
+            const float expected = (float)std::pow((double)base, (double)exponent);
+            _mm_storeu_ps(sseResult, Math::Power(_mm_set1_ps(base), _mm_set1_ps(exponent)));
+            OCIO_CHECK_ASSERT_MESSAGE(
+                OCIO::EqualWithSafeRelError(sseResult[0], expected, tolerance, 1.f),
+                GetErrorMessage(std::string(tier) + " " + GetOperation("power", base, exponent),
+                                expected, sseResult));
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(SSE, sse2_precision_tiers_test)
+{
+    CheckPrecisionTier<OCIO::SSEDraftMath>("draft", 5e-4f);
+    CheckPrecisionTier<OCIO::SSEFastMath>("fast", 5e-5f);
+    CheckPrecisionTier<OCIO::SSEAccurateMath>("accurate", 5e-7f);
+}
+
 void EvaluateAtan(const float x, float* result)
 {
     __m128 mm_sseResult = OCIO::sseAtan(_mm_set1_ps(x));
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <atomic>
+#include <vector>
+
+#include "ThreadPool.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(ThreadPool, num_threads)
+{
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(1), 1u);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(7), 7u);
+    OCIO_CHECK_ASSERT(OCIO::GetNumThreads(0) >= 1u);
+}
+
+OCIO_ADD_TEST(ThreadPool, submit)
+{
+    std::atomic<int> count{ 0 };
+    {
+        OCIO::ThreadPool pool;
+        pool.reserve(3);
+        OCIO_CHECK_EQUAL(pool.getNumWorkers(), 3u);
+
+        // Does not shrink.
+        pool.reserve(1);
+        OCIO_CHECK_EQUAL(pool.getNumWorkers(), 3u);
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        for (int idx = 0; idx < 10; ++idx)
+        {
+            pool.submit([&]()
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++count;
+                condition.notify_all();
+            });
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&count]() { return count.load() == 10; });
+    }
+    OCIO_CHECK_EQUAL(count.load(), 10);
+}
+
+OCIO_ADD_TEST(ThreadPool, parallel_for)
+{
+    constexpr long NUM_TASKS = 1000;
+
+    for (unsigned numThreads : { 0u, 1u, 2u, 8u })
+    {
+        std::vector<int> values(NUM_TASKS, 0);
+        OCIO_CHECK_NO_THROW(OCIO::ParallelFor(numThreads, NUM_TASKS,
+                                              [&values](long idx) { values[idx] += int(idx); }));
+
+        for (long idx = 0; idx < NUM_TASKS; ++idx)
+        {
+            OCIO_CHECK_EQUAL(values[idx], int(idx));
+        }
+    }
+
+    // Nothing to do.
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(4, 0, [](long) { throw OCIO::Exception("Failed"); }));
+
+    // Nested calls.
+    std::atomic<long> count{ 0 };
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(4, 8, [&count](long)
+    {
+        OCIO::ParallelFor(4, 8, [&count](long) { ++count; });
+    }));
+    OCIO_CHECK_EQUAL(count.load(), 64);
+}
+
+OCIO_ADD_TEST(ThreadPool, parallel_for_exception)
+{
+    std::atomic<long> count{ 0 };
+    OCIO_CHECK_THROW_WHAT(OCIO::ParallelFor(4, 100, [&count](long idx)
+                          {
+                              ++count;
+                              if (idx == 10)
+                              {
+                                  throw OCIO::Exception("Task failure.");
+                              }
+                          }),
+                          OCIO::Exception,
+                          "Task failure.");
+    OCIO_CHECK_ASSERT(count <= 100);
+}
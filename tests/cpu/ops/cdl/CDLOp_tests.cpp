@@ -23,7 +23,7 @@ void ApplyCDL(float * in, const float * ref, unsigned numPixels,
 
     OCIO_CHECK_NO_THROW(cdlOp.validate());
 
-    const auto cpu = cdlOp.getCPUOp(true);
+    const auto cpu = cdlOp.getCPUOp(OCIO::LOG_EXP_POW_FAST);
     cpu->apply(in, in, numPixels);
 
     for(unsigned idx=0; idx<(numPixels*4); ++idx)
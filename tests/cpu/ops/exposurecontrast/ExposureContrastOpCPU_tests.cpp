@@ -95,7 +95,8 @@ OCIO_ADD_TEST(ExposureContrastRenderer, video)
     ec->getGammaProperty()->makeDynamic();
 
     OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+    OCIO::OpCPURcPtr renderer
+        = OCIO::GetExposureContrastCPURenderer(const_ec, OCIO::LOG_EXP_POW_FAST);
     OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::ECVideoRenderer>(renderer));
     std::vector<float> rgba = rgbaImage;
 
@@ -168,7 +169,8 @@ OCIO_ADD_TEST(ExposureContrastRenderer, log)
     ec->setPivot(0.18);
 
     OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+    OCIO::OpCPURcPtr renderer
+        = OCIO::GetExposureContrastCPURenderer(const_ec, OCIO::LOG_EXP_POW_FAST);
     OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::ECLogarithmicRenderer>(renderer));
 
     std::vector<float> rgba = rgbaImage;
@@ -238,7 +240,8 @@ OCIO_ADD_TEST(ExposureContrastRenderer, linear)
     ec->getGammaProperty()->makeDynamic();
 
     OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+    OCIO::OpCPURcPtr renderer
+        = OCIO::GetExposureContrastCPURenderer(const_ec, OCIO::LOG_EXP_POW_FAST);
     OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::ECLinearRenderer>(renderer));
 
     std::vector<float> rgba = rgbaImage;
@@ -306,13 +309,15 @@ void TestECInverse(OCIO::ExposureContrastOpData::Style style)
     ec->setPivot(0.18);
 
     OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+    OCIO::OpCPURcPtr renderer
+        = OCIO::GetExposureContrastCPURenderer(const_ec, OCIO::LOG_EXP_POW_FAST);
 
     std::vector<float> rgba = rgbaImage;
     renderer->apply(rgba.data(), rgba.data(), 2);
 
     OCIO::ConstExposureContrastOpDataRcPtr const_eci = ec->inverse();
-    OCIO::OpCPURcPtr rendereri = OCIO::GetExposureContrastCPURenderer(const_eci);
+    OCIO::OpCPURcPtr rendereri
+        = OCIO::GetExposureContrastCPURenderer(const_eci, OCIO::LOG_EXP_POW_FAST);
     rendereri->apply(rgba.data(), rgba.data(), 2);
 
     // As the ssePower is an approximation, strict equality is not possible.
@@ -354,7 +359,8 @@ void TestLogParamForStyle(OCIO::ExposureContrastOpData::Style style, bool hasEff
     // Reference.
     {
         OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-        OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+        OCIO::OpCPURcPtr renderer
+            = OCIO::GetExposureContrastCPURenderer(const_ec, OCIO::LOG_EXP_POW_FAST);
         renderer->apply(rgbaRef.data(), rgbaRef.data(), 3);
     }
 
@@ -364,7 +370,8 @@ void TestLogParamForStyle(OCIO::ExposureContrastOpData::Style style, bool hasEff
     std::vector<float> rgba = rgbaImage;
     {
         OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-        OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+        OCIO::OpCPURcPtr renderer
+            = OCIO::GetExposureContrastCPURenderer(const_ec, OCIO::LOG_EXP_POW_FAST);
         renderer->apply(rgba.data(), rgba.data(), 3);
         for (int i = 0; i < 12; ++i)
         {
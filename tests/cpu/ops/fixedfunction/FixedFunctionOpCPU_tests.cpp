@@ -22,7 +22,7 @@ void ApplyFixedFunction(float * input_32f,
                         int lineNo)
 {
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW_FROM(op = OCIO::GetFixedFunctionCPURenderer(fnData), lineNo);
+    OCIO_CHECK_NO_THROW_FROM(op = OCIO::GetFixedFunctionCPURenderer(fnData, false), lineNo);
     OCIO_CHECK_NO_THROW_FROM(op->apply(input_32f, input_32f, numSamples), lineNo);
 
     for(unsigned idx=0; idx<(numSamples*4); ++idx)
@@ -45,6 +45,80 @@ void ApplyFixedFunction(float * input_32f,
         }
     }
 }
+
+void CheckSameResults(const OCIO::OpCPU & ref, const OCIO::OpCPU & op,
+                      float errorThreshold, int lineNo)
+{
+    // Use a pixel count which is not a multiple of the SIMD widths.
+    const long numPixels = 203;
+
+    std::vector<float> input(numPixels * 4);
+    unsigned seed = 1;
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (long c = 0; c < 4; ++c)
+        {
+            seed = seed * 1103515245u + 12345u;
+            input[4 * idx + c] = (float)((seed >> 8) & 0xFFFF) / 65535.0f * 4.0f - 1.0f;
+        }
+
+        // Include some neutral pixels.
+        if (idx % 7 == 0)
+        {
+            input[4 * idx + 1] = input[4 * idx];
+            input[4 * idx + 2] = input[4 * idx];
+        }
+    }
+
+    std::vector<float> expected(numPixels * 4);
+    ref.apply(&input[0], &expected[0], numPixels);
+
+    std::vector<float> output(numPixels * 4);
+    op.apply(&input[0], &output[0], numPixels);
+
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        const bool equalRel = OCIO::EqualWithSafeRelError(output[idx], expected[idx],
+                                                          errorThreshold, 1.0f);
+        if (!equalRel)
+        {
+            std::ostringstream errorMsg;
+            errorMsg.precision(14);
+            errorMsg << "Index: " << idx;
+            errorMsg << " - Values: " << output[idx] << " expected: " << expected[idx];
+            errorMsg << " - Threshold: " << errorThreshold;
+            OCIO_CHECK_ASSERT_MESSAGE_FROM(0, errorMsg.str(), lineNo);
+            return;
+        }
+    }
+}
+
+// Compare the SIMD renderers to the scalar one.
+template<typename Renderer, typename... Args>
+void CheckSIMDRenderers(float errorThreshold, int lineNo,
+                        OCIO::FixedFunctionOpData::Style style, Args... args)
+{
+    const OCIO::FixedFunctionOpData::Params params
+        = style == OCIO::FixedFunctionOpData::REC2100_SURROUND_FWD
+            ? OCIO::FixedFunctionOpData::Params{ 0.78 } : OCIO::FixedFunctionOpData::Params{};
+
+    OCIO::ConstFixedFunctionOpDataRcPtr fnData
+        = std::make_shared<OCIO::FixedFunctionOpData>(params, style);
+
+    const Renderer ref(fnData, args...);
+
+#ifdef USE_SSE
+    CheckSameResults(ref, OCIO::Renderer_SSE<Renderer>(fnData, args...), errorThreshold, lineNo);
+#endif
+
+#ifdef USE_AVX2
+    if (OCIO::CPUInfo::Instance().hasAVX2())
+    {
+        CheckSameResults(ref, OCIO::Renderer_AVX2<Renderer>(fnData, args...),
+                         errorThreshold, lineNo);
+    }
+#endif
+}
 }
 
 OCIO_ADD_TEST(FixedFunctionOpCPU, aces_red_mod_03)
@@ -417,3 +491,96 @@ OCIO_ADD_TEST(FixedFunctionOpCPU, XYZ_TO_LUV)
     img = outputFrame;
     ApplyFixedFunction(&img[0], &inputFrame[0], 2, dataFInv, 1e-5f, __LINE__);
 }
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, LIN_TO_PQ)
+{
+    // Linear 1.0 is 100 nits i.e. 100.0 is 10000 nits.
+    const std::vector<float> inputFrame {
+          0.0f,  0.01f,  0.18f,  0.5f,
+          1.0f, 10.00f, 100.0f,  1.0f,
+         -1.0f,  0.50f, -0.01f,  0.0f };
+
+    const std::vector<float> outputFrame {
+         7.3095590e-7f, 0.14994573f,  0.34796666f, 0.5f,
+         0.50807842f,   0.75182710f,  1.00000000f, 1.0f,
+        -0.50807842f,   0.44028157f, -0.14994573f, 0.0f };
+
+    std::vector<float> img = inputFrame;
+
+    OCIO::ConstFixedFunctionOpDataRcPtr dataFwd
+        = std::make_shared<OCIO::FixedFunctionOpData>(OCIO::FixedFunctionOpData::LIN_TO_PQ);
+
+    ApplyFixedFunction(&img[0], &outputFrame[0], 3, dataFwd, 1e-6f, __LINE__);
+
+    OCIO::ConstFixedFunctionOpDataRcPtr dataFInv
+        = std::make_shared<OCIO::FixedFunctionOpData>(OCIO::FixedFunctionOpData::PQ_TO_LIN);
+
+    // The inverse is very sensitive close to PQ 1.0 i.e. the float rounding of the PQ values
+    // is amplified.
+    img = outputFrame;
+    ApplyFixedFunction(&img[0], &inputFrame[0], 3, dataFInv, 1e-4f, __LINE__);
+
+    // The PQ values are clamped to 1.0 i.e. 10000 nits.
+    float rgba[4] = { 1.5f, -2.0f, 1.0f, 0.5f };
+    OCIO::ConstOpCPURcPtr op = OCIO::GetFixedFunctionCPURenderer(dataFInv, false);
+    op->apply(rgba, rgba, 1);
+
+    OCIO_CHECK_CLOSE(rgba[0],  100.0f, 1e-5f);
+    OCIO_CHECK_CLOSE(rgba[1], -100.0f, 1e-5f);
+    OCIO_CHECK_CLOSE(rgba[2],  100.0f, 1e-5f);
+    OCIO_CHECK_EQUAL(rgba[3],  0.5f);
+}
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, LIN_TO_HLG)
+{
+    const std::vector<float> inputFrame {
+          0.0f,  0.02f,  1.f / 12.f,  0.5f,
+         0.18f, 0.265f,        1.0f,  1.0f,
+         -0.5f,   2.0f,      -0.02f,  0.0f };
+
+    const std::vector<float> outputFrame {
+          0.00000000f, 0.24494897f,  0.50000000f, 0.5f,
+          0.67235813f, 0.75002775f,  1.00000000f, 1.0f,
+         -0.87164347f, 1.12611705f, -0.24494897f, 0.0f };
+
+    std::vector<float> img = inputFrame;
+
+    OCIO::ConstFixedFunctionOpDataRcPtr dataFwd
+        = std::make_shared<OCIO::FixedFunctionOpData>(OCIO::FixedFunctionOpData::LIN_TO_HLG);
+
+    ApplyFixedFunction(&img[0], &outputFrame[0], 3, dataFwd, 1e-6f, __LINE__);
+
+    OCIO::ConstFixedFunctionOpDataRcPtr dataFInv
+        = std::make_shared<OCIO::FixedFunctionOpData>(OCIO::FixedFunctionOpData::HLG_TO_LIN);
+
+    img = outputFrame;
+    ApplyFixedFunction(&img[0], &inputFrame[0], 3, dataFInv, 1e-6f, __LINE__);
+}
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, simd_renderers)
+{
+    using Style = OCIO::FixedFunctionOpData::Style;
+
+    CheckSIMDRenderers<OCIO::Renderer_ACES_RedMod03_Fwd>(1e-6f, __LINE__, Style::ACES_RED_MOD_03_FWD);
+    CheckSIMDRenderers<OCIO::Renderer_ACES_RedMod03_Inv>(1e-6f, __LINE__, Style::ACES_RED_MOD_03_INV);
+    CheckSIMDRenderers<OCIO::Renderer_ACES_RedMod10_Fwd>(1e-6f, __LINE__, Style::ACES_RED_MOD_10_FWD);
+    CheckSIMDRenderers<OCIO::Renderer_ACES_RedMod10_Inv>(1e-6f, __LINE__, Style::ACES_RED_MOD_10_INV);
+
+    CheckSIMDRenderers<OCIO::Renderer_ACES_Glow03_Fwd>(1e-6f, __LINE__, Style::ACES_GLOW_03_FWD,
+                                                       0.075f, 0.1f);
+    CheckSIMDRenderers<OCIO::Renderer_ACES_Glow03_Inv>(1e-6f, __LINE__, Style::ACES_GLOW_03_INV,
+                                                       0.075f, 0.1f);
+
+    CheckSIMDRenderers<OCIO::Renderer_RGB_TO_HSV>(1e-6f, __LINE__, Style::RGB_TO_HSV);
+    CheckSIMDRenderers<OCIO::Renderer_HSV_TO_RGB>(1e-6f, __LINE__, Style::HSV_TO_RGB);
+
+    // The SIMD power function is an approximation.
+    CheckSIMDRenderers<OCIO::Renderer_ACES_DarkToDim10_Fwd>(1e-4f, __LINE__,
+                                                            Style::ACES_DARK_TO_DIM_10_FWD, 0.9811f);
+    CheckSIMDRenderers<OCIO::Renderer_REC2100_Surround>(1e-4f, __LINE__, Style::REC2100_SURROUND_FWD);
+
+    CheckSIMDRenderers<OCIO::Renderer_LIN_TO_PQ>(1e-5f, __LINE__, Style::LIN_TO_PQ);
+    CheckSIMDRenderers<OCIO::Renderer_PQ_TO_LIN>(1e-4f, __LINE__, Style::PQ_TO_LIN);
+    CheckSIMDRenderers<OCIO::Renderer_LIN_TO_HLG>(1e-5f, __LINE__, Style::LIN_TO_HLG);
+    CheckSIMDRenderers<OCIO::Renderer_HLG_TO_LIN>(1e-5f, __LINE__, Style::HLG_TO_LIN);
+}
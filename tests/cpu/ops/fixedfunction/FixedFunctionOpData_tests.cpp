@@ -116,6 +116,50 @@ OCIO_ADD_TEST(FixedFunctionOpData, rec2100_surround_style)
                           "one parameter but 0 found.");
 }
 
+OCIO_ADD_TEST(FixedFunctionOpData, transfer_function_styles)
+{
+    OCIO::FixedFunctionOpData func(OCIO::FixedFunctionOpData::LIN_TO_PQ);
+    OCIO_CHECK_EQUAL(func.getDirection(), OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_ASSERT(!func.hasChannelCrosstalk());
+    OCIO_CHECK_EQUAL(std::string(OCIO::FixedFunctionOpData::ConvertStyleToString(func.getStyle(),
+                                                                                 false)),
+                     "LIN_TO_PQ");
+
+    OCIO::FixedFunctionOpDataRcPtr inv = func.inverse();
+    OCIO_CHECK_EQUAL(inv->getStyle(), OCIO::FixedFunctionOpData::PQ_TO_LIN);
+    OCIO_CHECK_EQUAL(inv->getDirection(), OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_ASSERT(!inv->hasChannelCrosstalk());
+    OCIO_CHECK_ASSERT(inv->getCacheID() != func.getCacheID());
+    OCIO_CHECK_EQUAL(OCIO::FixedFunctionOpData::ConvertStyle(inv->getStyle()),
+                     OCIO::FIXED_FUNCTION_LIN_TO_PQ);
+    OCIO_CHECK_EQUAL(OCIO::FixedFunctionOpData::GetStyle("pq_to_lin"),
+                     OCIO::FixedFunctionOpData::PQ_TO_LIN);
+
+    OCIO_CHECK_EQUAL(OCIO::FixedFunctionOpData::ConvertStyle(OCIO::FIXED_FUNCTION_LIN_TO_HLG,
+                                                             OCIO::TRANSFORM_DIR_FORWARD),
+                     OCIO::FixedFunctionOpData::LIN_TO_HLG);
+    OCIO_CHECK_EQUAL(OCIO::FixedFunctionOpData::ConvertStyle(OCIO::FIXED_FUNCTION_LIN_TO_HLG,
+                                                             OCIO::TRANSFORM_DIR_INVERSE),
+                     OCIO::FixedFunctionOpData::HLG_TO_LIN);
+
+    func.setStyle(OCIO::FixedFunctionOpData::LIN_TO_HLG);
+    OCIO_CHECK_ASSERT(!func.hasChannelCrosstalk());
+    inv = func.inverse();
+    OCIO_CHECK_EQUAL(inv->getStyle(), OCIO::FixedFunctionOpData::HLG_TO_LIN);
+
+    OCIO::ConstFixedFunctionOpDataRcPtr constInv = inv;
+    OCIO_CHECK_ASSERT(func.isInverse(constInv));
+
+    OCIO_CHECK_NO_THROW(func.setParams({ 1. }));
+    OCIO_CHECK_THROW_WHAT(func.validate(),
+                          OCIO::Exception,
+                          "The style 'LIN_TO_HLG' must have zero parameters but 1 found.");
+
+    // The other styles mix the channels.
+    func.setStyle(OCIO::FixedFunctionOpData::RGB_TO_HSV);
+    OCIO_CHECK_ASSERT(func.hasChannelCrosstalk());
+}
+
 OCIO_ADD_TEST(FixedFunctionOpData, is_inverse)
 {
     OCIO::FixedFunctionOpData::Params params = { 2.0 };
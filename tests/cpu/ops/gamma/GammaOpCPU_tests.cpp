@@ -20,7 +20,7 @@ void ApplyGamma(const OCIO::OpRcPtr & op,
                 long numPixels, unsigned line,
                 float errorThreshold)
 {
-    const auto cpu = op->getCPUOp(true);
+    const auto cpu = op->getCPUOp(OCIO::LOG_EXP_POW_FAST);
 
     OCIO_CHECK_NO_THROW_FROM(cpu->apply(image, image, numPixels), line);
 
@@ -750,3 +750,130 @@ OCIO_ADD_TEST(GammaOpCPU, apply_moncurve_mirror_style_rev)
     ApplyGamma(ops[0], input_32f, expected_32f, numPixels, __LINE__, errorThreshold);
 }
 
+
+#if defined(USE_SSE) && (defined(USE_AVX2) || defined(USE_AVX512))
+namespace
+{
+OCIO::ConstOpCPURcPtr GetGammaRendererSSE(OCIO::ConstGammaOpDataRcPtr & gamma,
+                                          OCIO::LogExpPowPrecision precision)
+{
+    switch (gamma->getStyle())
+    {
+        case OCIO::GammaOpData::MONCURVE_FWD:
+            return OCIO::MakeSSERenderer<OCIO::OpCPU,
+                                         OCIO::GammaMoncurveOpCPUFwdSSE>(precision, gamma);
+        case OCIO::GammaOpData::MONCURVE_REV:
+            return OCIO::MakeSSERenderer<OCIO::OpCPU,
+                                         OCIO::GammaMoncurveOpCPURevSSE>(precision, gamma);
+        case OCIO::GammaOpData::MONCURVE_MIRROR_FWD:
+            return OCIO::MakeSSERenderer<OCIO::OpCPU,
+                                         OCIO::GammaMoncurveMirrorOpCPUFwdSSE>(precision, gamma);
+        case OCIO::GammaOpData::MONCURVE_MIRROR_REV:
+            return OCIO::MakeSSERenderer<OCIO::OpCPU,
+                                         OCIO::GammaMoncurveMirrorOpCPURevSSE>(precision, gamma);
+        case OCIO::GammaOpData::BASIC_FWD:
+        case OCIO::GammaOpData::BASIC_REV:
+            return OCIO::MakeSSERenderer<OCIO::OpCPU, OCIO::GammaBasicOpCPUSSE>(precision, gamma);
+        case OCIO::GammaOpData::BASIC_MIRROR_FWD:
+        case OCIO::GammaOpData::BASIC_MIRROR_REV:
+            return OCIO::MakeSSERenderer<OCIO::OpCPU,
+                                         OCIO::GammaBasicMirrorOpCPUSSE>(precision, gamma);
+        case OCIO::GammaOpData::BASIC_PASS_THRU_FWD:
+        case OCIO::GammaOpData::BASIC_PASS_THRU_REV:
+            return OCIO::MakeSSERenderer<OCIO::OpCPU,
+                                         OCIO::GammaBasicPassThruOpCPUSSE>(precision, gamma);
+    }
+    return OCIO::ConstOpCPURcPtr();
+}
+};
+
+OCIO_ADD_TEST(GammaOpCPU, apply_avx_vs_sse)
+{
+    // The AVX2 & AVX-512 renderers must produce exactly the same results as the SSE ones, for
+    // each precision tier (the AVX-512 renderer only implements the fast one).
+    // Note that the number of pixels is not a multiple of the number of pixels per register.
+
+    constexpr long numPixels = 11;
+
+    const float input_32f[numPixels * 4] = {
+         0.0005f,  0.005f,   0.05f,      0.75f,
+        -0.0005f, -0.005f,  -0.05f,     -0.75f,
+         0.25f,    0.5f,     0.75f,      1.0f,
+        -0.25f,   -0.5f,    -0.75f,     -1.0f,
+         0.80f,    0.95f,    1.0f,       0.75f,
+        -0.80f,   -0.95f,   -1.0f,      -0.75f,
+         1.005f,   1.05f,    1.5f,       1.0f,
+        -1.005f,  -1.05f,   -1.5f,      -1.0f,
+         0.0f,    -0.0f,     1e-10f,     1e10f,
+         12.5f,    100.0f,   0.01f,      2.0f,
+        -inf,      inf,      qnan,       0.0f };
+
+    const OCIO::GammaOpData::Style styles[] = {
+        OCIO::GammaOpData::BASIC_FWD,           OCIO::GammaOpData::BASIC_REV,
+        OCIO::GammaOpData::BASIC_MIRROR_FWD,    OCIO::GammaOpData::BASIC_MIRROR_REV,
+        OCIO::GammaOpData::BASIC_PASS_THRU_FWD, OCIO::GammaOpData::BASIC_PASS_THRU_REV,
+        OCIO::GammaOpData::MONCURVE_FWD,        OCIO::GammaOpData::MONCURVE_REV,
+        OCIO::GammaOpData::MONCURVE_MIRROR_FWD, OCIO::GammaOpData::MONCURVE_MIRROR_REV };
+
+    for (const auto style : styles)
+    {
+        const bool moncurve = style == OCIO::GammaOpData::MONCURVE_FWD
+                              || style == OCIO::GammaOpData::MONCURVE_REV
+                              || style == OCIO::GammaOpData::MONCURVE_MIRROR_FWD
+                              || style == OCIO::GammaOpData::MONCURVE_MIRROR_REV;
+
+        const OCIO::GammaOpData::Params redParams
+            = moncurve ? OCIO::GammaOpData::Params{ 2.4, 0.1 } : OCIO::GammaOpData::Params{ 1.2 };
+        const OCIO::GammaOpData::Params greenParams
+            = moncurve ? OCIO::GammaOpData::Params{ 2.2, 0.2 } : OCIO::GammaOpData::Params{ 2.12 };
+        const OCIO::GammaOpData::Params blueParams
+            = moncurve ? OCIO::GammaOpData::Params{ 2.0, 0.4 } : OCIO::GammaOpData::Params{ 1.123 };
+        const OCIO::GammaOpData::Params alphaParams
+            = moncurve ? OCIO::GammaOpData::Params{ 1.8, 0.6 } : OCIO::GammaOpData::Params{ 1.05 };
+
+        OCIO::ConstGammaOpDataRcPtr gammaData
+            = std::make_shared<OCIO::GammaOpData>(style, redParams, greenParams,
+                                                  blueParams, alphaParams);
+
+        for (const auto precision : { OCIO::LOG_EXP_POW_DRAFT,
+                                      OCIO::LOG_EXP_POW_FAST,
+                                      OCIO::LOG_EXP_POW_ACCURATE })
+        {
+            float expected_32f[numPixels * 4];
+            GetGammaRendererSSE(gammaData, precision)->apply(input_32f, expected_32f, numPixels);
+
+            std::vector<OCIO::ConstOpCPURcPtr> renderers;
+#ifdef USE_AVX2
+            if (OCIO::CPUInfo::Instance().hasAVX2())
+            {
+                renderers.push_back(std::make_shared<OCIO::GammaOpCPUAVX2>(gammaData, precision));
+            }
+#endif
+#ifdef USE_AVX512
+            if (precision == OCIO::LOG_EXP_POW_FAST && OCIO::CPUInfo::Instance().hasAVX512())
+            {
+                renderers.push_back(std::make_shared<OCIO::GammaOpCPUAVX512>(gammaData));
+            }
+#endif
+
+            for (const auto & renderer : renderers)
+            {
+                float output_32f[numPixels * 4];
+                renderer->apply(input_32f, output_32f, numPixels);
+
+                for (long idx = 0; idx < numPixels * 4; ++idx)
+                {
+                    if (OCIO::IsNan(expected_32f[idx]))
+                    {
+                        OCIO_CHECK_ASSERT(OCIO::IsNan(output_32f[idx]));
+                    }
+                    else
+                    {
+                        OCIO_CHECK_EQUAL(output_32f[idx], expected_32f[idx]);
+                    }
+                }
+            }
+        }
+    }
+}
+#endif
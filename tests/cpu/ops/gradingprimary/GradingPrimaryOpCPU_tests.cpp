@@ -70,7 +70,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, identity)
     auto gd = std::make_shared<OCIO::GradingPrimaryOpData>(OCIO::GRADING_LOG);
     OCIO::ConstOpCPURcPtr op;
     OCIO::ConstGradingPrimaryOpDataRcPtr gdc = gd;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains LogFwd.
     {
@@ -82,7 +82,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, identity)
     ValidateImage(expected, res, numPixels, __LINE__);
 
     gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains LogRev.
     {
@@ -95,7 +95,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, identity)
 
     gd = std::make_shared<OCIO::GradingPrimaryOpData>(OCIO::GRADING_LIN);
     gdc = gd;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains LinFwd.
     {
@@ -107,7 +107,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, identity)
     ValidateImage(expected, res, numPixels, __LINE__);
 
     gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains LinRev.
     {
@@ -120,7 +120,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, identity)
 
     gd = std::make_shared<OCIO::GradingPrimaryOpData>(OCIO::GRADING_VIDEO);
     gdc = gd;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains VidFwd.
     {
@@ -132,7 +132,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, identity)
     ValidateImage(expected, res, numPixels, __LINE__);
 
     gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains VidRev.
     {
@@ -190,7 +190,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, log)
     gd->getDynamicPropertyInternal()->makeDynamic();
     OCIO::ConstGradingPrimaryOpDataRcPtr gdc = gd;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS1::input_32f, res, TS1::num_samples));
     ValidateImage(TS1::expected_32f, res, TS1::num_samples, __LINE__);
@@ -222,7 +222,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, log)
     gdp.m_saturation = TS1::saturation;
 
     gd->setValue(gdp);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS1::expected_32f, res, TS1::num_samples));
     ValidateImage(TS1::input_32f, res, TS1::num_samples, __LINE__);
@@ -278,7 +278,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, lin)
 
     OCIO::ConstGradingPrimaryOpDataRcPtr gdc = gd;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS2::input_32f, res, TS2::num_samples));
     ValidateImage(TS2::expected_32f, res, TS2::num_samples, __LINE__);
@@ -297,7 +297,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, lin)
     gdp.m_clampWhite = 100;
 
     gd->setValue(gdp);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS2::expected_32f, res, TS2::num_samples));
     ValidateImage(TS2::input_32f, res, TS2::num_samples, __LINE__);
@@ -349,7 +349,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, video)
 
     OCIO::ConstGradingPrimaryOpDataRcPtr gdc = gd;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS3::input_32f, res, TS3::num_samples));
     ValidateImage(TS3::expected_32f, res, TS3::num_samples, __LINE__);
@@ -381,7 +381,7 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, video)
     gdp.m_saturation = TS3::saturation;
 
     gd->setValue(gdp);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingPrimaryCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS3::expected_32f, res, TS3::num_samples));
     ValidateImage(TS3::input_32f, res, TS3::num_samples, __LINE__);
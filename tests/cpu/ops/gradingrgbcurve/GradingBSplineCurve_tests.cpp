@@ -4,6 +4,7 @@
 
 #include "ops/gradingrgbcurve/GradingBSplineCurve.cpp"
 
+#include "MathUtils.h"
 #include "testutils/UnitTest.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -67,3 +68,48 @@ OCIO_ADD_TEST(GradingBSplineCurve, validate)
     OCIO_CHECK_NO_THROW(curve->validate());
 }
 
+
+OCIO_ADD_TEST(GradingBSplineCurve, sampled_curves)
+{
+    // Curve 0 is identity, curve 1 has steep segments.
+    auto identity = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f }, { 1.f, 1.f } });
+    auto curve = OCIO::GradingBSplineCurve::Create({ { 0.0f,   0.0f },   { 0.785f, 0.231f },
+                                                     { 0.809f, 0.631f }, { 0.948f, 0.704f },
+                                                     { 1.0f,   1.0f } });
+
+    OCIO::GradingBSplineCurveImpl::KnotsCoefs knotsCoefs(2);
+    dynamic_cast<OCIO::GradingBSplineCurveImpl *>(identity.get())->computeKnotsAndCoefs(knotsCoefs, 0);
+    dynamic_cast<OCIO::GradingBSplineCurveImpl *>(curve.get())->computeKnotsAndCoefs(knotsCoefs, 1);
+
+    OCIO::GradingBSplineCurveImpl::SampledCurves sampled(2);
+    sampled.sample(knotsCoefs);
+    OCIO_CHECK_ASSERT(sampled.m_curves[0].m_samples.empty());
+    OCIO_CHECK_EQUAL(sampled.m_curves[1].m_samples.size(),
+                     (size_t)OCIO::GradingBSplineCurveImpl::SampledCurves::NUM_SAMPLES);
+
+    // Also covers the extrapolation on both sides.
+    for (int i = -100; i <= 1100; ++i)
+    {
+        const float x = i / 1000.f;
+        OCIO_CHECK_EQUAL(x, sampled.evalCurve(0, x));
+        OCIO_CHECK_CLOSE(knotsCoefs.evalCurve(1, x), sampled.evalCurve(1, x), 2e-5f);
+    }
+
+    // The first and last knots are the ends of the sampled range, so they are exact.
+    OCIO_CHECK_EQUAL(knotsCoefs.evalCurve(1, 0.f), sampled.evalCurve(1, 0.f));
+    OCIO_CHECK_EQUAL(knotsCoefs.evalCurve(1, 1.f), sampled.evalCurve(1, 1.f));
+
+    // The interior knots usually fall between two samples, so they are interpolated.
+    const int knotsOffset = knotsCoefs.m_knotsOffsetsArray[2];
+    const int numKnots    = knotsCoefs.m_knotsOffsetsArray[3];
+    OCIO_REQUIRE_ASSERT(numKnots > 2);
+    for (int i = knotsOffset + 1; i < knotsOffset + numKnots - 1; ++i)
+    {
+        const float knot = knotsCoefs.m_knotsArray[i];
+        OCIO_CHECK_CLOSE(knotsCoefs.evalCurve(1, knot), sampled.evalCurve(1, knot), 2e-5f);
+    }
+
+    OCIO_CHECK_ASSERT(OCIO::IsNan(sampled.evalCurve(1, std::numeric_limits<float>::quiet_NaN())));
+    OCIO_CHECK_EQUAL(std::numeric_limits<float>::infinity(),
+                     sampled.evalCurve(1, std::numeric_limits<float>::infinity()));
+}
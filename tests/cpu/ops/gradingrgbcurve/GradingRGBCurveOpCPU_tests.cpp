@@ -70,7 +70,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, identity)
     auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LIN);
     OCIO::ConstOpCPURcPtr op;
     OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains CurveLinearFwdOp.
     {
@@ -82,7 +82,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, identity)
     ValidateImage(expected, res, numPixels, __LINE__);
 
     gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains CurveLinearRevOp.
     {
@@ -95,7 +95,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, identity)
     // If BypassLinToLog is true, a Curve*Op renderer rather than a CurveLinear*Op renderer will
     // be used.
     gc->setBypassLinToLog(true);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains CurveRevOp.
     {
@@ -106,7 +106,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, identity)
     // TODO: implement inverse.
 
     gc->setDirection(OCIO::TRANSFORM_DIR_FORWARD);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains CurveFwdOp.
     {
@@ -119,7 +119,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, identity)
 
     gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_VIDEO);
     gcc = gc;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains CurveFwdOp.
     {
@@ -131,7 +131,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, identity)
     ValidateImage(expected, res, numPixels, __LINE__);
 
     gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains CurveRevOp.
     {
@@ -144,7 +144,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, identity)
     // BypassLinToLog is ignored when style is not GRADING_LIN, still creating a CurveRevOp
     // renderer.
     gc->setBypassLinToLog(true);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains CurveRevOp.
     {
@@ -169,7 +169,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, log)
     auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LOG, r, g, b, m);
     OCIO::ConstOpCPURcPtr op;
     OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
 
     const long num_samples = 2;
@@ -200,7 +200,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, log_partial_identity)
     auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LOG, r, g, b, m);
     OCIO::ConstOpCPURcPtr op;
     OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
 
     const long num_samples = 2;
@@ -233,7 +233,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, monotonic)
     auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LOG, r, g, b, m);
     OCIO::ConstOpCPURcPtr op;
     OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
 
     const long num_samples = 2;
@@ -270,7 +270,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, lin_bypass)
     gc->setBypassLinToLog(true);
     OCIO::ConstOpCPURcPtr op;
     OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
 
     float input_32f[] = {
@@ -304,7 +304,7 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, lin)
     auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LIN, r, g, b, m);
     OCIO::ConstOpCPURcPtr op;
     OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
 
     float input_32f[] = {
@@ -320,3 +320,52 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, lin)
 }
 
 // TODO: implement inverse.
+
+OCIO_ADD_TEST(GradingRGBCurveOpCPU, dynamic)
+{
+    // The renderer evaluates the curves from samples of the dynamic property, check that they
+    // follow the edits.
+    auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LOG);
+    gc->getDynamicPropertyInternal()->makeDynamic();
+    OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
+    OCIO::ConstOpCPURcPtr op;
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingRGBCurveCPURenderer(gcc, OCIO::LOG_EXP_POW_FAST));
+    OCIO_REQUIRE_ASSERT(op);
+
+    const long num_samples = 2;
+
+    const float input_32f[] = {
+        -0.2f, 0.2f, 0.5f, 0.0f,
+         0.8f, 1.0f, 2.0f, 0.5f };
+
+    float res[4 * num_samples]{ 0.f };
+
+    OCIO_CHECK_NO_THROW(op->apply(input_32f, res, num_samples));
+    ValidateImage(input_32f, res, num_samples, __LINE__);
+
+    OCIO::DynamicPropertyRcPtr dp;
+    OCIO_CHECK_NO_THROW(dp = op->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_RGBCURVE));
+    OCIO_REQUIRE_ASSERT(dp);
+    auto dpVal = OCIO::DynamicPropertyValue::AsGradingRGBCurve(dp);
+    OCIO_REQUIRE_ASSERT(dpVal);
+
+    // Same curves as the log test, the image is not processed in place.
+    auto rnc = OCIO::GradingBSplineCurve::Create({ { 0.1f, 0.15f }, { 0.55f, 0.45f }, { 0.9f, 1.1f } });
+    auto gnc = OCIO::GradingBSplineCurve::Create({ { 0.1f, 0.15f }, { 0.55f, 0.35f }, { 0.9f, 1.1f } });
+    auto bnc = OCIO::GradingBSplineCurve::Create({ { 0.1f, 0.15f }, { 0.55f, 0.85f }, { 0.9f, 1.1f } });
+    auto mnc = OCIO::GradingBSplineCurve::Create({ { -0.1f, 0.1f }, { 1.1f, 1.3f } });
+    auto curves = OCIO::GradingRGBCurve::Create(rnc, gnc, bnc, mnc);
+    OCIO_CHECK_NO_THROW(dpVal->setValue(curves));
+
+    const float expected_32f[] = {
+        0.25306581f, 0.35779659f, 0.98416632f, 0.0f,
+        1.09451043f, 1.54596428f, 1.78067802f, 0.5f };
+
+    OCIO_CHECK_NO_THROW(op->apply(input_32f, res, num_samples));
+    ValidateImage(expected_32f, res, num_samples, __LINE__);
+
+    // Back to identity.
+    OCIO_CHECK_NO_THROW(dpVal->setValue(OCIO::GradingRGBCurve::Create(OCIO::GRADING_LOG)));
+    OCIO_CHECK_NO_THROW(op->apply(input_32f, res, num_samples));
+    ValidateImage(input_32f, res, num_samples, __LINE__);
+}
@@ -73,7 +73,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, identity)
     auto gd = std::make_shared<OCIO::GradingToneOpData>(OCIO::GRADING_LOG);
     OCIO::ConstOpCPURcPtr op;
     OCIO::ConstGradingToneOpDataRcPtr gdc = gd;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains GradingToneFwdOpCPU.
     {
@@ -85,7 +85,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, identity)
     ValidateImage(expected, res, numPixels, __LINE__);
 
     gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains GradingToneRevOpCPU.
     {
@@ -97,7 +97,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, identity)
 
     gd = std::make_shared<OCIO::GradingToneOpData>(OCIO::GRADING_LIN);
     gdc = gd;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains GradingToneLinearFwdOpCPU.
     {
@@ -109,7 +109,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, identity)
     ValidateImage(expected, res, numPixels, __LINE__);
 
     gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains GradingToneLinearRevOpCPU.
     {
@@ -121,7 +121,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, identity)
 
     gd = std::make_shared<OCIO::GradingToneOpData>(OCIO::GRADING_VIDEO);
     gdc = gd;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains GradingToneFwdOpCPU.
     {
@@ -133,7 +133,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, identity)
     ValidateImage(expected, res, numPixels, __LINE__);
 
     gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gdc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // Check that the right OpCPU is created. Check that class name contains GradingToneRevOpCPU.
     {
@@ -175,7 +175,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_midtones)
     gt->getDynamicPropertyInternal()->makeDynamic();
     OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS1::input_32f, res, TS1::num_samples));
     ValidateImage(TS1::expected_32f, res, TS1::num_samples, __LINE__);
@@ -185,7 +185,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_midtones)
     gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
 
     gt->setValue(gtd);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // TODO: implement inverse.
     //OCIO_CHECK_NO_THROW(op->apply(TS1::expected_32f, res, TS1::num_samples));
@@ -223,7 +223,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_highlights)
     gt->getDynamicPropertyInternal()->makeDynamic();
     OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS2::input_32f, res, TS2::num_samples));
     ValidateImage(TS2::expected_32f, res, TS2::num_samples, __LINE__);
@@ -233,7 +233,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_highlights)
     gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
 
     gt->setValue(gtd);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // TODO: implement inverse.
     //OCIO_CHECK_NO_THROW(op->apply(TS2::expected_32f, res, TS2::num_samples));
@@ -271,7 +271,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, video_shadows)
     gt->getDynamicPropertyInternal()->makeDynamic();
     OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS3::input_32f, res, TS3::num_samples));
     ValidateImage(TS3::expected_32f, res, TS3::num_samples, __LINE__);
@@ -281,7 +281,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, video_shadows)
     gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
 
     gt->setValue(gtd);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // TODO: implement inverse.
     //OCIO_CHECK_NO_THROW(op->apply(TS3::expected_32f, res, TS3::num_samples));
@@ -319,7 +319,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, video_white_details)
     gt->getDynamicPropertyInternal()->makeDynamic();
     OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS4::input_32f, res, TS4::num_samples));
     ValidateImage(TS4::expected_32f, res, TS4::num_samples, __LINE__);
@@ -329,7 +329,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, video_white_details)
     gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
 
     gt->setValue(gtd);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // TODO: implement inverse.
     //OCIO_CHECK_NO_THROW(op->apply(TS4::expected_32f, res, TS4::num_samples));
@@ -367,7 +367,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_black_details)
     gt->getDynamicPropertyInternal()->makeDynamic();
     OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS5::input_32f, res, TS5::num_samples));
     ValidateImage(TS5::expected_32f, res, TS5::num_samples, __LINE__);
@@ -377,7 +377,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_black_details)
     gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
 
     gt->setValue(gtd);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // TODO: implement inverse.
     //OCIO_CHECK_NO_THROW(op->apply(TS5::expected_32f, res, TS5::num_samples));
@@ -425,7 +425,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_scontrast)
     gt->getDynamicPropertyInternal()->makeDynamic();
     OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS6::input_32f, res, TS6::num_samples));
     ValidateImage(TS6::expected_32f, res, TS6::num_samples, __LINE__);
@@ -434,7 +434,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_scontrast)
     gtd.m_scontrast = TS6::scontrast2;
 
     gt->setValue(gtd);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS6::input2_32f, res, TS6::num_samples));
     ValidateImage(TS6::expected2_32f, res, TS6::num_samples, __LINE__);
@@ -444,7 +444,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_scontrast)
     gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
 
     gt->setValue(gtd);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // TODO: implement inverse.
     //OCIO_CHECK_NO_THROW(op->apply(TS6::expected2_32f, res, TS6::num_samples));
@@ -453,7 +453,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, log_scontrast)
     // Test with first value.
     gtd.m_scontrast = TS6::scontrast2;
 
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // TODO: implement inverse.
     //OCIO_CHECK_NO_THROW(op->apply(TS6::expected_32f, res, TS6::num_samples));
@@ -491,7 +491,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, lin_midtones)
     gt->getDynamicPropertyInternal()->makeDynamic();
     OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
     OCIO::ConstOpCPURcPtr op;
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     OCIO_CHECK_NO_THROW(op->apply(TS7::input_32f, res, TS7::num_samples));
     ValidateImage(TS7::expected_32f, res, TS7::num_samples, __LINE__);
@@ -501,7 +501,7 @@ OCIO_ADD_TEST(GradingToneOpCPU, lin_midtones)
     gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
 
     gt->setValue(gtd);
-    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc));
+    OCIO_CHECK_NO_THROW(op = OCIO::GetGradingToneCPURenderer(gtc, OCIO::LOG_EXP_POW_FAST));
     OCIO_CHECK_ASSERT(op);
     // TODO: implement inverse.
     //OCIO_CHECK_NO_THROW(op->apply(TS7::expected_32f, res, TS7::num_samples));
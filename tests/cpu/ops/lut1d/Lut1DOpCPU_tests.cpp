@@ -889,6 +889,70 @@ OCIO_ADD_TEST(Lut1DRenderer, half)
     OCIO_CHECK_EQUAL(outImg[7], inImg[7]);
 }
 
+OCIO_ADD_TEST(Lut1DRenderer, half_lut_storage)
+{
+    for (auto halfFlags : { OCIO::Lut1DOpData::LUT_STANDARD, OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE })
+    {
+        const unsigned long length
+            = halfFlags == OCIO::Lut1DOpData::LUT_STANDARD ? 4096 : 65536;
+        OCIO::Lut1DOpDataRcPtr lutData = std::make_shared<OCIO::Lut1DOpData>(halfFlags, length);
+
+        // Make a LUT which is not linear, with values in [-1, 1].
+        OCIO::Array::Values & values = lutData->getArray().getValues();
+        for (size_t idx = 0; idx < values.size(); ++idx)
+        {
+            const float val = OCIO::IsNan(values[idx]) || std::isinf(values[idx]) ? 0.f : values[idx];
+            values[idx] = val / (1.f + std::fabs(val)) + 0.001f * (float)(idx % 3);
+        }
+
+        OCIO_CHECK_NO_THROW(lutData->validate());
+        OCIO_CHECK_NO_THROW(lutData->finalize());
+
+        OCIO::ConstLut1DOpDataRcPtr constLut = lutData;
+        OCIO::ConstOpCPURcPtr cpuOp;
+        OCIO_CHECK_NO_THROW(cpuOp = OCIO::GetLut1DRenderer(constLut, OCIO::BIT_DEPTH_F32,
+                                                           OCIO::BIT_DEPTH_F32));
+        OCIO::ConstOpCPURcPtr cpuOpHalf;
+        OCIO_CHECK_NO_THROW(cpuOpHalf = OCIO::GetLut1DRenderer(constLut, OCIO::BIT_DEPTH_F32,
+                                                               OCIO::BIT_DEPTH_F32, true));
+
+        // The half values halve the memory footprint.
+        typedef OCIO::BaseLut1DRenderer<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32> Renderer;
+        auto renderer     = OCIO::DynamicPtrCast<const Renderer>(cpuOp);
+        auto rendererHalf = OCIO::DynamicPtrCast<const Renderer>(cpuOpHalf);
+        OCIO_REQUIRE_ASSERT(renderer && rendererHalf);
+        OCIO_CHECK_EQUAL(renderer->getLutSize(), length * 3 * sizeof(float));
+        OCIO_CHECK_EQUAL(rendererHalf->getLutSize() * 2, renderer->getLutSize());
+
+        // The relative error of the half values is at most 2^-11 and the LUT values are in
+        // [-1, 1].
+        constexpr long numPixels = 1000;
+        std::vector<float> inImg(numPixels * 4);
+        for (long idx = 0; idx < numPixels * 4; ++idx)
+        {
+            inImg[idx] = -0.5f + 2.f * (float)((idx * 37) % 1009) / 1009.f;
+        }
+
+        std::vector<float> outImg(numPixels * 4);
+        cpuOp->apply(inImg.data(), outImg.data(), numPixels);
+        std::vector<float> outImgHalf(numPixels * 4);
+        cpuOpHalf->apply(inImg.data(), outImgHalf.data(), numPixels);
+
+        for (long idx = 0; idx < numPixels * 4; ++idx)
+        {
+            OCIO_CHECK_CLOSE(outImgHalf[idx], outImg[idx], 4.9e-4f);
+        }
+
+        // Integer output values are not stored as half values.
+        OCIO_CHECK_NO_THROW(cpuOpHalf = OCIO::GetLut1DRenderer(constLut, OCIO::BIT_DEPTH_F32,
+                                                               OCIO::BIT_DEPTH_UINT16, true));
+        typedef OCIO::BaseLut1DRenderer<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_UINT16> RendererInt;
+        auto rendererInt = OCIO::DynamicPtrCast<const RendererInt>(cpuOpHalf);
+        OCIO_REQUIRE_ASSERT(rendererInt);
+        OCIO_CHECK_EQUAL(rendererInt->getLutSize(), length * 3 * sizeof(float));
+    }
+}
+
 OCIO_ADD_TEST(Lut1DRenderer, nan)
 {
     // By default, this constructor creates an 'identity LUT'.
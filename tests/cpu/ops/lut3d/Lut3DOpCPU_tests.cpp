@@ -6,6 +6,7 @@
 
 #include "ops/lut3d/Lut3DOpCPU.cpp"
 
+
 #include "testutils/UnitTest.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -55,3 +56,397 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+OCIO_ADD_TEST(Lut3DRenderer, layout)
+{
+    // Small lattices keep the blue fastest order.
+    const OCIO::Lut3DLayout layout17(17);
+    OCIO_CHECK_EQUAL(layout17.m_shift, 0);
+    OCIO_CHECK_EQUAL(layout17.m_numEntries, 17 * 17 * 17);
+    OCIO_CHECK_EQUAL(layout17.getOffset(0, 0, 1), 1);
+    OCIO_CHECK_EQUAL(layout17.getOffset(0, 1, 0), 17);
+    OCIO_CHECK_EQUAL(layout17.getOffset(3, 5, 7), (3 * 17 + 5) * 17 + 7);
+
+    // All the entries of a large lattice (including the partial bricks) have their own offset.
+    const OCIO::Lut3DLayout layout67(67);
+#ifdef USE_SSE
+    OCIO_CHECK_EQUAL(layout67.m_shift, 2);
+    OCIO_CHECK_EQUAL(layout67.m_numEntries, 68 * 68 * 68);
+    OCIO_CHECK_EQUAL(layout67.getOffset(0, 1, 0), 4);
+    OCIO_CHECK_EQUAL(layout67.getOffset(0, 0, 4), 64);
+#endif
+
+    std::vector<bool> used(layout67.m_numEntries, false);
+    for (int r = 0; r < 67; ++r)
+    {
+        for (int g = 0; g < 67; ++g)
+        {
+            for (int b = 0; b < 67; ++b)
+            {
+                const int offset = layout67.getOffset(r, g, b);
+                OCIO_REQUIRE_ASSERT(offset >= 0 && offset < (int)layout67.m_numEntries);
+                OCIO_REQUIRE_ASSERT(!used[offset]);
+                used[offset] = true;
+            }
+        }
+    }
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, large_lattice_test)
+{
+    // The lattice points are mapped to the LUT values whatever the storage of the lattice.
+    constexpr unsigned long gridSize = 67;
+    for (auto interp : { OCIO::INTERP_LINEAR, OCIO::INTERP_TETRAHEDRAL })
+    {
+        OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(interp, gridSize);
+
+        std::vector<float> & values = lut->getArray().getValues();
+        for (size_t idx = 0; idx < values.size(); ++idx)
+        {
+            values[idx] = values[idx] * values[idx] + 0.01f * (float)(idx % 7);
+        }
+
+        OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+
+        // Lattice points along the diagonals and the upper faces (i.e. in the partial bricks).
+        std::vector<float> pixels;
+        std::vector<unsigned long> indices;
+        for (unsigned long i = 0; i < gridSize; ++i)
+        {
+            const unsigned long points[4][3] = { { i, i, i },
+                                                 { gridSize - 1 - i, i, (i * 5) % gridSize },
+                                                 { gridSize - 1, i, (i * 3) % gridSize },
+                                                 { (i * 7) % gridSize, gridSize - 1, i } };
+            for (const auto & point : points)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    pixels.push_back((float)point[c] / (float)(gridSize - 1));
+                }
+                pixels.push_back(0.5f);
+                indices.push_back((point[0] * gridSize + point[1]) * gridSize + point[2]);
+            }
+        }
+
+        const long numPixels = (long)indices.size();
+        renderer->apply(pixels.data(), pixels.data(), numPixels);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            OCIO_CHECK_CLOSE(pixels[4 * idx + 0], values[3 * indices[idx] + 0], 1e-4f);
+            OCIO_CHECK_CLOSE(pixels[4 * idx + 1], values[3 * indices[idx] + 1], 1e-4f);
+            OCIO_CHECK_CLOSE(pixels[4 * idx + 2], values[3 * indices[idx] + 2], 1e-4f);
+            OCIO_CHECK_EQUAL(pixels[4 * idx + 3], 0.5f);
+        }
+    }
+}
+
+namespace
+{
+
+// Invertible LUT with some crosstalk.
+OCIO::Lut3DOpDataRcPtr CreateInvertibleLut(unsigned long gridSize)
+{
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(gridSize);
+
+    std::vector<float> & values = lut->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); idx += 3)
+    {
+        const float r = values[idx + 0];
+        const float g = values[idx + 1];
+        const float b = values[idx + 2];
+        values[idx + 0] = 0.9f * std::pow(r, 0.8f) + 0.05f * (g + b);
+        values[idx + 1] = 0.9f * std::pow(g, 0.9f) + 0.05f * (r + b);
+        values[idx + 2] = 0.9f * std::pow(b, 1.1f) + 0.05f * (r + g);
+    }
+
+    return lut;
+}
+
+} // anon
+
+OCIO_ADD_TEST(Lut3DRenderer, inverse_tree_cache)
+{
+    OCIO::Lut3DOpDataRcPtr lut = CreateInvertibleLut(17);
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+    const auto invTree = OCIO::GetInvLut3DTree(lutConst);
+    OCIO_REQUIRE_ASSERT(invTree);
+    OCIO_CHECK_EQUAL(invTree->m_grvec.size(), 19 * 19 * 19 * 3);
+    OCIO_CHECK_EQUAL(invTree->m_tree.getGridSize()[0], 19);
+
+    // The LUTs with the same values share the tree.
+    OCIO::ConstLut3DOpDataRcPtr lutClone = lut->clone();
+    OCIO_CHECK_ASSERT(OCIO::GetInvLut3DTree(lutClone) == invTree);
+
+    OCIO::Lut3DOpDataRcPtr lutOther = lut->clone();
+    lutOther->getArray().getValues()[3] += 0.001f;
+    OCIO::ConstLut3DOpDataRcPtr lutOtherConst = lutOther;
+    OCIO_CHECK_ASSERT(OCIO::GetInvLut3DTree(lutOtherConst) != invTree);
+
+    OCIO::ClearLut3DRendererCaches();
+    OCIO_CHECK_ASSERT(OCIO::GetInvLut3DTree(lutClone) != invTree);
+
+    // The cache only keeps the most recently used entries.
+    OCIO::ClearLut3DRendererCaches();
+    OCIO::ResetLut3DRendererCacheStats();
+
+    OCIO::ConstLut3DOpDataRcPtr firstLut;
+    for (size_t idx = 0; idx <= OCIO::InvLut3DCacheMaxEntries; ++idx)
+    {
+        OCIO::Lut3DOpDataRcPtr smallLut = std::make_shared<OCIO::Lut3DOpData>(2);
+        smallLut->getArray().getValues()[0] = (float)idx / 100.f;
+        smallLut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        OCIO::ConstLut3DOpDataRcPtr smallLutConst = smallLut;
+        OCIO::GetInvLut3DCacheEntry(smallLutConst);
+        if (!firstLut)
+        {
+            firstLut = smallLutConst;
+        }
+    }
+
+    OCIO::CacheStats stats = OCIO::GetLut3DInverseCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_misses, OCIO::InvLut3DCacheMaxEntries + 1);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 1);
+    OCIO_CHECK_EQUAL(stats.m_entries, OCIO::InvLut3DCacheMaxEntries);
+
+    OCIO::GetInvLut3DCacheEntry(firstLut);
+    stats = OCIO::GetLut3DInverseCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 2);
+
+    // The lattice points are mapped back to the domain.
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+
+    const std::vector<float> & values = lut->getArray().getValues();
+    const unsigned long indices[3] = { 17 * 17 * 5 + 17 * 9 + 13, 17 * 17 * 16 + 3, 17 * 12 + 16 };
+    float pixels[12];
+    for (int i = 0; i < 3; ++i)
+    {
+        pixels[4 * i + 0] = values[3 * indices[i] + 0];
+        pixels[4 * i + 1] = values[3 * indices[i] + 1];
+        pixels[4 * i + 2] = values[3 * indices[i] + 2];
+        pixels[4 * i + 3] = 0.5f;
+    }
+
+    renderer->apply(pixels, pixels, 3);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        OCIO_CHECK_CLOSE(pixels[4 * i + 0], (float)(indices[i] / (17 * 17)) / 16.f, 1e-5f);
+        OCIO_CHECK_CLOSE(pixels[4 * i + 1], (float)((indices[i] / 17) % 17) / 16.f, 1e-5f);
+        OCIO_CHECK_CLOSE(pixels[4 * i + 2], (float)(indices[i] % 17) / 16.f, 1e-5f);
+        OCIO_CHECK_EQUAL(pixels[4 * i + 3], 0.5f);
+    }
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, inverse_refine_test)
+{
+    OCIO::Lut3DOpDataRcPtr lut = CreateInvertibleLut(33);
+    lut->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+    OCIO::ConstOpCPURcPtr rendererRefine = OCIO::GetLut3DRenderer(lutConst, false, true);
+
+    // Enough pixels for several blocks, including out of range values.
+    constexpr long numPixels = 1000;
+    std::vector<float> pixels(numPixels * 4);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        pixels[4 * idx + 0] = (float)((idx * 37) % 101) / 95.f - 0.02f;
+        pixels[4 * idx + 1] = (float)((idx * 53) % 103) / 102.f;
+        pixels[4 * idx + 2] = (float)((idx * 71) % 107) / 106.f;
+        pixels[4 * idx + 3] = (float)idx;
+    }
+
+    std::vector<float> results(numPixels * 4);
+    renderer->apply(pixels.data(), results.data(), numPixels);
+
+    // The refined inverse is applied in place.
+    rendererRefine->apply(pixels.data(), pixels.data(), numPixels);
+
+    for (long idx = 0; idx < 4 * numPixels; ++idx)
+    {
+        OCIO_CHECK_CLOSE(pixels[idx], results[idx], 1e-5f);
+    }
+}
+
+#ifdef USE_AVX2
+namespace
+{
+
+template<typename Renderer, typename RendererAVX2>
+void ValidateAVX2Renderer(OCIO::Interpolation interp, unsigned long gridSize, unsigned lineNo)
+{
+    OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(interp, gridSize);
+
+    // Make a LUT which is not linear.
+    std::vector<float> & values = lut->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        values[idx] = values[idx] * values[idx] + 0.01f * (float)(idx % 7);
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+    const Renderer renderer(lutConst);
+    const RendererAVX2 rendererAVX2(lutConst, false);
+
+    // Cover all the tetrahedra, the out of range values & an incomplete last block.
+    constexpr long numPixels = 71;
+    std::vector<float> pixels(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        pixels[idx] = -0.1f + 1.2f * (float)((idx * 37) % 101) / 100.0f;
+    }
+    pixels[8]  = std::numeric_limits<float>::quiet_NaN();
+    pixels[12] = std::numeric_limits<float>::infinity();
+    pixels[13] = -std::numeric_limits<float>::infinity();
+
+    std::vector<float> expected(numPixels * 4);
+    renderer.apply(pixels.data(), expected.data(), numPixels);
+
+    std::vector<float> results(numPixels * 4);
+    rendererAVX2.apply(pixels.data(), results.data(), numPixels);
+
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        OCIO_CHECK_CLOSE_FROM(results[idx], expected[idx], 1e-6f, lineNo);
+    }
+
+    // In place processing.
+    rendererAVX2.apply(pixels.data(), pixels.data(), numPixels);
+    OCIO_CHECK_ASSERT_FROM(pixels == results, lineNo);
+}
+
+} // anon
+
+OCIO_ADD_TEST(Lut3DRenderer, tetra_avx2_test)
+{
+    if (!OCIO::CPUInfo::Instance().hasAVX2())
+    {
+        return;
+    }
+
+    ValidateAVX2Renderer<OCIO::Lut3DTetrahedralRenderer, OCIO::Lut3DTetrahedralRendererAVX2>(
+        OCIO::INTERP_TETRAHEDRAL, 17, __LINE__);
+
+    // Lattice stored in bricks.
+    ValidateAVX2Renderer<OCIO::Lut3DTetrahedralRenderer, OCIO::Lut3DTetrahedralRendererAVX2>(
+        OCIO::INTERP_TETRAHEDRAL, 67, __LINE__);
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, linear_avx2_test)
+{
+    if (!OCIO::CPUInfo::Instance().hasAVX2())
+    {
+        return;
+    }
+
+    ValidateAVX2Renderer<OCIO::Lut3DRenderer, OCIO::Lut3DRendererAVX2>(
+        OCIO::INTERP_LINEAR, 17, __LINE__);
+
+    // Lattice stored in bricks.
+    ValidateAVX2Renderer<OCIO::Lut3DRenderer, OCIO::Lut3DRendererAVX2>(
+        OCIO::INTERP_LINEAR, 67, __LINE__);
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, half_lattice_test)
+{
+    if (!OCIO::CPUInfo::Instance().hasAVX2())
+    {
+        return;
+    }
+
+    for (auto interp : { OCIO::INTERP_LINEAR, OCIO::INTERP_TETRAHEDRAL })
+    {
+        OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(interp, 65);
+
+        // Make a LUT which is not linear, with values in [0, 1.06].
+        std::vector<float> & values = lut->getArray().getValues();
+        for (size_t idx = 0; idx < values.size(); ++idx)
+        {
+            values[idx] = values[idx] * values[idx] + 0.01f * (float)(idx % 7);
+        }
+
+        OCIO::ConstLut3DOpDataRcPtr lutConst = lut;
+        OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(lutConst);
+        OCIO::ConstOpCPURcPtr rendererHalf = OCIO::GetLut3DRenderer(lutConst, true);
+
+        // The half values halve the memory footprint.
+        auto base     = OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(renderer);
+        auto baseHalf = OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(rendererHalf);
+        OCIO_REQUIRE_ASSERT(base && baseHalf);
+        OCIO_CHECK_EQUAL(base->getLatticeSize(), 65 * 65 * 65 * 4 * sizeof(float));
+        OCIO_CHECK_EQUAL(baseHalf->getLatticeSize() * 2, base->getLatticeSize());
+
+        constexpr long numPixels = 1001;
+        std::vector<float> pixels(numPixels * 4);
+        for (long idx = 0; idx < numPixels * 4; ++idx)
+        {
+            pixels[idx] = -0.1f + 1.2f * (float)((idx * 37) % 1009) / 1008.0f;
+        }
+
+        std::vector<float> expected(numPixels * 4);
+        renderer->apply(pixels.data(), expected.data(), numPixels);
+        std::vector<float> results(numPixels * 4);
+        rendererHalf->apply(pixels.data(), results.data(), numPixels);
+
+        // The relative error of the half values is at most 2^-11.
+        for (long idx = 0; idx < numPixels * 4; ++idx)
+        {
+            OCIO_CHECK_CLOSE(results[idx], expected[idx], 1.06f * 4.9e-4f);
+        }
+    }
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, half_lattice_process_memory)
+{
+    if (!OCIO::CPUInfo::Instance().hasAVX2())
+    {
+        return;
+    }
+
+    // The half values only apply to the lattice of the renderers, the op data of the processor
+    // kept by the config processor cache stay 32-bit float.
+
+    OCIO::Lut3DTransformRcPtr lutTransform = OCIO::Lut3DTransform::Create(65);
+    for (unsigned long r = 0; r < 65; ++r)
+    {
+        for (unsigned long g = 0; g < 65; ++g)
+        {
+            for (unsigned long b = 0; b < 65; ++b)
+            {
+                lutTransform->setValue(r, g, b, std::sqrt(r / 64.f), g / 64.f, b / 128.f);
+            }
+        }
+    }
+
+    // A processor without LUT gives the fixed cost of the cached processors.
+    OCIO::ConfigRcPtr emptyConfig = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO::ConstProcessorRcPtr emptyProc;
+    OCIO_CHECK_NO_THROW(emptyProc = emptyConfig->getProcessor(OCIO::MatrixTransform::Create()));
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(lutTransform));
+
+    const size_t opDataBytes = config->getProcessorCacheStats().m_bytes
+                               - emptyConfig->getProcessorCacheStats().m_bytes;
+    OCIO_CHECK_EQUAL(opDataBytes, 65 * 65 * 65 * 3 * sizeof(float));
+
+    OCIO::ConstLut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(65);
+    auto base     = OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(
+                        OCIO::GetLut3DRenderer(lut));
+    auto baseHalf = OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(
+                        OCIO::GetLut3DRenderer(lut, true));
+    OCIO_REQUIRE_ASSERT(base && baseHalf);
+
+    // The process memory of the LUT goes from 3 + 4 to 3 + 2 floats per lattice entry i.e. 29%
+    // less, and not half.
+    const size_t processBytes     = opDataBytes + base->getLatticeSize();
+    const size_t processBytesHalf = opDataBytes + baseHalf->getLatticeSize();
+    OCIO_CHECK_EQUAL(processBytesHalf * 7, processBytes * 5);
+}
+#endif
@@ -65,6 +65,28 @@ OCIO_ADD_TEST(Lut3DOpData, clone)
     OCIO_CHECK_ASSERT(pClone->getArray()==ref.getArray());
 }
 
+OCIO_ADD_TEST(Lut3DOpData, cache_id)
+{
+    OCIO::Lut3DOpData ref(17);
+    const std::string cacheID = ref.getCacheID();
+
+    // The hash of the array values is memoized.
+    OCIO_CHECK_EQUAL(ref.getCacheID(), cacheID);
+
+    // Copies carry the hash along.
+    OCIO::Lut3DOpDataRcPtr pClone = ref.clone();
+    OCIO_CHECK_EQUAL(pClone->getCacheID(), cacheID);
+
+    // The non-const access to the array invalidates the hash.
+    ref.getArray()[1] = 0.1f;
+    const std::string newCacheID = ref.getCacheID();
+    OCIO_CHECK_NE(newCacheID, cacheID);
+    OCIO_CHECK_EQUAL(pClone->getCacheID(), cacheID);
+
+    pClone->getArray()[1] = 0.1f;
+    OCIO_CHECK_EQUAL(pClone->getCacheID(), newCacheID);
+}
+
 OCIO_ADD_TEST(Lut3DOpData, not_supported_length)
 {
     OCIO_CHECK_NO_THROW(OCIO::Lut3DOpData{ OCIO::Lut3DOpData::maxSupportedLength });
@@ -290,6 +312,55 @@ OCIO_ADD_TEST(Lut3DOpData, compose_2)
     OCIO_CHECK_CLOSE(a[14738], 4088.30493164f / 4095.0f, 1e-6f);
 }
 
+OCIO_ADD_TEST(Lut3DOpData, compose_cache)
+{
+    OCIO::Lut3DOpDataRcPtr lut1 = std::make_shared<OCIO::Lut3DOpData>(17);
+    OCIO::Lut3DOpDataRcPtr lut2 = std::make_shared<OCIO::Lut3DOpData>(33);
+    for (auto & v : lut1->getArray().getValues())
+    {
+        v = v * v;
+    }
+    for (auto & v : lut2->getArray().getValues())
+    {
+        v = std::sqrt(v) * 0.9f;
+    }
+    lut2->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    OCIO::ConstLut3DOpDataRcPtr lut1Const = lut1;
+    OCIO::ConstLut3DOpDataRcPtr lut2Const = lut2;
+
+    OCIO::ClearLut3DComposeCache();
+    OCIO::ResetLut3DComposeCacheStats();
+
+    OCIO::Lut3DOpDataRcPtr composed1 = OCIO::Lut3DOpData::Compose(lut1Const, lut2Const);
+    OCIO::Lut3DOpDataRcPtr composed2 = OCIO::Lut3DOpData::Compose(lut1Const, lut2Const);
+
+    const OCIO::CacheStats stats = OCIO::GetLut3DComposeCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_misses, 1);
+    OCIO_CHECK_EQUAL(stats.m_hits, 1);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+
+    // The composition uses the finer domain i.e. more than one block of pixels is evaluated.
+    OCIO_CHECK_EQUAL(composed1->getArray().getLength(), 33);
+    const std::vector<float> values = composed1->getArray().getValues();
+    OCIO_CHECK_ASSERT(values == composed2->getArray().getValues());
+
+    // Each composition owns its values.
+    composed2->getArray().getValues()[0] = 0.5f;
+    OCIO::Lut3DOpDataRcPtr composed3 = OCIO::Lut3DOpData::Compose(lut1Const, lut2Const);
+    OCIO_CHECK_ASSERT(values == composed3->getArray().getValues());
+
+    // A different LUT is not composed using the cached values.
+    lut2->getArray().getValues()[3 * 33 * 33 * 33 - 1] = 0.8f;
+    OCIO::Lut3DOpDataRcPtr composed4 = OCIO::Lut3DOpData::Compose(lut1Const, lut2Const);
+    OCIO_CHECK_ASSERT(values != composed4->getArray().getValues());
+
+    OCIO::ClearLut3DComposeCache();
+    lut2->getArray().getValues()[3 * 33 * 33 * 33 - 1] = 0.9f;
+    OCIO::Lut3DOpDataRcPtr composed5 = OCIO::Lut3DOpData::Compose(lut1Const, lut2Const);
+    OCIO_CHECK_ASSERT(values == composed5->getArray().getValues());
+}
+
 OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_lut_size)
 {
     const std::string fileName("clf/lut3d_17x17x17_10i_12i.clf");
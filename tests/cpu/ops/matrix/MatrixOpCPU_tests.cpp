@@ -2,6 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <cmath>
+#include <limits>
+
 #include "ops/matrix/MatrixOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
@@ -120,3 +123,111 @@ OCIO_ADD_TEST(MatrixOpCPU, matrix_renderer)
     OCIO_CHECK_EQUAL(rgba[3], 2.f);
 }
 
+
+namespace
+{
+bool SameValue(float a, float b)
+{
+    return (std::isnan(a) && std::isnan(b)) || a == b;
+}
+
+void CheckMatrixRange(OCIO::ConstMatrixOpDataRcPtr & mat,
+                      OCIO::ConstRangeOpDataRcPtr & range,
+                      unsigned line)
+{
+    // An odd number of pixels exercises the scalar tail of the planar renderers.
+    const std::vector<float> src = {
+         0.50f,  0.25f,  0.10f,  0.90f,
+        -0.80f,  1.50f,  2.00f,  0.10f,
+         1.00f,  0.00f, -0.00f,  1.00f,
+         std::numeric_limits<float>::quiet_NaN(),  0.30f,  0.70f,  0.50f,
+         std::numeric_limits<float>::infinity(),  -std::numeric_limits<float>::infinity(),
+         0.20f,  std::numeric_limits<float>::quiet_NaN(),
+         0.01f,  0.02f,  0.98f,  2.00f,
+        -0.25f, -0.50f,  0.75f, -1.00f };
+    const long numPixels = (long)src.size() / 4;
+
+    OCIO::ConstOpCPURcPtr fused = OCIO::GetMatrixRenderer(mat, range);
+    OCIO::ConstOpCPURcPtr matOp = OCIO::GetMatrixRenderer(mat);
+    OCIO::ConstOpCPURcPtr rangeOp = OCIO::GetRangeRenderer(range);
+
+    // Packed pixels.
+    std::vector<float> expected(src.size());
+    matOp->apply(src.data(), expected.data(), numPixels);
+    rangeOp->apply(expected.data(), expected.data(), numPixels);
+
+    std::vector<float> result(src.size());
+    fused->apply(src.data(), result.data(), numPixels);
+
+    for (size_t idx = 0; idx < src.size(); ++idx)
+    {
+        OCIO_CHECK_ASSERT_FROM(SameValue(result[idx], expected[idx]), line);
+    }
+
+    // Planar pixels.
+    std::vector<float> planes[4];
+    for (auto & plane : planes)
+    {
+        plane.resize(numPixels);
+    }
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            planes[c][idx] = src[4 * idx + c];
+        }
+    }
+
+    float * const ptrs[4] = { planes[0].data(), planes[1].data(),
+                              planes[2].data(), planes[3].data() };
+    fused->applyPlanar(ptrs, ptrs, numPixels);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            OCIO_CHECK_ASSERT_FROM(SameValue(planes[c][idx], expected[4 * idx + c]), line);
+        }
+    }
+}
+}
+
+OCIO_ADD_TEST(MatrixOpCPU, matrix_range_renderer)
+{
+    // The fused Matrix & Range renderers must match applying both renderers in sequence.
+
+    OCIO::MatrixOpDataRcPtr scale(OCIO::MatrixOpData::CreateDiagonalMatrix(1.5));
+    scale->setOffsetValue(0, 0.1);
+    scale->setOffsetValue(2, -0.2);
+
+    OCIO::MatrixOpDataRcPtr matrix(OCIO::MatrixOpData::CreateDiagonalMatrix(1.2));
+    matrix->setArrayValue(1, 0.3);
+    matrix->setArrayValue(4, -0.1);
+    matrix->setArrayValue(11, 0.5);
+    matrix->setOffsetValue(1, 0.05);
+    matrix->setOffsetValue(3, 0.2);
+
+    const double empty = OCIO::RangeOpData::EmptyValue();
+    const OCIO::RangeOpDataRcPtr ranges[] = {
+        std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.),
+        std::make_shared<OCIO::RangeOpData>(0.1, 0.9, -0.2, 1.2),
+        std::make_shared<OCIO::RangeOpData>(0.05, empty, 0.05, empty),
+        std::make_shared<OCIO::RangeOpData>(empty, 0.95, empty, 0.95)
+    };
+
+    for (const auto & m : { scale, matrix })
+    {
+        OCIO::ConstMatrixOpDataRcPtr mat = m;
+        for (const auto & r : ranges)
+        {
+            OCIO::ConstRangeOpDataRcPtr range = r;
+            CheckMatrixRange(mat, range, __LINE__);
+        }
+    }
+
+    // The diagonal matrix does not need the full matrix renderer.
+    OCIO::ConstMatrixOpDataRcPtr mat = scale;
+    OCIO::ConstRangeOpDataRcPtr range = ranges[0];
+    OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(mat, range);
+    OCIO_CHECK_ASSERT(dynamic_cast<const OCIO::ScaleWithOffsetRenderer*>(op.get()));
+}
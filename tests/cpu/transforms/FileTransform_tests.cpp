@@ -117,6 +117,52 @@ OCIO_ADD_TEST(FileTransform, load_file_ok)
     OCIO_CHECK_ASSERT(!proc->isNoOp());
 }
 
+OCIO_ADD_TEST(FileTransform, cache_stats)
+{
+    OCIO::ClearAllCaches();
+    OCIO::ResetGlobalCacheStats();
+
+    OCIO::CacheStats stats = OCIO::GetFileCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_entries, 0);
+    OCIO_CHECK_EQUAL(stats.m_bytes, 0);
+
+    // The processors come from different configs so the second one reuses the loaded file.
+    const std::string discreetLut("logtolin_8to8.lut");
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor(discreetLut));
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor(discreetLut));
+
+    stats = OCIO::GetFileCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 1);
+    OCIO_CHECK_EQUAL(stats.m_misses, 1);
+    OCIO_CHECK_EQUAL(stats.m_inserts, 1);
+    OCIO_CHECK_EQUAL(stats.m_evictions, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+    OCIO_CHECK_ASSERT(stats.m_bytes > 0);
+
+    // The file existence check goes through the file hash cache.
+    stats = OCIO::GetFileHashCacheStats();
+    OCIO_CHECK_ASSERT(stats.m_misses > 0);
+    OCIO_CHECK_ASSERT(stats.m_hits > 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, stats.m_inserts);
+    const size_t numFileHashes = stats.m_entries;
+
+    OCIO::ResetGlobalCacheStats();
+
+    stats = OCIO::GetFileCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_misses, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, 1);
+
+    stats = OCIO::GetFileHashCacheStats();
+    OCIO_CHECK_EQUAL(stats.m_hits, 0);
+    OCIO_CHECK_EQUAL(stats.m_entries, numFileHashes);
+
+    OCIO::ClearAllCaches();
+
+    OCIO_CHECK_EQUAL(OCIO::GetFileCacheStats().m_entries, 0);
+    OCIO_CHECK_EQUAL(OCIO::GetFileHashCacheStats().m_entries, 0);
+}
+
 OCIO_ADD_TEST(FileTransform, load_file_fail)
 {
     // Legacy Lustre 1D LUT files. Similar to supported formats but actually
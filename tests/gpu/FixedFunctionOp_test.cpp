@@ -375,3 +375,47 @@ OCIO_ADD_GPU_TEST(FixedFunction, style_XYZ_TO_LUV_inv)
 
     test.setErrorThreshold(1e-5f);
 }
+
+OCIO_ADD_GPU_TEST(FixedFunction, style_LIN_TO_PQ_fwd)
+{
+    OCIO::FixedFunctionTransformRcPtr func = OCIO::FixedFunctionTransform::Create();
+    func->setStyle(OCIO::FIXED_FUNCTION_LIN_TO_PQ);
+    func->setDirection(OCIO::TRANSFORM_DIR_FORWARD);
+
+    test.setProcessor(func);
+
+    test.setErrorThreshold(1e-5f);
+}
+
+OCIO_ADD_GPU_TEST(FixedFunction, style_LIN_TO_PQ_inv)
+{
+    OCIO::FixedFunctionTransformRcPtr func = OCIO::FixedFunctionTransform::Create();
+    func->setStyle(OCIO::FIXED_FUNCTION_LIN_TO_PQ);
+    func->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    test.setProcessor(func);
+
+    test.setErrorThreshold(1e-4f);
+}
+
+OCIO_ADD_GPU_TEST(FixedFunction, style_LIN_TO_HLG_fwd)
+{
+    OCIO::FixedFunctionTransformRcPtr func = OCIO::FixedFunctionTransform::Create();
+    func->setStyle(OCIO::FIXED_FUNCTION_LIN_TO_HLG);
+    func->setDirection(OCIO::TRANSFORM_DIR_FORWARD);
+
+    test.setProcessor(func);
+
+    test.setErrorThreshold(1e-5f);
+}
+
+OCIO_ADD_GPU_TEST(FixedFunction, style_LIN_TO_HLG_inv)
+{
+    OCIO::FixedFunctionTransformRcPtr func = OCIO::FixedFunctionTransform::Create();
+    func->setStyle(OCIO::FIXED_FUNCTION_LIN_TO_HLG);
+    func->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    test.setProcessor(func);
+
+    test.setErrorThreshold(1e-5f);
+}
@@ -16,7 +16,7 @@ public class ContextTest extends TestCase {
         Context cont = new Context().Create();
         cont.setSearchPath("testing123");
         cont.setWorkingDir("/dir/123");
-        assertEquals("$4c2d66a612fc25ddd509591e1dead57b", cont.getCacheID());
+        assertEquals("$a98e0114e943696f246e359621f95ae0", cont.getCacheID());
         assertEquals("testing123", cont.getSearchPath());
         assertEquals("/dir/123", cont.getWorkingDir());
         cont.setStringVar("TeSt", "foobar");
@@ -0,0 +1,95 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright Contributors to the OpenColorIO Project.
+
+import unittest
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
+import PyOpenColorIO as OCIO
+
+
+class CPUProcessorTest(unittest.TestCase):
+    OFFSET = [0.1, 0.2, 0.3, 0.4]
+
+    def setUp(self):
+        mat_tr = OCIO.MatrixTransform(offset=self.OFFSET)
+        cfg = OCIO.Config().CreateRaw()
+        self.cpu = cfg.getProcessor(mat_tr).getDefaultCPUProcessor()
+
+    def tearDown(self):
+        self.cpu = None
+
+    def test_apply_rgb_list(self):
+        """
+        Test applyRGB() with a list of several pixels.
+        """
+
+        pixels = self.cpu.applyRGB([0.0, 0.0, 0.0, 0.5, 0.5, 0.5])
+        expected = [0.1, 0.2, 0.3, 0.6, 0.7, 0.8]
+        self.assertEqual(len(pixels), len(expected))
+        for value, expected_value in zip(pixels, expected):
+            self.assertAlmostEqual(value, expected_value, places=5)
+
+        # The size must be a multiple of the number of channels.
+        with self.assertRaises(RuntimeError):
+            self.cpu.applyRGB([0.0, 0.0, 0.0, 0.5])
+
+    def test_apply_rgba_list(self):
+        """
+        Test applyRGBA() with a list of several pixels.
+        """
+
+        pixels = self.cpu.applyRGBA([0.0, 0.0, 0.0, 0.0, 0.5, 0.5, 0.5, 0.5])
+        expected = [0.1, 0.2, 0.3, 0.4, 0.6, 0.7, 0.8, 0.9]
+        self.assertEqual(len(pixels), len(expected))
+        for value, expected_value in zip(pixels, expected):
+            self.assertAlmostEqual(value, expected_value, places=5)
+
+        with self.assertRaises(RuntimeError):
+            self.cpu.applyRGBA([0.0, 0.0, 0.0, 0.0, 0.5, 0.5])
+
+    @unittest.skipIf(np is None, 'NumPy is not available')
+    def test_apply_rgb_numpy(self):
+        """
+        Test applyRGB() with a Nx3 NumPy array, processed in place.
+        """
+
+        pixels = np.linspace(0.0, 1.0, 30, dtype=np.float32).reshape(10, 3)
+        expected = pixels + np.array(self.OFFSET[:3], dtype=np.float32)
+
+        self.cpu.applyRGB(pixels)
+        np.testing.assert_allclose(pixels, expected, atol=1e-6)
+
+        # The non-contiguous views are rejected instead of writing the wrong entries.
+        pixels4 = np.zeros((10, 4), dtype=np.float32)
+        with self.assertRaises(RuntimeError):
+            self.cpu.applyRGB(pixels4[:, :3])
+        with self.assertRaises(RuntimeError):
+            self.cpu.applyRGB(pixels[::2])
+        with self.assertRaises(RuntimeError):
+            self.cpu.applyRGB(pixels[::-1])
+        np.testing.assert_array_equal(pixels4, np.zeros((10, 4), dtype=np.float32))
+        np.testing.assert_allclose(pixels, expected, atol=1e-6)
+
+    @unittest.skipIf(np is None, 'NumPy is not available')
+    def test_apply_rgba_numpy(self):
+        """
+        Test applyRGBA() with a Nx4 NumPy array, processed in place.
+        """
+
+        pixels = np.linspace(0.0, 1.0, 40, dtype=np.float32).reshape(10, 4)
+        expected = pixels + np.array(self.OFFSET, dtype=np.float32)
+
+        self.cpu.applyRGBA(pixels)
+        np.testing.assert_allclose(pixels, expected, atol=1e-6)
+
+        pixels8 = np.zeros((10, 8), dtype=np.float32)
+        with self.assertRaises(RuntimeError):
+            self.cpu.applyRGBA(pixels8[:, :4])
+        with self.assertRaises(RuntimeError):
+            self.cpu.applyRGBA(pixels[::-1])
+        np.testing.assert_array_equal(pixels8, np.zeros((10, 8), dtype=np.float32))
+        np.testing.assert_allclose(pixels, expected, atol=1e-6)
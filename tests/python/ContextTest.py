@@ -10,7 +10,7 @@ class ContextTest(unittest.TestCase):
         cont = OCIO.Context()
         cont.setSearchPath("testing123")
         cont.setWorkingDir("/dir/123")
-        self.assertEqual("$4c2d66a612fc25ddd509591e1dead57b", cont.getCacheID())
+        self.assertEqual("$a98e0114e943696f246e359621f95ae0", cont.getCacheID())
         self.assertEqual("testing123", cont.getSearchPath())
         self.assertEqual("/dir/123", cont.getWorkingDir())
         cont["TeSt"] = "foobar"
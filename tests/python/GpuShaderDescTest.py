@@ -13,6 +13,6 @@ class GpuShaderDescTest(unittest.TestCase):
         desc.setFunctionName("foo123")
         self.assertEqual("foo123", desc.getFunctionName())
         desc.finalize()
-        self.assertEqual("glsl_1.3 foo123 ocio outColor 0 $4dd1c89df8002b409e089089ce8f24e7",
+        self.assertEqual("glsl_1.3 foo123 ocio outColor 0 $c2ea85f34dd9ea27cc1dcb90ca1bc60a",
                          desc.getCacheID())
 
@@ -40,6 +40,7 @@ import BuiltinTransformTest
 import CDLTransformTest
 import ColorSpaceTest
 import ColorSpaceTransformTest
+import CPUProcessorTest
 import ExponentTransformTest
 import ExponentWithLinearTransformTest
 import ExposureContrastTransformTest
@@ -80,6 +81,7 @@ def suite():
     suite.addTest(loader.loadTestsFromModule(CDLTransformTest))
     suite.addTest(loader.loadTestsFromModule(ColorSpaceTest))
     suite.addTest(loader.loadTestsFromModule(ColorSpaceTransformTest))
+    suite.addTest(loader.loadTestsFromModule(CPUProcessorTest))
     suite.addTest(loader.loadTestsFromModule(ExponentTransformTest))
     suite.addTest(loader.loadTestsFromModule(ExponentWithLinearTransformTest))
     suite.addTest(loader.loadTestsFromModule(ExposureContrastTransformTest))